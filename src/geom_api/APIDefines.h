@@ -372,6 +372,7 @@ enum COMPUTATION_FILE_TYPE  {   NO_FILE_TYPE        = 0,	/*!< No export file typ
                                 CFD_PLOT3D_TYPE_DEPRECATED     = 1<<22,	
                                 CFD_VSPGEOM_TYPE    = 1<<23,	
                                 VSPAERO_VSPGEOM_TYPE = 1<<24,	
+                                DEGEN_GEOM_BIN_TYPE = 1<<25,	/*!< Binary DegenGeom file, read by the degen_geom Python package */
 };
 
 /*!
@@ -1602,6 +1603,15 @@ enum VIEW_TYPE { VIEW_LEFT,	/*!< Left 2D view type */
                  VIEW_NUM_TYPES	/*!< Number of 2D view types */
 };
 
+/*!
+	\ingroup Enumerations
+*/
+/*! Enum for how large numeric arrays (mesh triangles, point clouds) are stored in *.vsp3 files. */
+enum VSP3_ARRAY_ENCODING { VSP3_ARRAY_TEXT,	/*!< Comma separated text (default, readable by all versions) */
+                           VSP3_ARRAY_BASE64,	/*!< Base64 encoded binary blocks inline in the XML */
+                           VSP3_ARRAY_SIDECAR,	/*!< Binary blocks in a *.vsp3.bin file next to the *.vsp3 file, memory-mapped on load */
+};
+
 /*!
 	\ingroup Enumerations
 */
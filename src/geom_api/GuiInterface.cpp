@@ -173,6 +173,18 @@ void GuiInterface::ScreenGrab( const std::string &fname, int w, int h, bool tran
 #endif
 }
 
+bool GuiInterface::ScreenGrabViews( const std::vector < std::string > & fnames, const std::vector < vec3d > & rots, const std::vector < double > & zooms,
+                                    const std::vector < vec3d > & pans, const std::vector < vec3d > & cors, int w, int h, bool transparentBG, bool autocrop )
+{
+#ifdef VSP_USE_FLTK
+    if ( m_ScreenMgr )
+    {
+        return m_ScreenMgr->APIScreenGrabViews( fnames, rots, zooms, pans, cors, w, h, transparentBG, autocrop );
+    }
+#endif
+    return false;
+}
+
 // In a multi-threaded environment, this is safe to run from a secondary thread.
 void GuiInterface::SetViewAxis( bool vaxis )
 {
@@ -12,6 +12,9 @@
 #define GUIINTERFACE__INCLUDED_
 
 #include <string>
+#include <vector>
+
+#include "Vec3d.h"
 
 class ScreenMgr;
 class Vehicle;
@@ -47,6 +50,8 @@ public:
     bool IsEventLoopRunning() const;
 
     void ScreenGrab( const std::string & fname, int w, int h, bool transparentBG, bool autocrop );
+    bool ScreenGrabViews( const std::vector < std::string > & fnames, const std::vector < vec3d > & rots, const std::vector < double > & zooms,
+                          const std::vector < vec3d > & pans, const std::vector < vec3d > & cors, int w, int h, bool transparentBG, bool autocrop );
     void SetViewAxis( bool vaxis );
     void SetShowBorders( bool brdr );
     void SetBackground( double r, double g, double b );
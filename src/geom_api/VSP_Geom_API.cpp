@@ -46,6 +46,7 @@
 #include "WingGeom.h"
 #include "StlHelper.h"
 #include "ModeMgr.h"
+#include "ParallelUtil.h"
 
 #include <cstdlib>
 #include <csignal>
@@ -163,6 +164,14 @@ void VSPRenew()
 
 void Update( bool update_managers )
 {
+    // Advanced links call Update() after setting their outputs.  While a batch
+    // resolves its links, the batch does a single update when it is done.
+    if ( LinkMgr.InBatchResolve() )
+    {
+        ErrorMgr.NoError();
+        return;
+    }
+
     Vehicle* veh = GetVehicle();
     veh->Update();
 
@@ -230,6 +239,9 @@ void LimitedIntersectSurfaces( const vector < string > & geomvec, vector < vecto
 void ReadVSPFile( const string & file_name )
 {
     Vehicle* veh = GetVehicle();
+    ErrorMgr.NoError();
+
+    // Binary arrays that can not be read are reported by ReadXMLFile, the rest of the model is kept.
     int err = veh->ReadXMLFile( file_name );
     if( err != 0 )
     {
@@ -237,7 +249,6 @@ void ReadVSPFile( const string & file_name )
         return;
     }
     veh->SetVSP3FileName( file_name );
-    ErrorMgr.NoError();
 }
 
 void WriteVSPFile( const string & file_name, int set )
@@ -279,9 +290,53 @@ void ClearVSPModel()
     ErrorMgr.NoError();
 }
 
+string SaveVehicleSnapshot()
+{
+    Vehicle* veh = GetVehicle();
+    string id = veh->SaveSnapshot();
+    ErrorMgr.NoError();
+    return id;
+}
+
+int RestoreVehicleSnapshot( const string & snapshot_id )
+{
+    Vehicle* veh = GetVehicle();
+
+    int num_changed = 0;
+    string err_msg;
+    int err = veh->RestoreSnapshot( snapshot_id, num_changed, err_msg );
+    if ( err != VSP_OK )
+    {
+        if ( num_changed > 0 )
+        {
+            veh->Update();
+        }
+        ErrorMgr.AddError( ( ERROR_CODE ) err, "RestoreVehicleSnapshot::" + err_msg );
+        return 0;
+    }
+
+    veh->Update();
+
+    ErrorMgr.NoError();
+    return num_changed;
+}
+
+void DeleteVehicleSnapshot( const string & snapshot_id )
+{
+    GetVehicle()->DeleteSnapshot( snapshot_id );
+    ErrorMgr.NoError();
+}
+
+void DeleteAllVehicleSnapshots()
+{
+    GetVehicle()->DeleteAllSnapshots();
+    ErrorMgr.NoError();
+}
+
 void InsertVSPFile( const string & file_name, const string & parent )
 {
     Vehicle* veh = GetVehicle();
+    ErrorMgr.NoError();
 
     Geom* parent_geom = nullptr;
     if ( parent.size() > 0 )
@@ -302,13 +357,13 @@ void InsertVSPFile( const string & file_name, const string & parent )
         veh->ClearActiveGeom();
     }
 
+    // Binary arrays that can not be read are reported by ReadXMLFileGeomsOnly.
     int err = veh->ReadXMLFileGeomsOnly( file_name );
     if( err != 0 )
     {
         ErrorMgr.AddError( VSP_WRONG_FILE_TYPE, "InsertVSPFile::Error" + file_name );
         return;
     }
-    ErrorMgr.NoError();
 }
 
 string ImportFile( const string & file_name, int file_type, const string & parent  )
@@ -551,6 +606,12 @@ void ComputeDegenGeom( int set, int file_export_types )
         veh->setExportDegenGeomCsvFile( true );
     }
 
+    veh->setExportDegenGeomBinFile( false );
+    if ( file_export_types & DEGEN_GEOM_BIN_TYPE )
+    {
+        veh->setExportDegenGeomBinFile( true );
+    }
+
     bool useMode = false;
     string modeID;
 
@@ -1987,6 +2048,24 @@ void WriteResultsCSVFile( const string & id, const string & file_name )
     ErrorMgr.NoError();
  }
 
+// Write Results To Binary File ====//
+void WriteResultsBinaryFile( const string & id, const string & file_name )
+{
+    if ( !ResultsMgr.ValidResultsID( id ) )
+    {
+        ErrorMgr.AddError( VSP_INVALID_ID, "WriteResultsBinaryFile::Invalid ID " + id );
+        return;
+    }
+
+    vector < string > resids( 1, id );
+    if ( ResultsMgr.WriteBinaryFile( file_name, resids ) != VSP_OK )
+    {
+        ErrorMgr.AddError( VSP_FILE_WRITE_FAILURE, "WriteResultsBinaryFile::Can't Write File " + file_name );
+        return;
+    }
+    ErrorMgr.NoError();
+}
+
 void PrintResults( const string &results_id )
 {
     ResultsMgr.PrintResults( results_id );
@@ -2109,6 +2188,44 @@ void ScreenGrab( const string & fname, int w, int h, bool transparentBG, bool au
 #endif
 }
 
+void ScreenGrabViews( const vector < string > & fname_vec, const vector < vec3d > & rot_vec, const vector < double > & zoom_vec,
+                      const vector < vec3d > & pan_vec, const vector < vec3d > & cor_vec, int w, int h, bool transparentBG, bool autocrop )
+{
+    if ( rot_vec.size() != fname_vec.size() )
+    {
+        ErrorMgr.AddError( VSP_INVALID_INPUT_VAL, "ScreenGrabViews::rot_vec and fname_vec must be the same size" );
+        return;
+    }
+
+    if ( !zoom_vec.empty() && zoom_vec.size() != fname_vec.size() )
+    {
+        ErrorMgr.AddError( VSP_INVALID_INPUT_VAL, "ScreenGrabViews::zoom_vec must be empty or the same size as fname_vec" );
+        return;
+    }
+
+    if ( !pan_vec.empty() && pan_vec.size() != fname_vec.size() )
+    {
+        ErrorMgr.AddError( VSP_INVALID_INPUT_VAL, "ScreenGrabViews::pan_vec must be empty or the same size as fname_vec" );
+        return;
+    }
+
+    if ( !cor_vec.empty() && cor_vec.size() != fname_vec.size() )
+    {
+        ErrorMgr.AddError( VSP_INVALID_INPUT_VAL, "ScreenGrabViews::cor_vec must be empty or the same size as fname_vec" );
+        return;
+    }
+
+#ifdef VSP_USE_FLTK
+    if ( !GuiInterface::getInstance().ScreenGrabViews( fname_vec, rot_vec, zoom_vec, pan_vec, cor_vec, w, h, transparentBG, autocrop ) )
+    {
+        ErrorMgr.AddError( VSP_FILE_WRITE_FAILURE, "ScreenGrabViews::Main window is not shown, call StartGUI() first" );
+        return;
+    }
+#endif
+
+    ErrorMgr.NoError();
+}
+
 void SetViewAxis( bool vaxis )
 {
 #ifdef VSP_USE_FLTK
@@ -2209,6 +2326,7 @@ void AddMaterial( const string &name, const vec3d & ambient, const vec3d & diffu
     mat.SetEmissive( emissive );
     mat.SetAlpha( alpha );
     mat.SetShininess( shininess );
+    mat.m_UserMaterial = true;
 
     MaterialMgr.AddMaterial( mat );
     ErrorMgr.NoError();
@@ -8048,6 +8166,45 @@ double SetParmValUpdate( const string & container_id, const string & parm_name,
     return p->SetFromDevice( val );         // Force Update
 }
 
+/// Set the values of a list of parms.  Links are resolved and the vehicle
+/// is updated once after all values are applied.
+void SetParmValBatch( const vector < string > & parm_ids, const vector < double > & vals )
+{
+    if ( parm_ids.size() != vals.size() )
+    {
+        ErrorMgr.AddError( VSP_INVALID_INPUT_VAL, "SetParmValBatch::Number of values does not match number of Parms" );
+        return;
+    }
+
+    Vehicle* veh = GetVehicle();
+
+    bool found_all = true;
+
+    LinkMgr.StartBatch();
+    for ( int i = 0 ; i < ( int )parm_ids.size() ; i++ )
+    {
+        Parm* p = ParmMgr.FindParm( parm_ids[i] );
+        if ( !p )
+        {
+            ErrorMgr.AddError( VSP_CANT_FIND_PARM, "SetParmValBatch::Can't Find Parm " + parm_ids[i] );
+            found_all = false;
+            continue;
+        }
+        p->Set( vals[i] );
+    }
+    LinkMgr.EndBatch();
+
+    if ( veh )
+    {
+        veh->Update();
+    }
+
+    if ( found_all )
+    {
+        ErrorMgr.NoError();
+    }
+}
+
 /// Get the value of parm
 double GetParmVal( const string & parm_id )
 {
@@ -10399,6 +10556,142 @@ void AxisProjVecPnt01Guess(const std::string &geom_id, const int &surf_indx, con
     ErrorMgr.NoError();
 }
 
+//==== Array Surface Queries - Flat Buffers Evaluated In Parallel ====//
+// Points per thread below which spawning threads costs more than it saves.
+#define SURF_ARRAY_EVAL_CHUNK 256
+#define SURF_ARRAY_PROJ_CHUNK 16
+
+static const VspSurf * FindArraySurf( const std::string &geom_id, const int &surf_indx, const int &n, const string &fname )
+{
+    Geom* geom_ptr = GetVehicle()->FindGeom( geom_id );
+
+    if ( !geom_ptr )
+    {
+        ErrorMgr.AddError( VSP_INVALID_GEOM_ID, fname + "::Can't Find Geom " + geom_id );
+        return nullptr;
+    }
+
+    const VspSurf *surf = geom_ptr->GetSurfPtr( surf_indx );
+
+    if ( !surf )
+    {
+        ErrorMgr.AddError( VSP_INDEX_OUT_RANGE, fname + "::Invalid surf index " + to_string( surf_indx ) );
+        return nullptr;
+    }
+
+    if ( n < 0 )
+    {
+        ErrorMgr.AddError( VSP_INVALID_INPUT_VAL, fname + "::Negative point count." );
+        return nullptr;
+    }
+
+    return surf;
+}
+
+void CompPnt01Array( const std::string &geom_id, const int &surf_indx, const double *us, const double *ws, const int &n, double *pnt_out )
+{
+    const VspSurf *surf = FindArraySurf( geom_id, surf_indx, n, "CompPnt01Array" );
+
+    if ( !surf )
+    {
+        return;
+    }
+
+    ParallelFor( n, SURF_ARRAY_EVAL_CHUNK, [&]( int begin, int end )
+    {
+        for ( int i = begin; i < end; i++ )
+        {
+            vec3d p = surf->CompPnt01( clamp( us[i], 0.0, 1.0 ), clamp( ws[i], 0.0, 1.0 ) );
+            p.get_pnt( &pnt_out[ 3 * i ] );
+        }
+    } );
+
+    ErrorMgr.NoError();
+}
+
+void CompNorm01Array( const std::string &geom_id, const int &surf_indx, const double *us, const double *ws, const int &n, double *norm_out )
+{
+    const VspSurf *surf = FindArraySurf( geom_id, surf_indx, n, "CompNorm01Array" );
+
+    if ( !surf )
+    {
+        return;
+    }
+
+    ParallelFor( n, SURF_ARRAY_EVAL_CHUNK, [&]( int begin, int end )
+    {
+        for ( int i = begin; i < end; i++ )
+        {
+            vec3d p = surf->CompNorm01( clamp( us[i], 0.0, 1.0 ), clamp( ws[i], 0.0, 1.0 ) );
+            p.get_pnt( &norm_out[ 3 * i ] );
+        }
+    } );
+
+    ErrorMgr.NoError();
+}
+
+void CompCurvature01Array( const std::string &geom_id, const int &surf_indx, const double *us, const double *ws, const int &n, double *k1_out, double *k2_out, double *ka_out, double *kg_out )
+{
+    const VspSurf *surf = FindArraySurf( geom_id, surf_indx, n, "CompCurvature01Array" );
+
+    if ( !surf )
+    {
+        return;
+    }
+
+    ParallelFor( n, SURF_ARRAY_EVAL_CHUNK, [&]( int begin, int end )
+    {
+        for ( int i = begin; i < end; i++ )
+        {
+            surf->CompCurvature01( clamp( us[i], 0.0, 1.0 ), clamp( ws[i], 0.0, 1.0 ), k1_out[i], k2_out[i], ka_out[i], kg_out[i] );
+        }
+    } );
+
+    ErrorMgr.NoError();
+}
+
+void ProjPnt01Array( const std::string &geom_id, const int &surf_indx, const double *pnts, const int &n, double *u_out, double *w_out, double *d_out )
+{
+    const VspSurf *surf = FindArraySurf( geom_id, surf_indx, n, "ProjPnt01Array" );
+
+    if ( !surf )
+    {
+        return;
+    }
+
+    ParallelFor( n, SURF_ARRAY_PROJ_CHUNK, [&]( int begin, int end )
+    {
+        for ( int i = begin; i < end; i++ )
+        {
+            vec3d pt( pnts[ 3 * i ], pnts[ 3 * i + 1 ], pnts[ 3 * i + 2 ] );
+            d_out[i] = surf->FindNearest01( u_out[i], w_out[i], pt );
+        }
+    } );
+
+    ErrorMgr.NoError();
+}
+
+void AxisProjPnt01Array( const std::string &geom_id, const int &surf_indx, const int &iaxis, const double *pnts, const int &n, double *u_out, double *w_out, double *d_out )
+{
+    const VspSurf *surf = FindArraySurf( geom_id, surf_indx, n, "AxisProjPnt01Array" );
+
+    if ( !surf )
+    {
+        return;
+    }
+
+    ParallelFor( n, SURF_ARRAY_PROJ_CHUNK, [&]( int begin, int end )
+    {
+        for ( int i = begin; i < end; i++ )
+        {
+            vec3d pt( pnts[ 3 * i ], pnts[ 3 * i + 1 ], pnts[ 3 * i + 2 ] );
+            d_out[i] = surf->ProjectPt01( pt, iaxis, u_out[i], w_out[i] );
+        }
+    } );
+
+    ErrorMgr.NoError();
+}
+
 std::vector < bool > VecInsideSurf( const std::string &geom_id, const int &surf_indx, const std::vector < vec3d > &pts )
 {
     Vehicle* veh = GetVehicle();
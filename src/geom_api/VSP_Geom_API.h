@@ -962,6 +962,103 @@ extern std::string GetVSPFileName();
 
 extern void ClearVSPModel();
 
+/*!
+    \ingroup Vehicle
+*/
+/*!
+    Save an in-memory snapshot of the current model. The snapshot records every Parm value, the Parm links and advanced
+    links, and the Geom tree. Restoring it with RestoreVehicleSnapshot is far faster than reading the *.vsp3 file again,
+    which makes it suited to resetting the model between evaluations of an optimization loop.
+    \forcpponly
+    \code{.cpp}
+    string pod_id = AddGeom( "POD" );
+
+    string snap_id = SaveVehicleSnapshot();
+
+    SetParmVal( pod_id, "Length", "Design", 12.0 );
+    AddGeom( "WING" );
+
+    RestoreVehicleSnapshot( snap_id );      // Length is reset and the wing is removed
+    \endcode
+    \endforcpponly
+    \beginPythonOnly
+    \code{.py}
+    pod_id = AddGeom( "POD" )
+
+    snap_id = SaveVehicleSnapshot()
+
+    SetParmVal( pod_id, "Length", "Design", 12.0 )
+    AddGeom( "WING" )
+
+    RestoreVehicleSnapshot( snap_id )      # Length is reset and the wing is removed
+
+    \endcode
+    \endPythonOnly
+    \sa RestoreVehicleSnapshot, DeleteVehicleSnapshot
+    \return string Snapshot ID
+*/
+
+extern std::string SaveVehicleSnapshot();
+
+/*!
+    \ingroup Vehicle
+*/
+/*!
+    Restore a snapshot saved with SaveVehicleSnapshot. Only Parms whose values differ from the snapshot are set, so only
+    the Geoms that own them are updated. Geoms, links and advanced links created after the snapshot are removed. If a Geom,
+    link or advanced link in the snapshot was deleted, or a Geom gained or lost cross sections or sub-surfaces, the snapshot
+    can not be restored and the model is left unchanged.
+    \forcpponly
+    \code{.cpp}
+    string pod_id = AddGeom( "POD" );
+
+    string snap_id = SaveVehicleSnapshot();
+
+    SetParmVal( pod_id, "Length", "Design", 12.0 );
+
+    int num_changed = RestoreVehicleSnapshot( snap_id );
+    \endcode
+    \endforcpponly
+    \beginPythonOnly
+    \code{.py}
+    pod_id = AddGeom( "POD" )
+
+    snap_id = SaveVehicleSnapshot()
+
+    SetParmVal( pod_id, "Length", "Design", 12.0 )
+
+    num_changed = RestoreVehicleSnapshot( snap_id )
+
+    \endcode
+    \endPythonOnly
+    \sa SaveVehicleSnapshot
+    \param [in] snapshot_id string Snapshot ID
+    \return int Number of Parms that were changed
+*/
+
+extern int RestoreVehicleSnapshot( const std::string & snapshot_id );
+
+/*!
+    \ingroup Vehicle
+*/
+/*!
+    Delete a snapshot saved with SaveVehicleSnapshot
+    \sa SaveVehicleSnapshot, DeleteAllVehicleSnapshots
+    \param [in] snapshot_id string Snapshot ID
+*/
+
+extern void DeleteVehicleSnapshot( const std::string & snapshot_id );
+
+/*!
+    \ingroup Vehicle
+*/
+/*!
+    Delete all snapshots saved with SaveVehicleSnapshot
+    \sa SaveVehicleSnapshot, DeleteVehicleSnapshot
+*/
+
+extern void DeleteAllVehicleSnapshots();
+
 /*!
     \ingroup FileIO
 */
@@ -1352,7 +1449,7 @@ extern std::string ComputePlaneSlice( int set, int num_slices, const vec3d & nor
     \endPythonOnly
     \sa SetAnalysisInputDefaults, PrintAnalysisInputs, ExecAnalysis, COMPUTATION_FILE_TYPE
     \param [in] set int Set index (i.e. SET_ALL)
-    \param [in] file_export_types int DegenGeom file type to export (supports XOR i.e DEGEN_GEOM_M_TYPE & DEGEN_GEOM_CSV_TYPE)
+    \param [in] file_export_types int DegenGeom file type to export (supports XOR i.e DEGEN_GEOM_M_TYPE & DEGEN_GEOM_CSV_TYPE & DEGEN_GEOM_BIN_TYPE)
 */
 
 extern void ComputeDegenGeom( int set, int file_export_types );
@@ -5613,6 +5710,46 @@ extern void DeleteResult( const std::string & id );
 
 extern void WriteResultsCSVFile( const std::string & id, const std::string & file_name );
 
+/*!
+    \ingroup Results
+*/
+/*!
+    Export a result to a binary file.  Each data entry is written as its name, RES_DATA_TYPE, row and column counts, then its
+    contiguous values.  The file starts with the 8 character tag "VSPRES01" and holds one record per result in the same order as
+    WriteResultsCSVFile, including any sub-results.  Values are written in native byte order with 32 bit ints and 64 bit doubles,
+    strings are prefixed by their length, and matrices list their row lengths before their values.
+    \forcpponly
+    \code{.cpp}
+    // Add Pod Geom
+    string pid = AddGeom( "POD" );
+
+    string analysis_name = "VSPAEROComputeGeometry";
+
+    string rid = ExecAnalysis( analysis_name );
+
+    WriteResultsBinaryFile( rid, "CompGeomRes.vspres" );
+    \endcode
+    \endforcpponly
+    \beginPythonOnly
+    \code{.py}
+    # Add Pod Geom
+    pid = AddGeom( "POD" )
+
+    analysis_name = "VSPAEROComputeGeometry"
+
+    rid = ExecAnalysis( analysis_name )
+
+    WriteResultsBinaryFile( rid, "CompGeomRes.vspres" )
+
+    \endcode
+    \endPythonOnly
+    \sa WriteResultsCSVFile
+    \param [in] id string Result ID
+    \param [in] file_name string Binary output file name
+*/
+
+extern void WriteResultsBinaryFile( const std::string & id, const std::string & file_name );
+
 /*!
     \ingroup Results
 */
@@ -6141,6 +6278,62 @@ extern bool IsEventLoopRunning( );
 
 extern void ScreenGrab( const string & fname, int w, int h, bool transparentBG, bool autocrop = false );
 
+/*!
+    \ingroup Visualization
+*/
+/*!
+    Capture one image per file name, each from its own camera orientation and optional zoom, pan and center of
+    rotation, as set in the Adjust View screen. The scene is prepared once and only the camera changes between
+    images, so a batch is much faster than repeated calls to ScreenGrab. The current view is restored afterwards.
+    The main window must be shown, e.g. with StartGUI(). Note, VSP_USE_FLTK must be defined
+    \forcpponly
+    \code{.cpp}
+    array< string > fname_vec;
+    array< vec3d > rot_vec;
+    array< double > zoom_vec;                                       // Empty keeps the current zoom
+    array< vec3d > pan_vec;                                         // Empty keeps the current pan
+    array< vec3d > cor_vec;                                         // Empty keeps the current center of rotation
+
+    for ( int i = 0; i < 36; i++ )
+    {
+        fname_vec.push_back( "turntable_" + i + ".png" );
+        rot_vec.push_back( vec3d( 0.0, 0.0, 10.0 * i ) );           // Rotation angles (deg) as in the Adjust View screen
+    }
+
+    ScreenGrabViews( fname_vec, rot_vec, zoom_vec, pan_vec, cor_vec, 1000, 1000, true, true );
+    \endcode
+    \endforcpponly
+    \beginPythonOnly
+    \code{.py}
+    fname_vec = []
+    rot_vec = []
+    zoom_vec = []                                                   # Empty keeps the current zoom
+    pan_vec = []                                                    # Empty keeps the current pan
+    cor_vec = []                                                    # Empty keeps the current center of rotation
+
+    for i in range( 36 ):
+        fname_vec.append( 'turntable_' + str( i ) + '.png' )
+        rot_vec.append( vec3d( 0.0, 0.0, 10.0 * i ) )               # Rotation angles (deg) as in the Adjust View screen
+
+    ScreenGrabViews( fname_vec, rot_vec, zoom_vec, pan_vec, cor_vec, 1000, 1000, True, True )
+
+    \endcode
+    \endPythonOnly
+    \sa ScreenGrab
+    \param [in] fname_vec vector<string> Output file names
+    \param [in] rot_vec vector<vec3d> X, Y and Z view rotation angles (deg) for each image
+    \param [in] zoom_vec vector<double> Relative zoom for each image, or empty to keep the current zoom
+    \param [in] pan_vec vector<vec3d> X and Y pan for each image (Z is ignored), or empty to keep the current pan
+    \param [in] cor_vec vector<vec3d> Center of rotation for each image, or empty to keep the current center
+    \param [in] w int Width of screen grabs
+    \param [in] h int Height of screen grabs
+    \param [in] transparentBG bool Transparent background flag
+    \param [in] autocrop bool Automatically crop transparent background flag
+*/
+
+extern void ScreenGrabViews( const vector < string > & fname_vec, const vector < vec3d > & rot_vec, const vector < double > & zoom_vec,
+                             const vector < vec3d > & pan_vec, const vector < vec3d > & cor_vec, int w, int h, bool transparentBG, bool autocrop = false );
+
 /*!
     \ingroup Visualization
 */
@@ -6294,7 +6487,7 @@ extern void SetGeomMaterialName( const string &geom_id, const string &name );
     \ingroup Visualization
 */
 /*!
-    Set the visualization material the specified geometry
+    Set the visualization material the specified geometry. The material is saved with the model and removed by ClearVSPModel.
     \forcpponly
     \code{.cpp}
     string pid = AddGeom( "POD" );
@@ -16334,6 +16527,49 @@ extern double SetParmValUpdate( const std::string & parm_id, double val );
 
 extern double SetParmValUpdate( const std::string & geom_id, const std::string & parm_name, const std::string & parm_group_name, double val );
 
+/*!
+    \ingroup Parm
+*/
+/*!
+    Set the values of a list of Parms, then resolve links and update the Vehicle once. Links and advanced links
+    driven by any of the Parms are evaluated once after all values have been applied, and each affected Geom is
+    updated once. This is much faster than calling SetParmValUpdate for each Parm when many values change together,
+    as in an optimization loop. Parms driven by a link are recomputed from their link inputs after the values are
+    applied.
+    \forcpponly
+    \code{.cpp}
+    //==== Add Pod Geometry ====//
+    string pod_id = AddGeom( "POD" );
+
+    vector < string > parm_ids;
+    parm_ids.push_back( GetParm( pod_id, "Length", "Design" ) );
+    parm_ids.push_back( GetParm( pod_id, "X_Rel_Location", "XForm" ) );
+
+    vector < double > vals;
+    vals.push_back( 12.0 );
+    vals.push_back( 5.0 );
+
+    SetParmValBatch( parm_ids, vals );
+    \endcode
+    \endforcpponly
+    \beginPythonOnly
+    \code{.py}
+    #==== Add Pod Geometry ====//
+    pod_id = AddGeom( "POD" )
+
+    parm_ids = [ GetParm( pod_id, "Length", "Design" ), GetParm( pod_id, "X_Rel_Location", "XForm" ) ]
+
+    SetParmValBatch( parm_ids, [ 12.0, 5.0 ] )
+
+    \endcode
+    \endPythonOnly
+    \sa SetParmVal, SetParmValUpdate
+    \param [in] parm_ids vector<string> Parm IDs
+    \param [in] vals vector<double> Parm values to set, one per Parm ID
+*/
+
+extern void SetParmValBatch( const std::vector< std::string > & parm_ids, const std::vector< double > & vals );
+
 /*!
     \ingroup Parm
 */
@@ -23701,6 +23937,186 @@ extern void AxisProjVecPnt01(const std::string &geom_id, const int &surf_indx, c
 
 extern void AxisProjVecPnt01Guess(const std::string &geom_id, const int &surf_indx, const int &iaxis, const std::vector < vec3d > &pts, const std::vector < double > &u0s, const std::vector < double > &w0s, std::vector < double > &u_out_vec, std::vector < double > &w_out_vec, std::vector < double > &d_out_vec );
 
+/*!
+    \ingroup SurfaceQuery
+*/
+/*!
+    Determine the 3D coordinate points for input arrays of surface coordinates.  This is the array form of CompVecPnt01 intended for large inputs.
+    Inputs and outputs are contiguous arrays of doubles and the points are evaluated in parallel.  In Python, the inputs may be any sequence or
+    numpy array and the result is returned as an n x 3 numpy array without per-point conversion.
+    \beginPythonOnly
+    \code{.py}
+    import numpy as np
+
+    # Add Pod Geom
+    geom_id = AddGeom( "POD", "" )
+
+    n = 100000
+
+    uvec = np.random.rand( n )
+    wvec = np.random.rand( n )
+
+    pts = CompPnt01Array( geom_id, 0, uvec, wvec )
+
+    print( pts.shape )
+
+    \endcode
+    \endPythonOnly
+    \sa CompVecPnt01, CompNorm01Array
+    \param [in] geom_id string Geom ID
+    \param [in] surf_indx int Main surface index from the parent Geom
+    \param [in] us Input array of n U (0 - 1) surface coordinates
+    \param [in] ws Input array of n W (0 - 1) surface coordinates
+    \param [in] n int Number of points
+    \param [out] pnt_out Output array of 3 * n doubles, the x, y, z coordinates of each point in turn
+*/
+
+extern void CompPnt01Array( const std::string &geom_id, const int &surf_indx, const double *us, const double *ws, const int &n, double *pnt_out );
+
+/*!
+    \ingroup SurfaceQuery
+*/
+/*!
+    Determine the normal vectors on a surface for input arrays of surface coordinates.  This is the array form of CompVecNorm01; the normals are
+    evaluated in parallel.  In Python, the result is returned as an n x 3 numpy array.
+    \beginPythonOnly
+    \code{.py}
+    import numpy as np
+
+    # Add Pod Geom
+    geom_id = AddGeom( "POD", "" )
+
+    n = 100000
+
+    uvec = np.random.rand( n )
+    wvec = np.random.rand( n )
+
+    norms = CompNorm01Array( geom_id, 0, uvec, wvec )
+
+    \endcode
+    \endPythonOnly
+    \sa CompVecNorm01, CompPnt01Array
+    \param [in] geom_id string Geom ID
+    \param [in] surf_indx int Main surface index from the parent Geom
+    \param [in] us Input array of n U (0 - 1) surface coordinates
+    \param [in] ws Input array of n W (0 - 1) surface coordinates
+    \param [in] n int Number of points
+    \param [out] norm_out Output array of 3 * n doubles, the x, y, z components of each normal in turn
+*/
+
+extern void CompNorm01Array( const std::string &geom_id, const int &surf_indx, const double *us, const double *ws, const int &n, double *norm_out );
+
+/*!
+    \ingroup SurfaceQuery
+*/
+/*!
+    Determine the curvature of a surface at input arrays of surface coordinates.  This is the array form of CompVecCurvature01; the curvatures
+    are evaluated in parallel.  In Python, the four outputs are returned as a tuple of numpy arrays.
+    \beginPythonOnly
+    \code{.py}
+    import numpy as np
+
+    # Add Pod Geom
+    geom_id = AddGeom( "POD", "" )
+
+    n = 100000
+
+    uvec = np.random.rand( n )
+    wvec = np.random.rand( n )
+
+    k1, k2, ka, kg = CompCurvature01Array( geom_id, 0, uvec, wvec )
+
+    \endcode
+    \endPythonOnly
+    \sa CompVecCurvature01
+    \param [in] geom_id string Geom ID
+    \param [in] surf_indx int Main surface index from the parent Geom
+    \param [in] us Input array of n U (0 - 1) surface coordinates
+    \param [in] ws Input array of n W (0 - 1) surface coordinates
+    \param [in] n int Number of points
+    \param [out] k1_out Output array of n maximum principal curvatures
+    \param [out] k2_out Output array of n minimum principal curvatures
+    \param [out] ka_out Output array of n mean curvatures
+    \param [out] kg_out Output array of n Gaussian curvatures
+*/
+
+extern void CompCurvature01Array( const std::string &geom_id, const int &surf_indx, const double *us, const double *ws, const int &n, double *k1_out, double *k2_out, double *ka_out, double *kg_out );
+
+/*!
+    \ingroup SurfaceQuery
+*/
+/*!
+    Project an array of 3D coordinate points onto a surface.  This is the array form of ProjVecPnt01; the projections are evaluated in parallel.
+    In Python, the points may be an n x 3 numpy array and the outputs are returned as a tuple of numpy arrays.
+    \beginPythonOnly
+    \code{.py}
+    import numpy as np
+
+    # Add Pod Geom
+    geom_id = AddGeom( "POD", "" )
+
+    n = 10000
+
+    uvec = np.random.rand( n )
+    wvec = np.random.rand( n )
+
+    pts = CompPnt01Array( geom_id, 0, uvec, wvec )
+    pts[:, 0] += 0.1
+
+    uout, wout, dout = ProjPnt01Array( geom_id, 0, pts )
+
+    \endcode
+    \endPythonOnly
+    \sa ProjVecPnt01, AxisProjPnt01Array
+    \param [in] geom_id string Geom ID
+    \param [in] surf_indx int Main surface index from the parent Geom
+    \param [in] pnts Input array of 3 * n doubles, the x, y, z coordinates of each point in turn
+    \param [in] n int Number of points
+    \param [out] u_out Output array of n closest U (0 - 1) surface coordinates
+    \param [out] w_out Output array of n closest W (0 - 1) surface coordinates
+    \param [out] d_out Output array of n distances between each point and its projection
+*/
+
+extern void ProjPnt01Array( const std::string &geom_id, const int &surf_indx, const double *pnts, const int &n, double *u_out, double *w_out, double *d_out );
+
+/*!
+    \ingroup SurfaceQuery
+*/
+/*!
+    Project an array of 3D coordinate points onto a surface along a specified axis.  This is the array form of AxisProjVecPnt01; the projections
+    are evaluated in parallel.  Points whose axis-aligned ray does not intersect the surface return -1 in the outputs.
+    \beginPythonOnly
+    \code{.py}
+    import numpy as np
+
+    # Add Pod Geom
+    geom_id = AddGeom( "POD", "" )
+
+    n = 10000
+
+    uvec = np.random.rand( n )
+    wvec = np.random.rand( n )
+
+    pts = CompPnt01Array( geom_id, 0, uvec, wvec )
+    pts[:, 1] -= 5.0
+
+    uout, wout, dout = AxisProjPnt01Array( geom_id, 0, Y_DIR, pts )
+
+    \endcode
+    \endPythonOnly
+    \sa AxisProjVecPnt01, ProjPnt01Array
+    \param [in] geom_id string Geom ID
+    \param [in] surf_indx int Main surface index from the parent Geom
+    \param [in] iaxis int Axis direction to project point along (X_DIR, Y_DIR, or Z_DIR)
+    \param [in] pnts Input array of 3 * n doubles, the x, y, z coordinates of each point in turn
+    \param [in] n int Number of points
+    \param [out] u_out Output array of n U (0 - 1) surface coordinates
+    \param [out] w_out Output array of n W (0 - 1) surface coordinates
+    \param [out] d_out Output array of n axis distances between each point and its projection
+*/
+
+extern void AxisProjPnt01Array( const std::string &geom_id, const int &surf_indx, const int &iaxis, const double *pnts, const int &n, double *u_out, double *w_out, double *d_out );
+
 /*!
     \ingroup SurfaceQuery
 */
@@ -38,3 +38,287 @@ import_array();
         return numpy_array;
     }
 }
+
+/* Array surface queries.  Inputs are converted to contiguous double arrays once (no copy when they already
+   are), the GIL is released while the points are evaluated in parallel, and results come back as new numpy arrays. */
+%include <std_string.i>
+
+%{
+#include "VSP_Geom_API.h"
+
+static PyArrayObject* VSPDoubleArray( PyObject* obj )
+{
+    return (PyArrayObject*) PyArray_FROMANY( obj, NPY_DOUBLE, 0, 0, NPY_ARRAY_IN_ARRAY );
+}
+
+static PyObject* VSPNewDoubleArray( int n, int ncol )
+{
+    npy_intp dims[2] = {n, ncol};
+    return PyArray_ZEROS( ncol > 1 ? 2 : 1, dims, NPY_DOUBLE, 0 );
+}
+
+/* Convert a pair of u, w inputs, returning the number of points or -1 with a Python error set. */
+static int VSPUWArrays( PyObject* us, PyObject* ws, PyArrayObject** u_arr, PyArrayObject** w_arr )
+{
+    *u_arr = VSPDoubleArray( us );
+    *w_arr = *u_arr ? VSPDoubleArray( ws ) : NULL;
+
+    if ( !*u_arr || !*w_arr )
+    {
+        return -1;
+    }
+
+    if ( PyArray_SIZE( *u_arr ) != PyArray_SIZE( *w_arr ) )
+    {
+        PyErr_SetString( PyExc_ValueError, "u and w arrays must be the same size" );
+        return -1;
+    }
+
+    return (int) PyArray_SIZE( *u_arr );
+}
+
+/* Convert an n x 3 (or flat 3n) point input, returning the number of points or -1 with a Python error set. */
+static int VSPPntArray( PyObject* pnts, PyArrayObject** p_arr )
+{
+    *p_arr = VSPDoubleArray( pnts );
+
+    if ( !*p_arr )
+    {
+        return -1;
+    }
+
+    if ( PyArray_SIZE( *p_arr ) % 3 != 0 )
+    {
+        PyErr_SetString( PyExc_ValueError, "points must be an n x 3 array" );
+        return -1;
+    }
+
+    return (int) ( PyArray_SIZE( *p_arr ) / 3 );
+}
+%}
+
+%nothread VSPCompPnt01Array;
+%nothread VSPCompNorm01Array;
+%nothread VSPCompCurvature01Array;
+%nothread VSPProjPnt01Array;
+%nothread VSPAxisProjPnt01Array;
+
+%rename(CompPnt01Array) VSPCompPnt01Array;
+%rename(CompNorm01Array) VSPCompNorm01Array;
+%rename(CompCurvature01Array) VSPCompCurvature01Array;
+%rename(ProjPnt01Array) VSPProjPnt01Array;
+%rename(AxisProjPnt01Array) VSPAxisProjPnt01Array;
+
+%inline %{
+PyObject* VSPCompPnt01Array( const std::string &geom_id, int surf_indx, PyObject* us, PyObject* ws )
+{
+    PyArrayObject *u_arr, *w_arr;
+    PyObject *result = NULL;
+
+    int n = VSPUWArrays( us, ws, &u_arr, &w_arr );
+    if ( n >= 0 && ( result = VSPNewDoubleArray( n, 3 ) ) )
+    {
+        const double *u = (const double*) PyArray_DATA( u_arr );
+        const double *w = (const double*) PyArray_DATA( w_arr );
+        double *p = (double*) PyArray_DATA( (PyArrayObject*) result );
+
+        Py_BEGIN_ALLOW_THREADS
+        vsp::CompPnt01Array( geom_id, surf_indx, u, w, n, p );
+        Py_END_ALLOW_THREADS
+    }
+
+    Py_XDECREF( u_arr );
+    Py_XDECREF( w_arr );
+    return result;
+}
+
+PyObject* VSPCompNorm01Array( const std::string &geom_id, int surf_indx, PyObject* us, PyObject* ws )
+{
+    PyArrayObject *u_arr, *w_arr;
+    PyObject *result = NULL;
+
+    int n = VSPUWArrays( us, ws, &u_arr, &w_arr );
+    if ( n >= 0 && ( result = VSPNewDoubleArray( n, 3 ) ) )
+    {
+        const double *u = (const double*) PyArray_DATA( u_arr );
+        const double *w = (const double*) PyArray_DATA( w_arr );
+        double *p = (double*) PyArray_DATA( (PyArrayObject*) result );
+
+        Py_BEGIN_ALLOW_THREADS
+        vsp::CompNorm01Array( geom_id, surf_indx, u, w, n, p );
+        Py_END_ALLOW_THREADS
+    }
+
+    Py_XDECREF( u_arr );
+    Py_XDECREF( w_arr );
+    return result;
+}
+
+PyObject* VSPCompCurvature01Array( const std::string &geom_id, int surf_indx, PyObject* us, PyObject* ws )
+{
+    PyArrayObject *u_arr, *w_arr;
+    PyObject *k1 = NULL, *k2 = NULL, *ka = NULL, *kg = NULL;
+
+    int n = VSPUWArrays( us, ws, &u_arr, &w_arr );
+    if ( n >= 0 && ( k1 = VSPNewDoubleArray( n, 1 ) ) && ( k2 = VSPNewDoubleArray( n, 1 ) ) &&
+         ( ka = VSPNewDoubleArray( n, 1 ) ) && ( kg = VSPNewDoubleArray( n, 1 ) ) )
+    {
+        const double *u = (const double*) PyArray_DATA( u_arr );
+        const double *w = (const double*) PyArray_DATA( w_arr );
+        double *k1p = (double*) PyArray_DATA( (PyArrayObject*) k1 );
+        double *k2p = (double*) PyArray_DATA( (PyArrayObject*) k2 );
+        double *kap = (double*) PyArray_DATA( (PyArrayObject*) ka );
+        double *kgp = (double*) PyArray_DATA( (PyArrayObject*) kg );
+
+        Py_BEGIN_ALLOW_THREADS
+        vsp::CompCurvature01Array( geom_id, surf_indx, u, w, n, k1p, k2p, kap, kgp );
+        Py_END_ALLOW_THREADS
+    }
+
+    Py_XDECREF( u_arr );
+    Py_XDECREF( w_arr );
+
+    if ( !kg )
+    {
+        Py_XDECREF( k1 );
+        Py_XDECREF( k2 );
+        Py_XDECREF( ka );
+        return NULL;
+    }
+    return Py_BuildValue( "(NNNN)", k1, k2, ka, kg );
+}
+
+PyObject* VSPProjPnt01Array( const std::string &geom_id, int surf_indx, PyObject* pnts )
+{
+    PyArrayObject *p_arr;
+    PyObject *uo = NULL, *wo = NULL, *d = NULL;
+
+    int n = VSPPntArray( pnts, &p_arr );
+    if ( n >= 0 && ( uo = VSPNewDoubleArray( n, 1 ) ) && ( wo = VSPNewDoubleArray( n, 1 ) ) && ( d = VSPNewDoubleArray( n, 1 ) ) )
+    {
+        const double *p = (const double*) PyArray_DATA( p_arr );
+        double *up = (double*) PyArray_DATA( (PyArrayObject*) uo );
+        double *wp = (double*) PyArray_DATA( (PyArrayObject*) wo );
+        double *dp = (double*) PyArray_DATA( (PyArrayObject*) d );
+
+        Py_BEGIN_ALLOW_THREADS
+        vsp::ProjPnt01Array( geom_id, surf_indx, p, n, up, wp, dp );
+        Py_END_ALLOW_THREADS
+    }
+
+    Py_XDECREF( p_arr );
+
+    if ( !d )
+    {
+        Py_XDECREF( uo );
+        Py_XDECREF( wo );
+        return NULL;
+    }
+    return Py_BuildValue( "(NNN)", uo, wo, d );
+}
+
+PyObject* VSPAxisProjPnt01Array( const std::string &geom_id, int surf_indx, int iaxis, PyObject* pnts )
+{
+    PyArrayObject *p_arr;
+    PyObject *uo = NULL, *wo = NULL, *d = NULL;
+
+    int n = VSPPntArray( pnts, &p_arr );
+    if ( n >= 0 && ( uo = VSPNewDoubleArray( n, 1 ) ) && ( wo = VSPNewDoubleArray( n, 1 ) ) && ( d = VSPNewDoubleArray( n, 1 ) ) )
+    {
+        const double *p = (const double*) PyArray_DATA( p_arr );
+        double *up = (double*) PyArray_DATA( (PyArrayObject*) uo );
+        double *wp = (double*) PyArray_DATA( (PyArrayObject*) wo );
+        double *dp = (double*) PyArray_DATA( (PyArrayObject*) d );
+
+        Py_BEGIN_ALLOW_THREADS
+        vsp::AxisProjPnt01Array( geom_id, surf_indx, iaxis, p, n, up, wp, dp );
+        Py_END_ALLOW_THREADS
+    }
+
+    Py_XDECREF( p_arr );
+
+    if ( !d )
+    {
+        Py_XDECREF( uo );
+        Py_XDECREF( wo );
+        return NULL;
+    }
+    return Py_BuildValue( "(NNN)", uo, wo, d );
+}
+%}
+
+/* Results as numpy arrays.  The result buffers are contiguous, so each is copied with a single memcpy rather than
+   converted element by element into a tuple.  A copy is returned, not a view, because the results may be deleted by a
+   later API call while the array is still alive. */
+%nothread GetIntResultsArray;
+%nothread GetDoubleResultsArray;
+%nothread GetVec3dResultsArray;
+%nothread GetDoubleMatResultsArray;
+
+%inline %{
+PyObject* GetIntResultsArray( const std::string &id, const std::string &name, int index = 0 )
+{
+    const std::vector < int > &vec = vsp::GetIntResults( id, name, index );
+
+    npy_intp dims[1] = { (npy_intp) vec.size() };
+    PyObject *result = PyArray_SimpleNew( 1, dims, NPY_INT );
+    if ( result && !vec.empty() )
+    {
+        memcpy( PyArray_DATA( (PyArrayObject*) result ), vec.data(), vec.size() * sizeof( int ) );
+    }
+    return result;
+}
+
+PyObject* GetDoubleResultsArray( const std::string &id, const std::string &name, int index = 0 )
+{
+    const std::vector < double > &vec = vsp::GetDoubleResults( id, name, index );
+
+    PyObject *result = VSPNewDoubleArray( (int) vec.size(), 1 );
+    if ( result && !vec.empty() )
+    {
+        memcpy( PyArray_DATA( (PyArrayObject*) result ), vec.data(), vec.size() * sizeof( double ) );
+    }
+    return result;
+}
+
+PyObject* GetVec3dResultsArray( const std::string &id, const std::string &name, int index = 0 )
+{
+    static_assert( sizeof( vec3d ) == 3 * sizeof( double ), "vec3d must be three packed doubles" );
+
+    const std::vector < vec3d > &vec = vsp::GetVec3dResults( id, name, index );
+
+    PyObject *result = VSPNewDoubleArray( (int) vec.size(), 3 );
+    if ( result && !vec.empty() )
+    {
+        memcpy( PyArray_DATA( (PyArrayObject*) result ), vec.data(), vec.size() * sizeof( vec3d ) );
+    }
+    return result;
+}
+
+PyObject* GetDoubleMatResultsArray( const std::string &id, const std::string &name, int index = 0 )
+{
+    const std::vector < std::vector < double > > &mat = vsp::GetDoubleMatResults( id, name, index );
+
+    size_t ncol = mat.empty() ? 0 : mat[0].size();
+    for ( size_t i = 0; i < mat.size(); i++ )
+    {
+        if ( mat[i].size() != ncol )
+        {
+            PyErr_SetString( PyExc_ValueError, "ragged matrix results can not be returned as an array" );
+            return NULL;
+        }
+    }
+
+    npy_intp dims[2] = { (npy_intp) mat.size(), (npy_intp) ncol };
+    PyObject *result = PyArray_ZEROS( 2, dims, NPY_DOUBLE, 0 );
+    if ( result )
+    {
+        double *data = (double*) PyArray_DATA( (PyArrayObject*) result );
+        for ( size_t i = 0; i < mat.size(); i++ )
+        {
+            memcpy( data + i * ncol, mat[i].data(), ncol * sizeof( double ) );
+        }
+    }
+    return result;
+}
+%}
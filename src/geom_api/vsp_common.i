@@ -57,6 +57,13 @@ namespace std {
 %apply ( std::vector<double> &OUTPUT ) { std::vector < double > &m_out_vec };
 %apply ( std::vector<double> &OUTPUT ) { std::vector < double > &n_out_vec };
 
+/* Raw buffer surface queries.  Python gets numpy wrappers of the same names from numpy.i */
+%ignore vsp::CompPnt01Array;
+%ignore vsp::CompNorm01Array;
+%ignore vsp::CompCurvature01Array;
+%ignore vsp::ProjPnt01Array;
+%ignore vsp::AxisProjPnt01Array;
+
 /* Let's just grab the original header file here */
 %include "APIDefines.h"
 %include "APIErrorMgr.h"
@@ -9,10 +9,12 @@
 #include "ScriptMgr.h"
 #include "AdvLink.h"
 #include "AdvLinkMgr.h"
+#include "LinkMgr.h"
 #include "ParmMgr.h"
 #include "APIErrorMgr.h"
 #include "StringUtil.h"
 #include "StlHelper.h"
+#include "VSP_Geom_API.h"
 
 #ifndef NOREGEXP
 #include <regex>
@@ -49,12 +51,24 @@ xmlNodePtr VarDef::DecodeXml( xmlNodePtr & var_node )
 AdvLink::AdvLink()
 {
     m_ValidScript = false;
+    m_UpdateFunc = nullptr;
+    m_NumExprRuns = 0;
 }
 
 //==== Destructor ====//
 AdvLink::~AdvLink()
 {
+    ReleaseUpdateFunc();
+}
 
+//==== Drop Cached Script Function ====//
+void AdvLink::ReleaseUpdateFunc()
+{
+    if ( m_UpdateFunc )
+    {
+        m_UpdateFunc->Release();
+        m_UpdateFunc = nullptr;
+    }
 }
 
 bool AdvLink::ValidateParms()
@@ -181,6 +195,7 @@ void AdvLink::AddVar( const VarDef & pd, bool input_flag )
     else
         m_OutputVars.push_back( pd );
 
+    LinkMgr.InvalidateLinkGraph();
 }
 
 void AdvLink::DeleteVar( int index, bool input_flag )
@@ -193,6 +208,8 @@ void AdvLink::DeleteVar( int index, bool input_flag )
     {
         m_OutputVars.erase( m_OutputVars.begin() + index );
     }
+
+    LinkMgr.InvalidateLinkGraph();
 }
 
 void AdvLink::DeleteAllVars( bool input_flag )
@@ -205,6 +222,8 @@ void AdvLink::DeleteAllVars( bool input_flag )
     {
         m_OutputVars.clear();
     }
+
+    LinkMgr.InvalidateLinkGraph();
 }
 
 void AdvLink::UpdateInputVarName( int index, const string & var_name, bool changeincode )
@@ -408,49 +427,88 @@ void AdvLink::SetVar( const string & var_name, double val )
     {
         if ( m_OutputVars[i].m_VarName == var_name )
         {
-            Parm* parm_ptr = ParmMgr.FindParm(  m_OutputVars[i].m_ParmID );
-            if ( parm_ptr && val > -1.0e15 && !parm_ptr->GetLinkUpdateFlag() )
-            {
-                parm_ptr->SetFromLink( val );
-            }
-            else if ( parm_ptr && val <= -1.0e15)
-            {
-                MessageData errMsgData;
-                errMsgData.m_String = "Error";
-
-                errMsgData.m_IntVec.push_back( vsp::VSP_LINK_OUTPUT_NOT_ASSIGNED );
-                char buf[255];
-                snprintf( buf, sizeof( buf ), "Warning: Advanced link output variable '%s' (%s, %s) not set.\n", var_name.c_str(), parm_ptr->GetName().c_str(), parm_ptr->GetID().c_str() );
-                errMsgData.m_StringVec.emplace_back( string( buf ) );
-                MessageMgr::getInstance().SendAll( errMsgData );
-            }
-            else if ( parm_ptr )
-            {
-                MessageData errMsgData;
-                errMsgData.m_String = "Error";
-
-                errMsgData.m_IntVec.push_back( vsp::VSP_LINK_LOOP_DETECTED );
-                char buf[255];
-                snprintf( buf, sizeof( buf ), "Warning: Updating advanced link output variable '%s' (%s, %s) would initiate a link loop.  Stopping.\n", var_name.c_str(), parm_ptr->GetName().c_str(), parm_ptr->GetID().c_str() );
-                errMsgData.m_StringVec.emplace_back( string( buf ) );
-                MessageMgr::getInstance().SendAll( errMsgData );
-            }
-            else
-            {
-                MessageData errMsgData;
-                errMsgData.m_String = "Error";
-
-                errMsgData.m_IntVec.push_back( vsp::VSP_CANT_FIND_PARM );
-                char buf[255];
-                snprintf( buf, sizeof( buf ), "Error: Advanced link output variable '%s' not found.\n", var_name.c_str() );
-                errMsgData.m_StringVec.emplace_back( string( buf ) );
-                MessageMgr::getInstance().SendAll( errMsgData );
-            }
+            SetOutputVar( i, val );
             break;
         }
     }
 }
 
+//==== Set Output Parm From Var Value ====//
+void AdvLink::SetOutputVar( int index, double val )
+{
+    Parm* parm_ptr = ParmMgr.FindParm(  m_OutputVars[index].m_ParmID );
+    if ( parm_ptr && val > -1.0e15 && !parm_ptr->GetLinkUpdateFlag() )
+    {
+        parm_ptr->SetFromLink( val );
+    }
+    else if ( parm_ptr && val <= -1.0e15)
+    {
+        MessageData errMsgData;
+        errMsgData.m_String = "Error";
+
+        errMsgData.m_IntVec.push_back( vsp::VSP_LINK_OUTPUT_NOT_ASSIGNED );
+        char buf[255];
+        snprintf( buf, sizeof( buf ), "Warning: Advanced link output variable '%s' (%s, %s) not set.\n", m_OutputVars[index].m_VarName.c_str(), parm_ptr->GetName().c_str(), parm_ptr->GetID().c_str() );
+        errMsgData.m_StringVec.emplace_back( string( buf ) );
+        MessageMgr::getInstance().SendAll( errMsgData );
+    }
+    else if ( parm_ptr )
+    {
+        MessageData errMsgData;
+        errMsgData.m_String = "Error";
+
+        errMsgData.m_IntVec.push_back( vsp::VSP_LINK_LOOP_DETECTED );
+        char buf[255];
+        snprintf( buf, sizeof( buf ), "Warning: Updating advanced link output variable '%s' (%s, %s) would initiate a link loop.  Stopping.\n", m_OutputVars[index].m_VarName.c_str(), parm_ptr->GetName().c_str(), parm_ptr->GetID().c_str() );
+        errMsgData.m_StringVec.emplace_back( string( buf ) );
+        MessageMgr::getInstance().SendAll( errMsgData );
+    }
+    else
+    {
+        MessageData errMsgData;
+        errMsgData.m_String = "Error";
+
+        errMsgData.m_IntVec.push_back( vsp::VSP_CANT_FIND_PARM );
+        char buf[255];
+        snprintf( buf, sizeof( buf ), "Error: Advanced link output variable '%s' not found.\n", m_OutputVars[index].m_VarName.c_str() );
+        errMsgData.m_StringVec.emplace_back( string( buf ) );
+        MessageMgr::getInstance().SendAll( errMsgData );
+    }
+}
+
+void AdvLink::SetVar( int slot, double val )
+{
+    if ( slot < 0 || slot >= (int)m_OutputSlotNames.size() )
+        return;
+
+    //==== Vars Unchanged Since Build - Go Straight To The Slot ====//
+    if ( slot < (int)m_OutputVars.size() && m_OutputVars[slot].m_VarName == m_OutputSlotNames[slot] )
+    {
+        SetOutputVar( slot, val );
+    }
+    else
+    {
+        SetVar( m_OutputSlotNames[slot], val );
+    }
+}
+
+double AdvLink::GetVar( int slot )
+{
+    if ( slot < 0 || slot >= (int)m_InputSlotNames.size() )
+        return 0.0;
+
+    //==== Vars Unchanged Since Build - Go Straight To The Slot ====//
+    if ( slot < (int)m_InputVars.size() && m_InputVars[slot].m_VarName == m_InputSlotNames[slot] )
+    {
+        Parm* parm_ptr = ParmMgr.FindParm( m_InputVars[slot].m_ParmID );
+        if ( parm_ptr )
+        {
+            return parm_ptr->Get();
+        }
+    }
+    return GetVar( m_InputSlotNames[slot] );
+}
+
 double AdvLink::GetVar( const string & var_name )
 {
     //==== Look For Var ====//
@@ -473,6 +531,8 @@ bool AdvLink::BuildScript()
     string script;
 
     m_ValidScript = false;
+    ReleaseUpdateFunc();
+    m_Expr.Clear();
 
     //==== Write Comment ====//
     string comment;
@@ -495,7 +555,7 @@ bool AdvLink::BuildScript()
     script.append( "\nvoid LoadInput()\n{\n" );
     for ( int i = 0 ; i < (int)m_InputVars.size() ; i++ )
     {
-        string idef = "   " + m_InputVars[i].m_VarName + " = GetVar( \"" + m_InputVars[i].m_VarName + "\" );\n";
+        string idef = "   " + m_InputVars[i].m_VarName + " = GetVarSlot( " + to_string( i ) + " );\n";
         script.append( idef );
     }
     script.append( "}\n\n" );
@@ -504,7 +564,7 @@ bool AdvLink::BuildScript()
     script.append( "void LoadOutput()\n{\n" );
     for ( int i = 0 ; i < (int)m_OutputVars.size() ; i++ )
     {
-        string idef = "   SetVar( \"" + m_OutputVars[i].m_VarName + "\", " + m_OutputVars[i].m_VarName + " );\n";
+        string idef = "   SetVarSlot( " + to_string( i ) + ", " + m_OutputVars[i].m_VarName + " );\n";
         script.append( idef );
     }
     script.append( "}\n\n" );
@@ -549,6 +609,17 @@ bool AdvLink::BuildScript()
         return false;
     }
 
+    //==== Bind Vars To Slots And Cache The Compiled Function ====//
+    m_InputSlotNames = GetInputNames();
+    m_OutputSlotNames = GetOutputNames();
+    m_UpdateFunc = ScriptMgr.FindFunction( m_ScriptModule, "void UpdateLink()" );
+
+    m_Expr.Compile( m_ScriptCode, m_InputSlotNames, m_OutputSlotNames );
+
+    //==== Outputs Start Unassigned, As The Module's Globals Do ====//
+    m_ExprOutVals.assign( m_OutputSlotNames.size(), -1.0e15 );
+    m_NumExprRuns = 0;
+
     m_ValidScript = true;
     return true;
 }
@@ -571,10 +642,7 @@ bool AdvLink::UpdateLink( const string & pid )
     if ( !run_link )
         return false;
 
-    AdvLinkMgr.SetActiveLink( this );
-
-    //==== Call Script ====//
-    ScriptMgr.ExecuteScript( m_ScriptModule.c_str(), "void UpdateLink()" );
+    ForceUpdate();
 
     return true;
 }
@@ -583,8 +651,49 @@ void AdvLink::ForceUpdate()
 {
     AdvLinkMgr.SetActiveLink( this );
 
+    //==== Simple Arithmetic - Skip The Script Engine ====//
+    if ( m_Expr.IsValid() )
+    {
+        RunExpr();
+        return;
+    }
+
     //==== Call Script ====//
-    ScriptMgr.ExecuteScript( m_ScriptModule.c_str(), "void UpdateLink()" );
+    if ( m_UpdateFunc )
+    {
+        ScriptMgr.ExecuteFunction( m_UpdateFunc );
+    }
+    else
+    {
+        ScriptMgr.ExecuteScript( m_ScriptModule.c_str(), "void UpdateLink()" );
+    }
+}
+
+//==== Same Steps As The Generated UpdateLink() Script ====//
+// Output values carry over from the last run, as the script's globals do, so
+// code that reads an output before assigning it sees the same value either way.
+void AdvLink::RunExpr()
+{
+    m_NumExprRuns++;
+
+    vector< double > in_vals( m_InputSlotNames.size() );
+    for ( int i = 0 ; i < (int)in_vals.size() ; i++ )
+    {
+        in_vals[i] = GetVar( i );
+    }
+
+    if ( !m_Expr.Eval( in_vals, m_ExprOutVals ) )
+    {
+        printf( "An exception 'Divide by zero' occurred \n" );
+        return;
+    }
+
+    for ( int i = 0 ; i < (int)m_ExprOutVals.size() ; i++ )
+    {
+        SetVar( i, m_ExprOutVals[i] );
+    }
+
+    vsp::Update();
 }
 
 vector< string > AdvLink::GetInputNames()
@@ -734,3 +843,470 @@ void AdvLink::SearchReplaceCode( const string & from, const string & to )
     m_ScriptCode = regex_replace( m_ScriptCode, regex( "([^\\w]|^)" + from + "([^\\w]|$)" ), "$1" + to + "$2" );
 #endif
 }
+
+//=====================================================================================//
+//=====================================================================================//
+//=====================================================================================//
+
+//==== Math Functions Available To The Fast Path - Same Set As scriptmath ====//
+typedef double ( *ExprFunc1 )( double );
+typedef double ( *ExprFunc2 )( double, double );
+
+static double ExprCos( double x )       { return cos( x ); }
+static double ExprSin( double x )       { return sin( x ); }
+static double ExprTan( double x )       { return tan( x ); }
+static double ExprAcos( double x )      { return acos( x ); }
+static double ExprAsin( double x )      { return asin( x ); }
+static double ExprAtan( double x )      { return atan( x ); }
+static double ExprCosh( double x )      { return cosh( x ); }
+static double ExprSinh( double x )      { return sinh( x ); }
+static double ExprTanh( double x )      { return tanh( x ); }
+static double ExprLog( double x )       { return log( x ); }
+static double ExprLog10( double x )     { return log10( x ); }
+static double ExprSqrt( double x )      { return sqrt( x ); }
+static double ExprCeil( double x )      { return ceil( x ); }
+static double ExprAbs( double x )       { return fabs( x ); }
+static double ExprFloor( double x )     { return floor( x ); }
+
+static double ExprAtan2( double y, double x )   { return atan2( y, x ); }
+static double ExprPow( double x, double y )     { return pow( x, y ); }
+
+static const char* s_ExprFunc1Names[] = { "cos", "sin", "tan", "acos", "asin", "atan", "cosh", "sinh", "tanh",
+                                          "log", "log10", "sqrt", "ceil", "abs", "floor" };
+static const ExprFunc1 s_ExprFunc1Ptrs[] = { ExprCos, ExprSin, ExprTan, ExprAcos, ExprAsin, ExprAtan, ExprCosh, ExprSinh, ExprTanh,
+                                             ExprLog, ExprLog10, ExprSqrt, ExprCeil, ExprAbs, ExprFloor };
+static const int s_NumExprFunc1 = 15;
+
+static const char* s_ExprFunc2Names[] = { "atan2", "pow" };
+static const ExprFunc2 s_ExprFunc2Ptrs[] = { ExprAtan2, ExprPow };
+static const int s_NumExprFunc2 = 2;
+
+#define ADV_LINK_EXPR_MAX_DEPTH 64
+
+//==== Constructor ====//
+AdvLinkExpr::AdvLinkExpr()
+{
+    Clear();
+}
+
+void AdvLinkExpr::Clear()
+{
+    m_Valid = false;
+    m_OpVec.clear();
+    m_MaxDepth = 0;
+    m_Depth = 0;
+    m_Code.clear();
+    m_Pos = 0;
+    m_TokType = TOK_END;
+    m_TokVal = 0.0;
+    m_TokInt = false;
+}
+
+void AdvLinkExpr::AddOp( int type, int index, double val )
+{
+    ExprOp op;
+    op.m_Type = type;
+    op.m_Index = index;
+    op.m_Val = val;
+    m_OpVec.push_back( op );
+
+    //==== Track Stack Depth ====//
+    if ( type == OP_CONST || type == OP_INPUT || type == OP_OUTPUT )
+    {
+        m_Depth++;
+    }
+    else if ( type == OP_ADD || type == OP_SUB || type == OP_MUL || type == OP_DIV || type == OP_FUNC2 || type == OP_STORE )
+    {
+        m_Depth--;
+    }
+    m_MaxDepth = std::max( m_MaxDepth, m_Depth );
+}
+
+//==== Compile Link Code - Returns False If The Code Needs AngelScript ====//
+bool AdvLinkExpr::Compile( const string & code, const vector< string > & in_names, const vector< string > & out_names )
+{
+    Clear();
+
+    m_Code = code;
+    m_InNames = in_names;
+    m_OutNames = out_names;
+
+    bool ok = NextToken();
+    int num_statements = 0;
+    while ( ok && m_TokType != TOK_END )
+    {
+        ok = ParseStatement();
+        num_statements++;
+    }
+
+    m_Valid = ok && num_statements > 0 && m_MaxDepth <= ADV_LINK_EXPR_MAX_DEPTH;
+
+    if ( !m_Valid )
+    {
+        m_OpVec.clear();
+    }
+
+    //==== Parse State No Longer Needed ====//
+    m_Code.clear();
+    m_InNames.clear();
+    m_OutNames.clear();
+
+    return m_Valid;
+}
+
+//==== Read Next Token - Skips White Space And Comments ====//
+bool AdvLinkExpr::NextToken()
+{
+    m_TokText.clear();
+
+    while ( m_Pos < m_Code.size() )
+    {
+        char c = m_Code[ m_Pos ];
+        if ( isspace( ( unsigned char ) c ) )
+        {
+            m_Pos++;
+        }
+        else if ( m_Code.compare( m_Pos, 2, "//" ) == 0 )
+        {
+            size_t end = m_Code.find( '\n', m_Pos );
+            m_Pos = ( end == string::npos ) ? m_Code.size() : end;
+        }
+        else if ( m_Code.compare( m_Pos, 2, "/*" ) == 0 )
+        {
+            size_t end = m_Code.find( "*/", m_Pos + 2 );
+            if ( end == string::npos )
+            {
+                m_TokType = TOK_BAD;
+                return false;
+            }
+            m_Pos = end + 2;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if ( m_Pos >= m_Code.size() )
+    {
+        m_TokType = TOK_END;
+        return true;
+    }
+
+    char c = m_Code[ m_Pos ];
+    size_t start = m_Pos;
+
+    if ( isdigit( ( unsigned char ) c ) )
+    {
+        //==== Number - Int Unless It Has A Decimal Point Or Exponent ====//
+        m_TokInt = true;
+        while ( m_Pos < m_Code.size() && isdigit( ( unsigned char ) m_Code[ m_Pos ] ) )
+            m_Pos++;
+
+        if ( m_Pos < m_Code.size() && m_Code[ m_Pos ] == '.' )
+        {
+            m_TokInt = false;
+            m_Pos++;
+            while ( m_Pos < m_Code.size() && isdigit( ( unsigned char ) m_Code[ m_Pos ] ) )
+                m_Pos++;
+        }
+
+        if ( m_Pos < m_Code.size() && ( m_Code[ m_Pos ] == 'e' || m_Code[ m_Pos ] == 'E' ) )
+        {
+            m_TokInt = false;
+            m_Pos++;
+            if ( m_Pos < m_Code.size() && ( m_Code[ m_Pos ] == '+' || m_Code[ m_Pos ] == '-' ) )
+                m_Pos++;
+
+            size_t exp_start = m_Pos;
+            while ( m_Pos < m_Code.size() && isdigit( ( unsigned char ) m_Code[ m_Pos ] ) )
+                m_Pos++;
+
+            if ( m_Pos == exp_start )
+            {
+                m_TokType = TOK_BAD;
+                return false;
+            }
+        }
+
+        //==== Suffixes (1.0f), Hex, Etc. Are Left To AngelScript ====//
+        if ( m_Pos < m_Code.size() && ( isalnum( ( unsigned char ) m_Code[ m_Pos ] ) || m_Code[ m_Pos ] == '_' || m_Code[ m_Pos ] == '.' ) )
+        {
+            m_TokType = TOK_BAD;
+            return false;
+        }
+
+        m_TokText = m_Code.substr( start, m_Pos - start );
+        m_TokVal = atof( m_TokText.c_str() );
+
+        if ( m_TokInt && m_TokVal > INT_MAX )
+        {
+            m_TokType = TOK_BAD;
+            return false;
+        }
+
+        m_TokType = TOK_NUM;
+        return true;
+    }
+
+    if ( isalpha( ( unsigned char ) c ) || c == '_' )
+    {
+        while ( m_Pos < m_Code.size() && ( isalnum( ( unsigned char ) m_Code[ m_Pos ] ) || m_Code[ m_Pos ] == '_' ) )
+            m_Pos++;
+
+        m_TokText = m_Code.substr( start, m_Pos - start );
+        m_TokType = TOK_NAME;
+        return true;
+    }
+
+    if ( strchr( "+-*/(),=;", c ) )
+    {
+        m_Pos++;
+        m_TokText = string( 1, c );
+        m_TokType = TOK_CHAR;
+        return true;
+    }
+
+    m_TokType = TOK_BAD;
+    return false;
+}
+
+//==== out = expr; ====//
+bool AdvLinkExpr::ParseStatement()
+{
+    if ( m_TokType != TOK_NAME )
+        return false;
+
+    int out_index = vector_find_val( m_OutNames, m_TokText );
+    if ( out_index < 0 )
+        return false;
+
+    if ( !NextToken() || !IsChar( '=' ) )
+        return false;
+
+    if ( !NextToken() )
+        return false;
+
+    bool int_flag;
+    if ( !ParseExpr( int_flag ) )
+        return false;
+
+    if ( !IsChar( ';' ) )
+        return false;
+
+    AddOp( OP_STORE, out_index );
+
+    return NextToken();
+}
+
+//==== term { +- term } ====//
+bool AdvLinkExpr::ParseExpr( bool & int_flag )
+{
+    if ( !ParseTerm( int_flag ) )
+        return false;
+
+    while ( IsChar( '+' ) || IsChar( '-' ) )
+    {
+        int type = IsChar( '+' ) ? OP_ADD : OP_SUB;
+
+        bool rhs_int;
+        if ( !NextToken() || !ParseTerm( rhs_int ) )
+            return false;
+
+        //==== Integer Arithmetic Follows Different Rules - Leave To AngelScript ====//
+        if ( int_flag && rhs_int )
+            return false;
+
+        AddOp( type );
+        int_flag = false;
+    }
+    return true;
+}
+
+//==== unary { */ unary } ====//
+bool AdvLinkExpr::ParseTerm( bool & int_flag )
+{
+    if ( !ParseUnary( int_flag ) )
+        return false;
+
+    while ( IsChar( '*' ) || IsChar( '/' ) )
+    {
+        int type = IsChar( '*' ) ? OP_MUL : OP_DIV;
+
+        bool rhs_int;
+        if ( !NextToken() || !ParseUnary( rhs_int ) )
+            return false;
+
+        if ( int_flag && rhs_int )
+            return false;
+
+        AddOp( type );
+        int_flag = false;
+    }
+    return true;
+}
+
+//==== { +- } primary ====//
+bool AdvLinkExpr::ParseUnary( bool & int_flag )
+{
+    if ( IsChar( '-' ) )
+    {
+        if ( !NextToken() || !ParseUnary( int_flag ) )
+            return false;
+
+        AddOp( OP_NEG );
+        return true;
+    }
+
+    if ( IsChar( '+' ) )
+    {
+        if ( !NextToken() )
+            return false;
+
+        return ParseUnary( int_flag );
+    }
+
+    return ParsePrimary( int_flag );
+}
+
+//==== number | var | func( expr [, expr] ) | ( expr ) ====//
+bool AdvLinkExpr::ParsePrimary( bool & int_flag )
+{
+    if ( m_TokType == TOK_NUM )
+    {
+        AddOp( OP_CONST, 0, m_TokVal );
+        int_flag = m_TokInt;
+        return NextToken();
+    }
+
+    if ( IsChar( '(' ) )
+    {
+        if ( !NextToken() || !ParseExpr( int_flag ) || !IsChar( ')' ) )
+            return false;
+
+        return NextToken();
+    }
+
+    if ( m_TokType != TOK_NAME )
+        return false;
+
+    string name = m_TokText;
+    int_flag = false;
+
+    if ( !NextToken() )
+        return false;
+
+    //==== Function Call ====//
+    if ( IsChar( '(' ) )
+    {
+        bool arg_int;
+        if ( !NextToken() || !ParseExpr( arg_int ) )
+            return false;
+
+        if ( IsChar( ',' ) )
+        {
+            int findex = -1;
+            for ( int i = 0 ; i < s_NumExprFunc2 ; i++ )
+            {
+                if ( name == s_ExprFunc2Names[i] )
+                    findex = i;
+            }
+
+            if ( findex < 0 || !NextToken() || !ParseExpr( arg_int ) || !IsChar( ')' ) )
+                return false;
+
+            AddOp( OP_FUNC2, findex );
+        }
+        else
+        {
+            int findex = -1;
+            for ( int i = 0 ; i < s_NumExprFunc1 ; i++ )
+            {
+                if ( name == s_ExprFunc1Names[i] )
+                    findex = i;
+            }
+
+            if ( findex < 0 || !IsChar( ')' ) )
+                return false;
+
+            AddOp( OP_FUNC1, findex );
+        }
+
+        return NextToken();
+    }
+
+    //==== Variable ====//
+    int index = vector_find_val( m_InNames, name );
+    if ( index >= 0 )
+    {
+        AddOp( OP_INPUT, index );
+        return true;
+    }
+
+    index = vector_find_val( m_OutNames, name );
+    if ( index >= 0 )
+    {
+        AddOp( OP_OUTPUT, index );
+        return true;
+    }
+
+    return false;
+}
+
+//==== Run The Compiled Code ====//
+bool AdvLinkExpr::Eval( const vector< double > & in_vals, vector< double > & out_vals ) const
+{
+    double stack[ ADV_LINK_EXPR_MAX_DEPTH ];
+    int top = -1;
+
+    for ( int i = 0 ; i < (int)m_OpVec.size() ; i++ )
+    {
+        const ExprOp & op = m_OpVec[i];
+        switch ( op.m_Type )
+        {
+        case OP_CONST:
+            stack[ ++top ] = op.m_Val;
+            break;
+        case OP_INPUT:
+            stack[ ++top ] = in_vals[ op.m_Index ];
+            break;
+        case OP_OUTPUT:
+            stack[ ++top ] = out_vals[ op.m_Index ];
+            break;
+        case OP_ADD:
+            top--;
+            stack[ top ] += stack[ top + 1 ];
+            break;
+        case OP_SUB:
+            top--;
+            stack[ top ] -= stack[ top + 1 ];
+            break;
+        case OP_MUL:
+            top--;
+            stack[ top ] *= stack[ top + 1 ];
+            break;
+        case OP_DIV:
+            top--;
+            if ( stack[ top + 1 ] == 0.0 )
+            {
+                return false;
+            }
+            stack[ top ] /= stack[ top + 1 ];
+            break;
+        case OP_NEG:
+            stack[ top ] = -stack[ top ];
+            break;
+        case OP_FUNC1:
+            stack[ top ] = s_ExprFunc1Ptrs[ op.m_Index ]( stack[ top ] );
+            break;
+        case OP_FUNC2:
+            top--;
+            stack[ top ] = s_ExprFunc2Ptrs[ op.m_Index ]( stack[ top ], stack[ top + 1 ] );
+            break;
+        case OP_STORE:
+            out_vals[ op.m_Index ] = stack[ top-- ];
+            break;
+        }
+    }
+    return true;
+}
@@ -21,6 +21,8 @@
 
 using std::string;
 
+class asIScriptFunction;
+
 class VarDef
 {
 public:
@@ -40,6 +42,65 @@ public:
 //=====================================================================================//
 //=====================================================================================//
 
+//==== Simple Arithmetic Link Code Compiled To A Small Stack Program ====//
+//
+// Handles straight line code of the form "out = expr;" built from numbers, input and
+// output vars, + - * /, parentheses and the scriptmath functions.  Anything else fails
+// to compile and the link runs through AngelScript as before.
+//
+class AdvLinkExpr
+{
+public:
+    AdvLinkExpr();
+
+    void Clear();
+    bool Compile( const string & code, const vector< string > & in_names, const vector< string > & out_names );
+    bool IsValid() const                                            { return m_Valid; }
+
+    //==== Returns False On Divide By Zero, Like The Script Would ====//
+    bool Eval( const vector< double > & in_vals, vector< double > & out_vals ) const;
+
+protected:
+
+    enum { OP_CONST, OP_INPUT, OP_OUTPUT, OP_ADD, OP_SUB, OP_MUL, OP_DIV, OP_NEG, OP_FUNC1, OP_FUNC2, OP_STORE };
+    enum { TOK_END, TOK_NUM, TOK_NAME, TOK_CHAR, TOK_BAD };
+
+    struct ExprOp
+    {
+        int m_Type;
+        int m_Index;
+        double m_Val;
+    };
+
+    bool NextToken();
+    bool ParseStatement();
+    bool ParseExpr( bool & int_flag );
+    bool ParseTerm( bool & int_flag );
+    bool ParseUnary( bool & int_flag );
+    bool ParsePrimary( bool & int_flag );
+    bool IsChar( char c ) const                                     { return m_TokType == TOK_CHAR && m_TokText[0] == c; }
+    void AddOp( int type, int index = 0, double val = 0.0 );
+
+    bool m_Valid;
+    vector< ExprOp > m_OpVec;
+    int m_MaxDepth;
+    int m_Depth;
+
+    //==== Parse State ====//
+    string m_Code;
+    size_t m_Pos;
+    int m_TokType;
+    string m_TokText;
+    double m_TokVal;
+    bool m_TokInt;
+    vector< string > m_InNames;
+    vector< string > m_OutNames;
+};
+
+//=====================================================================================//
+//=====================================================================================//
+//=====================================================================================//
+
 //==== Advanced Link ====//
 class AdvLink
 {
@@ -85,9 +146,16 @@ public:
     void SetVar( const string & var_name, double val );
     double GetVar( const string & var_name );
 
+    //==== Slots Are The Var Indices When The Script Was Built ====//
+    void SetVar( int slot, double val );
+    double GetVar( int slot );
+
     bool UpdateLink( const string & pid );
     void ForceUpdate();
 
+    //==== Runs Done Without The Script Engine Since The Last Build ====//
+    int GetNumExprRuns()                                            { return m_NumExprRuns; }
+
     vector< VarDef > GetInputVars()                               { return m_InputVars; }
     vector< VarDef > GetOutputVars()                              { return m_OutputVars; }
 
@@ -129,7 +197,18 @@ protected:
 
     bool m_ValidScript;
     string m_ScriptErrors;
-     
+
+    asIScriptFunction* m_UpdateFunc;        // Cached UpdateLink(), Holds A Reference
+    vector< string > m_InputSlotNames;      // Var Names Bound To Slots At Build
+    vector< string > m_OutputSlotNames;
+    AdvLinkExpr m_Expr;                     // Fast Path For Simple Arithmetic Code
+    vector< double > m_ExprOutVals;         // Kept Between Runs Like The Script's Output Globals
+    int m_NumExprRuns;
+
+    void SetOutputVar( int index, double val );
+    void ReleaseUpdateFunc();
+    void RunExpr();
+
 private:
 
     //==== Cannot Copy Link Because Of Parm Registration With ParmMgr ====//
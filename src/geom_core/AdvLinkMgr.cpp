@@ -8,6 +8,7 @@
 //////////////////////////////////////////////////////////////////////
 
 #include "AdvLinkMgr.h"
+#include "LinkMgr.h"
 #include "ParmMgr.h"
 #include "StringUtil.h"
 #include "StlHelper.h"
@@ -38,6 +39,8 @@ void AdvLinkMgrSingleton::Wype()
     m_LinkVec.clear();
     m_ActiveLink = nullptr;
     m_EditLinkIndex = 0;
+
+    LinkMgr.InvalidateLinkGraph();
 }
 
 void AdvLinkMgrSingleton::Renew()
@@ -82,6 +85,8 @@ AdvLink* AdvLinkMgrSingleton::AddLink( const string & name )
 
     AttributeMgr.RegisterCollID( m_LinkVec.back()->GetAttrCollection()->GetID(), m_LinkVec.back()->GetAttrCollection() );
 
+    LinkMgr.InvalidateLinkGraph();
+
     return alink;
 }
 
@@ -102,6 +107,8 @@ void AdvLinkMgrSingleton::DelLink( AdvLink* link_ptr )
     AttributeMgr.DeregisterCollID( link_ptr->GetAttrCollection()->GetID() );
 
     delete link_ptr;
+
+    LinkMgr.InvalidateLinkGraph();
 }
 
 void AdvLinkMgrSingleton::DelLink( int index )
@@ -122,6 +129,8 @@ void AdvLinkMgrSingleton::DelAllLinks( )
         delete m_LinkVec[i];
     }
     m_LinkVec.clear();
+
+    LinkMgr.InvalidateLinkGraph();
 }
 
 void AdvLinkMgrSingleton::CheckLinks()
@@ -217,6 +226,22 @@ double AdvLinkMgrSingleton::GetVar( const string & var_name )
     return m_ActiveLink->GetVar( var_name );
 }
 
+void AdvLinkMgrSingleton::SetVarSlot( int slot, double val )
+{
+    if ( !m_ActiveLink )
+        return;
+
+    m_ActiveLink->SetVar( slot, val );
+}
+
+double AdvLinkMgrSingleton::GetVarSlot( int slot )
+{
+    if ( !m_ActiveLink )
+        return 0.0;
+
+    return m_ActiveLink->GetVar( slot );
+}
+
 bool AdvLinkMgrSingleton::IsInputParm( const string& pid )
 {
     for ( int i = 0 ; i < (int)m_LinkVec.size() ; i++ )
@@ -315,5 +340,7 @@ xmlNodePtr AdvLinkMgrSingleton::DecodeXml( xmlNodePtr & node )
         }
     }
 
+    LinkMgr.InvalidateLinkGraph();
+
     return linkmgr_node;
 }
@@ -45,6 +45,8 @@ public:
 
     void SetVar( const string & var_name, double val );
     double GetVar( const string & var_name );
+    void SetVarSlot( int slot, double val );
+    double GetVarSlot( int slot );
 
     bool IsInputParm( const string& pid );
     bool IsOutputParm( const string& pid );
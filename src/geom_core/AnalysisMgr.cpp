@@ -1011,6 +1011,7 @@ void DegenGeomAnalysis::SetDefaults()
     {
         m_Inputs.Add( new NameValData( "WriteCSVFlag", veh->getExportDegenGeomCsvFile(), "Flag to control whether CSV file is written." ) );
         m_Inputs.Add( new NameValData( "WriteMFileFlag", veh->getExportDegenGeomMFile(), "Flag to control whether Matlab file is written." ) );
+        m_Inputs.Add( new NameValData( "WriteBinFileFlag", veh->getExportDegenGeomBinFile(), "Flag to control whether binary file is written." ) );
         m_Inputs.Add( new NameValData( "UseModeFlag", veh->m_UseModeDegenGeomFlag(), "Flag to control whether Modes are used instead of Sets." ) );
 
     }
@@ -1026,8 +1027,10 @@ string DegenGeomAnalysis::Execute()
         int set_num = vsp::SET_ALL;
         bool write_csv_orig = veh->getExportDegenGeomCsvFile();
         bool write_mfile_orig = veh->getExportDegenGeomMFile();
+        bool write_bin_orig = veh->getExportDegenGeomBinFile();
         bool write_csv = write_csv_orig;
         bool write_mfile = write_mfile_orig;
+        bool write_bin = write_bin_orig;
         int useMode = veh->m_UseModeDegenGeomFlag();
         string modeID;
 
@@ -1047,6 +1050,11 @@ string DegenGeomAnalysis::Execute()
         {
             write_mfile = ( bool )nvd->GetInt( 0 );
         }
+        nvd = m_Inputs.FindPtr( "WriteBinFileFlag", 0 );
+        if ( nvd )
+        {
+            write_bin = ( bool )nvd->GetInt( 0 );
+        }
 
         nvd = m_Inputs.FindPtr( "UseModeFlag", 0 );
         if ( nvd )
@@ -1062,6 +1070,7 @@ string DegenGeomAnalysis::Execute()
 
         veh->setExportDegenGeomCsvFile( write_csv );
         veh->setExportDegenGeomMFile( write_mfile );
+        veh->setExportDegenGeomBinFile( write_bin );
 
         veh->CreateDegenGeom( set_num, useMode, modeID );
         veh->WriteDegenGeomFile();
@@ -1069,6 +1078,7 @@ string DegenGeomAnalysis::Execute()
 
         veh->setExportDegenGeomCsvFile( write_csv_orig );
         veh->setExportDegenGeomMFile( write_mfile_orig );
+        veh->setExportDegenGeomBinFile( write_bin_orig );
 
         res = ResultsMgr.FindLatestResultsID( "DegenGeom" );
 
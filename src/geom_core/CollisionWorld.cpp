@@ -0,0 +1,749 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// CollisionWorld.cpp: Cached triangle BVHs for interactive collision queries.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "CollisionWorld.h"
+#include "Geom.h"
+#include "TMesh.h"
+#include "Vehicle.h"
+#include "VehicleMgr.h"
+#include "tri_tri_intersect.h"
+#include "Mathematics/DistTriangle3Triangle3.h"
+#include "Mathematics/Triangle.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <unordered_map>
+
+// Triangles per BVH leaf.
+#define COLLISION_BVH_LEAF 8
+
+//==== Distance Between Two Node Boxes, 0.0 If They Overlap ====//
+static double BoxDist( const double amin[3], const double amax[3], const double bmin[3], const double bmax[3] )
+{
+    double d2 = 0.0;
+    for ( int k = 0 ; k < 3 ; k++ )
+    {
+        double gap = std::max( amin[k] - bmax[k], bmin[k] - amax[k] );
+        if ( gap > 0.0 )
+        {
+            d2 += gap * gap;
+        }
+    }
+    return sqrt( d2 );
+}
+
+static double BoxDist( const BndBox &a, const BndBox &b )
+{
+    double amin[3], amax[3], bmin[3], bmax[3];
+    for ( int k = 0 ; k < 3 ; k++ )
+    {
+        amin[k] = a.GetMin( k );
+        amax[k] = a.GetMax( k );
+        bmin[k] = b.GetMin( k );
+        bmax[k] = b.GetMax( k );
+    }
+    return BoxDist( amin, amax, bmin, bmax );
+}
+
+static bool SameMatrix( const Matrix4d &a, const Matrix4d &b )
+{
+    double ma[16], mb[16];
+    a.getMat( ma );
+    b.getMat( mb );
+    for ( int i = 0 ; i < 16 ; i++ )
+    {
+        if ( ma[i] != mb[i] )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//===============================================================================//
+//==== Collision Body ====//
+//===============================================================================//
+CollisionBody::CollisionBody()
+{
+    m_ShapeUpdateCount = -1;
+    m_RefitFlag = false;
+}
+
+void CollisionBody::Clear()
+{
+    m_GeomID.clear();
+    m_ShapeUpdateCount = -1;
+    m_RefitFlag = false;
+
+    m_RefTransMatVec.clear();
+    m_TransMatVec.clear();
+    m_RefPnts.clear();
+    m_Pnts.clear();
+    m_TriSurf.clear();
+    m_TriOrder.clear();
+    m_Nodes.clear();
+    m_BBox.Reset();
+}
+
+void CollisionBody::Build( Geom* geom_ptr )
+{
+    vector< TMesh* > tmv = geom_ptr->CreateTMeshVec( false );       // Must Delete
+
+    Build( geom_ptr, tmv );
+
+    for ( int i = 0 ; i < ( int )tmv.size() ; i++ )
+    {
+        delete tmv[i];
+    }
+}
+
+//==== Copy Triangles Of The Geom's TMeshes And Build BVH ====//
+void CollisionBody::Build( Geom* geom_ptr, const vector < TMesh* > &tmv )
+{
+    Clear();
+
+    m_GeomID = geom_ptr->GetID();
+    m_ShapeUpdateCount = geom_ptr->GetShapeUpdateCount();
+    m_RefTransMatVec = geom_ptr->GetTransMatVec();
+    m_TransMatVec = m_RefTransMatVec;
+
+    // These types build their TMeshes from data that does not follow m_TransMatVec.
+    int type = geom_ptr->GetType().m_Type;
+    m_RefitFlag = !( type == MESH_GEOM_TYPE || type == HUMAN_GEOM_TYPE || type == WIRE_FRAME_GEOM_TYPE ||
+                     type == NGON_GEOM_TYPE || type == PT_CLOUD_GEOM_TYPE );
+
+    for ( int m = 0 ; m < ( int )tmv.size() ; m++ )
+    {
+        TMesh* tm = tmv[m];
+        int isurf = tm->m_SurfNum;
+        if ( isurf < 0 || isurf >= ( int )m_RefTransMatVec.size() )
+        {
+            m_RefitFlag = false;
+        }
+
+        for ( int t = 0 ; t < ( int )tm->m_TVec.size() ; t++ )
+        {
+            TTri* tri = tm->m_TVec[t];
+            m_RefPnts.push_back( tri->m_N0->m_Pnt );
+            m_RefPnts.push_back( tri->m_N1->m_Pnt );
+            m_RefPnts.push_back( tri->m_N2->m_Pnt );
+            m_TriSurf.push_back( isurf );
+        }
+    }
+    m_Pnts = m_RefPnts;
+
+    int ntri = m_TriSurf.size();
+    m_TriOrder.resize( ntri );
+    m_TriCen.resize( ntri );
+    for ( int i = 0 ; i < ntri ; i++ )
+    {
+        m_TriOrder[i] = i;
+        m_TriCen[i] = ( m_Pnts[3 * i] + m_Pnts[3 * i + 1] + m_Pnts[3 * i + 2] ) / 3.0;
+    }
+
+    if ( ntri > 0 )
+    {
+        m_Nodes.reserve( 2 * ( ntri / COLLISION_BVH_LEAF + 1 ) );
+        BuildNode( 0, ntri );
+
+        m_BBox.Update( vec3d( m_Nodes[0].m_Min[0], m_Nodes[0].m_Min[1], m_Nodes[0].m_Min[2] ) );
+        m_BBox.Update( vec3d( m_Nodes[0].m_Max[0], m_Nodes[0].m_Max[1], m_Nodes[0].m_Max[2] ) );
+    }
+    m_TriCen.clear();
+}
+
+//==== Move Triangles Rigidly From Their Reference Placement ====//
+bool CollisionBody::Refit( Geom* geom_ptr )
+{
+    if ( !m_RefitFlag || geom_ptr->GetID() != m_GeomID || geom_ptr->GetShapeUpdateCount() != m_ShapeUpdateCount )
+    {
+        return false;
+    }
+
+    vector < Matrix4d > trans_mat_vec = geom_ptr->GetTransMatVec();
+    if ( trans_mat_vec.size() != m_RefTransMatVec.size() )
+    {
+        return false;
+    }
+
+    bool moved = false;
+    for ( int i = 0 ; i < ( int )trans_mat_vec.size() ; i++ )
+    {
+        if ( !SameMatrix( trans_mat_vec[i], m_TransMatVec[i] ) )
+        {
+            moved = true;
+            break;
+        }
+    }
+
+    if ( !moved )
+    {
+        return true;
+    }
+
+    // Always relative to the reference placement so repeated refits do not drift.
+    vector < Matrix4d > delta_vec( trans_mat_vec.size() );
+    for ( int i = 0 ; i < ( int )trans_mat_vec.size() ; i++ )
+    {
+        Matrix4d ref_inv = m_RefTransMatVec[i];
+        ref_inv.affineInverse();
+
+        delta_vec[i] = trans_mat_vec[i];
+        delta_vec[i].matMult( ref_inv );
+    }
+
+    for ( int t = 0 ; t < ( int )m_TriSurf.size() ; t++ )
+    {
+        const Matrix4d &delta = delta_vec[ m_TriSurf[t] ];
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            m_Pnts[3 * t + k] = delta.xform( m_RefPnts[3 * t + k] );
+        }
+    }
+
+    m_TransMatVec = trans_mat_vec;
+
+    RefitNodes();
+
+    m_BBox.Reset();
+    if ( !m_Nodes.empty() )
+    {
+        m_BBox.Update( vec3d( m_Nodes[0].m_Min[0], m_Nodes[0].m_Min[1], m_Nodes[0].m_Min[2] ) );
+        m_BBox.Update( vec3d( m_Nodes[0].m_Max[0], m_Nodes[0].m_Max[1], m_Nodes[0].m_Max[2] ) );
+    }
+    return true;
+}
+
+bool CollisionBody::Update( Geom* geom_ptr, bool allow_refit )
+{
+    if ( allow_refit && Refit( geom_ptr ) )
+    {
+        return false;
+    }
+
+    Build( geom_ptr );
+    return true;
+}
+
+void CollisionBody::TriBox( int tri, double bmin[3], double bmax[3] ) const
+{
+    const vec3d &p0 = m_Pnts[3 * tri];
+    const vec3d &p1 = m_Pnts[3 * tri + 1];
+    const vec3d &p2 = m_Pnts[3 * tri + 2];
+    for ( int k = 0 ; k < 3 ; k++ )
+    {
+        bmin[k] = std::min( p0[k], std::min( p1[k], p2[k] ) );
+        bmax[k] = std::max( p0[k], std::max( p1[k], p2[k] ) );
+    }
+}
+
+int CollisionBody::BuildNode( int start, int count )
+{
+    int inode = m_Nodes.size();
+    m_Nodes.push_back( BVHNode() );
+
+    BVHNode node;
+    node.m_Left = -1;
+    node.m_Right = -1;
+    node.m_Start = start;
+    node.m_Count = count;
+
+    for ( int k = 0 ; k < 3 ; k++ )
+    {
+        node.m_Min[k] = DBL_MAX;
+        node.m_Max[k] = -DBL_MAX;
+    }
+
+    if ( count > COLLISION_BVH_LEAF )
+    {
+        BndBox cbox;
+        for ( int i = start ; i < start + count ; i++ )
+        {
+            cbox.Update( m_TriCen[ m_TriOrder[i] ] );
+        }
+
+        int axis = 0;
+        for ( int k = 1 ; k < 3 ; k++ )
+        {
+            if ( cbox.GetMax( k ) - cbox.GetMin( k ) > cbox.GetMax( axis ) - cbox.GetMin( axis ) )
+            {
+                axis = k;
+            }
+        }
+
+        int half = count / 2;
+        std::nth_element( m_TriOrder.begin() + start, m_TriOrder.begin() + start + half, m_TriOrder.begin() + start + count, [&]( int a, int b )
+        {
+            return m_TriCen[a][axis] < m_TriCen[b][axis];
+        } );
+
+        node.m_Left = BuildNode( start, half );
+        node.m_Right = BuildNode( start + half, count - half );
+        node.m_Count = 0;
+
+        const BVHNode &left = m_Nodes[ node.m_Left ];
+        const BVHNode &right = m_Nodes[ node.m_Right ];
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            node.m_Min[k] = std::min( left.m_Min[k], right.m_Min[k] );
+            node.m_Max[k] = std::max( left.m_Max[k], right.m_Max[k] );
+        }
+    }
+    else
+    {
+        double bmin[3], bmax[3];
+        for ( int i = start ; i < start + count ; i++ )
+        {
+            TriBox( m_TriOrder[i], bmin, bmax );
+            for ( int k = 0 ; k < 3 ; k++ )
+            {
+                node.m_Min[k] = std::min( node.m_Min[k], bmin[k] );
+                node.m_Max[k] = std::max( node.m_Max[k], bmax[k] );
+            }
+        }
+    }
+
+    m_Nodes[inode] = node;
+    return inode;
+}
+
+//==== Recompute Node Boxes Bottom Up Keeping The Tree Structure ====//
+void CollisionBody::RefitNodes()
+{
+    // Children are always stored after their parent.
+    double bmin[3], bmax[3];
+    for ( int n = ( int )m_Nodes.size() - 1 ; n >= 0 ; n-- )
+    {
+        BVHNode &node = m_Nodes[n];
+
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            node.m_Min[k] = DBL_MAX;
+            node.m_Max[k] = -DBL_MAX;
+        }
+
+        if ( node.m_Left < 0 )
+        {
+            for ( int i = node.m_Start ; i < node.m_Start + node.m_Count ; i++ )
+            {
+                TriBox( m_TriOrder[i], bmin, bmax );
+                for ( int k = 0 ; k < 3 ; k++ )
+                {
+                    node.m_Min[k] = std::min( node.m_Min[k], bmin[k] );
+                    node.m_Max[k] = std::max( node.m_Max[k], bmax[k] );
+                }
+            }
+        }
+        else
+        {
+            const BVHNode &left = m_Nodes[ node.m_Left ];
+            const BVHNode &right = m_Nodes[ node.m_Right ];
+            for ( int k = 0 ; k < 3 ; k++ )
+            {
+                node.m_Min[k] = std::min( left.m_Min[k], right.m_Min[k] );
+                node.m_Max[k] = std::max( left.m_Max[k], right.m_Max[k] );
+            }
+        }
+    }
+}
+
+bool CollisionBody::CheckIntersect( const CollisionBody &other ) const
+{
+    if ( m_Nodes.empty() || other.m_Nodes.empty() )
+    {
+        return false;
+    }
+    return CheckIntersect( other, 0, 0 );
+}
+
+//==== Simultaneous Descent Of Both Trees, Splitting The Larger Node ====//
+bool CollisionBody::CheckIntersect( const CollisionBody &other, int n0, int n1 ) const
+{
+    const BVHNode &a = m_Nodes[n0];
+    const BVHNode &b = other.m_Nodes[n1];
+
+    for ( int k = 0 ; k < 3 ; k++ )
+    {
+        if ( a.m_Min[k] > b.m_Max[k] || b.m_Min[k] > a.m_Max[k] )
+        {
+            return false;
+        }
+    }
+
+    bool a_leaf = a.m_Left < 0;
+    bool b_leaf = b.m_Left < 0;
+
+    if ( a_leaf && b_leaf )
+    {
+        // Same test and coplanar handling as TBndBox::CheckIntersect.
+        for ( int i = a.m_Start ; i < a.m_Start + a.m_Count ; i++ )
+        {
+            int ta = m_TriOrder[i];
+            double a0[3], a1[3], a2[3];
+            for ( int k = 0 ; k < 3 ; k++ )
+            {
+                a0[k] = m_Pnts[3 * ta][k];
+                a1[k] = m_Pnts[3 * ta + 1][k];
+                a2[k] = m_Pnts[3 * ta + 2][k];
+            }
+
+            for ( int j = b.m_Start ; j < b.m_Start + b.m_Count ; j++ )
+            {
+                int tb = other.m_TriOrder[j];
+                double b0[3], b1[3], b2[3];
+                for ( int k = 0 ; k < 3 ; k++ )
+                {
+                    b0[k] = other.m_Pnts[3 * tb][k];
+                    b1[k] = other.m_Pnts[3 * tb + 1][k];
+                    b2[k] = other.m_Pnts[3 * tb + 2][k];
+                }
+
+                int coplanarFlag = 0; // Must be initialized to 0 before use in tri_tri_intersection_test_3d
+                vec3d e0, e1;
+                int iflag = tri_tri_intersection_test_3d( a0, a1, a2, b0, b1, b2, &coplanarFlag, e0.v, e1.v );
+
+                if ( iflag && !coplanarFlag )
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    double asize = ( a.m_Max[0] - a.m_Min[0] ) + ( a.m_Max[1] - a.m_Min[1] ) + ( a.m_Max[2] - a.m_Min[2] );
+    double bsize = ( b.m_Max[0] - b.m_Min[0] ) + ( b.m_Max[1] - b.m_Min[1] ) + ( b.m_Max[2] - b.m_Min[2] );
+
+    if ( b_leaf || ( !a_leaf && asize >= bsize ) )
+    {
+        return CheckIntersect( other, a.m_Left, n1 ) || CheckIntersect( other, a.m_Right, n1 );
+    }
+    return CheckIntersect( other, n0, b.m_Left ) || CheckIntersect( other, n0, b.m_Right );
+}
+
+double CollisionBody::MinDistance( const CollisionBody &other, double curr_min_dist, vec3d &p1, vec3d &p2 ) const
+{
+    if ( m_Nodes.empty() || other.m_Nodes.empty() )
+    {
+        return curr_min_dist;
+    }
+    return MinDistance( other, 0, 0, curr_min_dist, p1, p2 );
+}
+
+//==== Branch And Bound Over Node Pairs, Closer Child Pair First ====//
+double CollisionBody::MinDistance( const CollisionBody &other, int n0, int n1, double curr_min_dist, vec3d &p1, vec3d &p2 ) const
+{
+    const BVHNode &a = m_Nodes[n0];
+    const BVHNode &b = other.m_Nodes[n1];
+
+    if ( BoxDist( a.m_Min, a.m_Max, b.m_Min, b.m_Max ) >= curr_min_dist )
+    {
+        return curr_min_dist;
+    }
+
+    bool a_leaf = a.m_Left < 0;
+    bool b_leaf = b.m_Left < 0;
+
+    if ( a_leaf && b_leaf )
+    {
+        gte::DCPQuery < double, gte::Triangle3 < double >, gte::Triangle3 < double > > dcpq;
+
+        for ( int i = a.m_Start ; i < a.m_Start + a.m_Count ; i++ )
+        {
+            int ta = m_TriOrder[i];
+            gte::Vector3 < double > a0, a1, a2;
+            for ( int k = 0 ; k < 3 ; k++ )
+            {
+                a0[k] = m_Pnts[3 * ta][k];
+                a1[k] = m_Pnts[3 * ta + 1][k];
+                a2[k] = m_Pnts[3 * ta + 2][k];
+            }
+            gte::Triangle3 < double > triA( a0, a1, a2 );
+
+            for ( int j = b.m_Start ; j < b.m_Start + b.m_Count ; j++ )
+            {
+                int tb = other.m_TriOrder[j];
+                gte::Vector3 < double > b0, b1, b2;
+                for ( int k = 0 ; k < 3 ; k++ )
+                {
+                    b0[k] = other.m_Pnts[3 * tb][k];
+                    b1[k] = other.m_Pnts[3 * tb + 1][k];
+                    b2[k] = other.m_Pnts[3 * tb + 2][k];
+                }
+                gte::Triangle3 < double > triB( b0, b1, b2 );
+
+                auto result = dcpq( triA, triB );
+
+                if ( result.distance < curr_min_dist )
+                {
+                    curr_min_dist = result.distance;
+
+                    for ( int k = 0 ; k < 3 ; k++ )
+                    {
+                        p1.v[k] = result.closest[0][k];
+                        p2.v[k] = result.closest[1][k];
+                    }
+                }
+            }
+        }
+        return curr_min_dist;
+    }
+
+    double asize = ( a.m_Max[0] - a.m_Min[0] ) + ( a.m_Max[1] - a.m_Min[1] ) + ( a.m_Max[2] - a.m_Min[2] );
+    double bsize = ( b.m_Max[0] - b.m_Min[0] ) + ( b.m_Max[1] - b.m_Min[1] ) + ( b.m_Max[2] - b.m_Min[2] );
+
+    int c0[2] = { n0, n0 };
+    int c1[2] = { n1, n1 };
+    if ( b_leaf || ( !a_leaf && asize >= bsize ) )
+    {
+        c0[0] = a.m_Left;
+        c0[1] = a.m_Right;
+    }
+    else
+    {
+        c1[0] = b.m_Left;
+        c1[1] = b.m_Right;
+    }
+
+    double d[2];
+    for ( int i = 0 ; i < 2 ; i++ )
+    {
+        const BVHNode &ca = m_Nodes[ c0[i] ];
+        const BVHNode &cb = other.m_Nodes[ c1[i] ];
+        d[i] = BoxDist( ca.m_Min, ca.m_Max, cb.m_Min, cb.m_Max );
+    }
+
+    int first = ( d[1] < d[0] ) ? 1 : 0;
+    curr_min_dist = MinDistance( other, c0[first], c1[first], curr_min_dist, p1, p2 );
+    curr_min_dist = MinDistance( other, c0[1 - first], c1[1 - first], curr_min_dist, p1, p2 );
+
+    return curr_min_dist;
+}
+
+double CollisionBody::MaxDisplacement( const vector < TMesh* > &tmv ) const
+{
+    double max_d2 = 0.0;
+    int itri = 0;
+    for ( int m = 0 ; m < ( int )tmv.size() ; m++ )
+    {
+        TMesh* tm = tmv[m];
+        for ( int t = 0 ; t < ( int )tm->m_TVec.size() ; t++ )
+        {
+            if ( itri >= ( int )m_TriSurf.size() )
+            {
+                return -1.0;
+            }
+
+            TTri* tri = tm->m_TVec[t];
+            max_d2 = std::max( max_d2, dist_squared( m_Pnts[3 * itri], tri->m_N0->m_Pnt ) );
+            max_d2 = std::max( max_d2, dist_squared( m_Pnts[3 * itri + 1], tri->m_N1->m_Pnt ) );
+            max_d2 = std::max( max_d2, dist_squared( m_Pnts[3 * itri + 2], tri->m_N2->m_Pnt ) );
+            itri++;
+        }
+    }
+
+    if ( itri != ( int )m_TriSurf.size() )
+    {
+        return -1.0;
+    }
+    return sqrt( max_d2 );
+}
+
+//===============================================================================//
+//==== Collision World ====//
+//===============================================================================//
+CollisionWorld::CollisionWorld()
+{
+    m_SortAxis = 0;
+    m_NumBuilt = 0;
+    m_NumReused = 0;
+}
+
+void CollisionWorld::Clear()
+{
+    m_Bodies.clear();
+    m_SortOrder.clear();
+    m_SortAxis = 0;
+    m_NumBuilt = 0;
+    m_NumReused = 0;
+}
+
+void CollisionWorld::Update( const vector < string > &geom_vec )
+{
+    m_NumBuilt = 0;
+    m_NumReused = 0;
+
+    Vehicle* veh = VehicleMgr.GetVehicle();
+
+    std::unordered_map < string, int > body_map;
+    for ( int i = 0 ; i < ( int )m_Bodies.size() ; i++ )
+    {
+        body_map[ m_Bodies[i].GetGeomID() ] = i;
+    }
+
+    vector < CollisionBody > bodies;
+    bodies.reserve( geom_vec.size() );
+    for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
+    {
+        Geom* geom_ptr = veh->FindGeom( geom_vec[i] );
+        if ( !geom_ptr )
+        {
+            continue;
+        }
+
+        auto it = body_map.find( geom_vec[i] );
+        if ( it != body_map.end() )
+        {
+            bodies.push_back( std::move( m_Bodies[ it->second ] ) );
+        }
+        else
+        {
+            bodies.push_back( CollisionBody() );
+        }
+
+        // Trusts the shape update count, checking would tessellate every Geom.
+        if ( bodies.back().Update( geom_ptr ) )
+        {
+            m_NumBuilt++;
+        }
+        else
+        {
+            m_NumReused++;
+        }
+    }
+    m_Bodies.swap( bodies );
+
+    SortBodies();
+}
+
+//==== Sweep And Prune List Along The Axis Of Widest Body Spread ====//
+void CollisionWorld::SortBodies()
+{
+    BndBox cbox;
+    m_SortOrder.clear();
+    for ( int i = 0 ; i < ( int )m_Bodies.size() ; i++ )
+    {
+        if ( !m_Bodies[i].GetBBox().IsEmpty() )
+        {
+            cbox.Update( m_Bodies[i].GetBBox().GetCenter() );
+            m_SortOrder.push_back( i );
+        }
+    }
+
+    m_SortAxis = 0;
+    if ( !m_SortOrder.empty() )
+    {
+        for ( int k = 1 ; k < 3 ; k++ )
+        {
+            if ( cbox.GetMax( k ) - cbox.GetMin( k ) > cbox.GetMax( m_SortAxis ) - cbox.GetMin( m_SortAxis ) )
+            {
+                m_SortAxis = k;
+            }
+        }
+    }
+
+    std::sort( m_SortOrder.begin(), m_SortOrder.end(), [&]( int a, int b )
+    {
+        return m_Bodies[a].GetBBox().GetMin( m_SortAxis ) < m_Bodies[b].GetBBox().GetMin( m_SortAxis );
+    } );
+}
+
+void CollisionWorld::FindOverlaps( const BndBox &box, double tol, vector < int > &overlap ) const
+{
+    overlap.clear();
+    if ( box.IsEmpty() )
+    {
+        return;
+    }
+
+    double smin = box.GetMin( m_SortAxis ) - tol;
+    double smax = box.GetMax( m_SortAxis ) + tol;
+
+    for ( int i = 0 ; i < ( int )m_SortOrder.size() ; i++ )
+    {
+        int ibody = m_SortOrder[i];
+        const BndBox &b = m_Bodies[ ibody ].GetBBox();
+
+        // Sorted by minimum, nothing further along can overlap.
+        if ( b.GetMin( m_SortAxis ) > smax )
+        {
+            break;
+        }
+        if ( b.GetMax( m_SortAxis ) < smin )
+        {
+            continue;
+        }
+
+        bool overlap_flag = true;
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            if ( b.GetMin( k ) > box.GetMax( k ) + tol || b.GetMax( k ) < box.GetMin( k ) - tol )
+            {
+                overlap_flag = false;
+                break;
+            }
+        }
+
+        if ( overlap_flag )
+        {
+            overlap.push_back( ibody );
+        }
+    }
+}
+
+bool CollisionWorld::CheckIntersect( const CollisionBody &body ) const
+{
+    vector < int > overlap;
+    FindOverlaps( body.GetBBox(), 0.0, overlap );
+
+    for ( int i = 0 ; i < ( int )overlap.size() ; i++ )
+    {
+        if ( body.CheckIntersect( m_Bodies[ overlap[i] ] ) )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+double CollisionWorld::MinDistance( const CollisionBody &body, double max_dist, bool &intersect_flag ) const
+{
+    intersect_flag = false;
+
+    if ( CheckIntersect( body ) )
+    {
+        intersect_flag = true;
+        return 0.0;
+    }
+
+    vector < int > overlap;
+    FindOverlaps( body.GetBBox(), max_dist, overlap );
+
+    // Closest boxes first so the running minimum prunes the rest.
+    vector < std::pair < double, int > > box_dist( overlap.size() );
+    for ( int i = 0 ; i < ( int )overlap.size() ; i++ )
+    {
+        box_dist[i] = std::make_pair( BoxDist( body.GetBBox(), m_Bodies[ overlap[i] ].GetBBox() ), overlap[i] );
+    }
+    std::sort( box_dist.begin(), box_dist.end() );
+
+    double min_dist = max_dist;
+    vec3d p1, p2;
+    for ( int i = 0 ; i < ( int )box_dist.size() ; i++ )
+    {
+        if ( box_dist[i].first >= min_dist )
+        {
+            break;
+        }
+        min_dist = body.MinDistance( m_Bodies[ box_dist[i].second ], min_dist, p1, p2 );
+    }
+
+    return min_dist;
+}
@@ -0,0 +1,166 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// CollisionWorld.h: Cached triangle BVHs for interactive collision queries.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(VSPCOLLISIONWORLD__INCLUDED_)
+#define VSPCOLLISIONWORLD__INCLUDED_
+
+#include "Vec3d.h"
+#include "Matrix4d.h"
+#include "BndBox.h"
+
+#include <vector>
+#include <string>
+
+using std::string;
+using std::vector;
+
+class Geom;
+class TMesh;
+
+//==== Triangles Of One Geom In A Bounding Volume Hierarchy ====//
+// Triangles are copied from the Geom's TMeshes.  As long as the Geom's shape is
+// unchanged, transform changes move the triangles rigidly with the per-surface
+// transforms and refit the node boxes instead of tessellating again.
+class CollisionBody
+{
+public:
+    CollisionBody();
+
+    void Clear();
+
+    void Build( Geom* geom_ptr );
+    void Build( Geom* geom_ptr, const vector < TMesh* > &tmv );
+
+    // Moves the triangles to the Geom's current transforms.  Returns false if the
+    // body can not follow the Geom that way and must be built again.
+    //
+    // Whether the shape changed is decided by Geom::GetShapeUpdateCount() alone,
+    // plus the number of surfaces.  Triangles are not compared, so this relies on
+    // Geom::Update() incrementing the count whenever surfaces or tessellation
+    // change.  A Geom whose shape changes without m_SurfDirty or m_TessDirty set
+    // would be refit with stale triangles.  Callers that can afford a tessellation
+    // check the refit with MaxDisplacement(), as SnapTo does for the moving body.
+    bool Refit( Geom* geom_ptr );
+
+    // Refits when possible, else builds.  Returns true if the body was built.
+    bool Update( Geom* geom_ptr, bool allow_refit = true );
+
+    bool CheckIntersect( const CollisionBody &other ) const;
+    double MinDistance( const CollisionBody &other, double curr_min_dist, vec3d &p1, vec3d &p2 ) const;
+
+    // Largest distance between matching triangle vertices of this body and tmv,
+    // -1 if the triangles do not match.
+    double MaxDisplacement( const vector < TMesh* > &tmv ) const;
+
+    const string & GetGeomID() const
+    {
+        return m_GeomID;
+    }
+
+    const BndBox & GetBBox() const
+    {
+        return m_BBox;
+    }
+
+    int GetNumTris() const
+    {
+        return ( int )m_TriSurf.size();
+    }
+
+protected:
+
+    struct BVHNode
+    {
+        double m_Min[3];
+        double m_Max[3];
+        int m_Left;     // Child index, -1 for leaves.
+        int m_Right;
+        int m_Start;    // Range into m_TriOrder for leaves.
+        int m_Count;
+    };
+
+    int BuildNode( int start, int count );
+    void RefitNodes();
+    void TriBox( int tri, double bmin[3], double bmax[3] ) const;
+
+    bool CheckIntersect( const CollisionBody &other, int n0, int n1 ) const;
+    double MinDistance( const CollisionBody &other, int n0, int n1, double curr_min_dist, vec3d &p1, vec3d &p2 ) const;
+
+    string m_GeomID;
+    int m_ShapeUpdateCount;
+    bool m_RefitFlag;                       // Surfaces follow the Geom's m_TransMatVec.
+
+    vector < Matrix4d > m_RefTransMatVec;   // Transforms m_RefPnts were tessellated at.
+    vector < Matrix4d > m_TransMatVec;      // Transforms m_Pnts are at.
+    vector < vec3d > m_RefPnts;             // Three per triangle.
+    vector < vec3d > m_Pnts;
+    vector < int > m_TriSurf;               // Surface index of each triangle.
+
+    vector < int > m_TriOrder;
+    vector < vec3d > m_TriCen;              // Only held while building.
+    vector < BVHNode > m_Nodes;
+
+    BndBox m_BBox;
+};
+
+//==== Persistent Set Of Collision Bodies ====//
+// Bodies are kept between calls and only rebuilt when their Geom's shape changed.
+// A sweep and prune list sorted along one axis culls body pairs before the
+// triangle level queries.
+class CollisionWorld
+{
+public:
+    CollisionWorld();
+
+    void Clear();
+
+    // Brings the bodies of geom_vec up to date and drops all others.  Bodies are
+    // refit whenever their Geom's shape update count is unchanged, see
+    // CollisionBody::Refit(), and are not checked against a fresh tessellation.
+    void Update( const vector < string > &geom_vec );
+
+    bool CheckIntersect( const CollisionBody &body ) const;
+
+    // Distance from body to the closest world body.  Bodies farther than max_dist
+    // are skipped, max_dist is returned if none are closer.  Returns 0.0 and sets
+    // intersect_flag on intersection.
+    double MinDistance( const CollisionBody &body, double max_dist, bool &intersect_flag ) const;
+
+    int GetNumBodies() const
+    {
+        return ( int )m_Bodies.size();
+    }
+
+    int GetNumBuilt() const
+    {
+        return m_NumBuilt;
+    }
+
+    int GetNumReused() const
+    {
+        return m_NumReused;
+    }
+
+protected:
+
+    void SortBodies();
+
+    // Bodies whose boxes overlap box grown by tol, from the sweep and prune list.
+    void FindOverlaps( const BndBox &box, double tol, vector < int > &overlap ) const;
+
+    vector < CollisionBody > m_Bodies;
+
+    int m_SortAxis;
+    vector < int > m_SortOrder;     // m_Bodies sorted by box minimum along m_SortAxis.
+
+    int m_NumBuilt;                 // Bodies built and reused by the last Update().
+    int m_NumReused;
+};
+
+#endif
@@ -9,6 +9,11 @@
 
 #include "Vehicle.h"
 
+#include <cstdint>
+#include <functional>
+
+#define DEGEN_BIN_VERSION 1
+
 void DegenGeom::build_trans_mat( vec3d x, vec3d y, vec3d z, const vec3d &p, Matrix4d &mat, Matrix4d &invmat )
 {
     // Initialize transformation matrix as identity.
@@ -1513,6 +1518,386 @@ void DegenGeom::write_degenGeomM_file( FILE* file_id )
     }
 }
 
+//==== Binary DegenGeom File ====//
+// File:   char[8] "VSPDEGEN", uint32 version, uint32 0x01020304 byte order mark.
+// Record: char[8] kind ("COMP" or "BLANK", zero padded), uint64 bytes that follow
+//         the record header, uint32 number of fields, uint32 0.
+// Field:  uint32 name length, uint32 dtype (0 float64, 1 int32, 2 text), uint32 ndim,
+//         uint32 0, uint64 shape[ndim], name, data.
+// Names and data are zero padded to 8 bytes, so every float64 array starts aligned
+// and can be mapped without copying.  Arrays are row major, xyz last.  Field names
+// follow the Results names, grouped as "surf.x", "plate0.t", "stick1.chord", ...
+
+enum { DEGEN_BIN_FLOAT64, DEGEN_BIN_INT32, DEGEN_BIN_TEXT };
+
+static_assert( sizeof( vec3d ) == 3 * sizeof( double ), "vec3d must be three packed doubles" );
+
+struct DegenBinField
+{
+    string m_Name;
+    int m_Type;
+    vector < uint64_t > m_Shape;
+    std::function < void( FILE* ) > m_Write;     // Unpadded data.
+};
+
+static uint64_t degen_bin_pad( uint64_t n )
+{
+    return ( 8 - n % 8 ) % 8;
+}
+
+static void degen_bin_write_pad( FILE* file_id, uint64_t n )
+{
+    static const char zeros[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    while ( n > 0 )
+    {
+        uint64_t m = std::min( n, ( uint64_t ) 8 );
+        fwrite( zeros, 1, m, file_id );
+        n -= m;
+    }
+}
+
+static uint64_t degen_bin_data_size( const DegenBinField &f )
+{
+    uint64_t n = 8;
+    if ( f.m_Type == DEGEN_BIN_INT32 )
+    {
+        n = 4;
+    }
+    else if ( f.m_Type == DEGEN_BIN_TEXT )
+    {
+        n = 1;
+    }
+
+    for ( int i = 0; i < ( int )f.m_Shape.size(); i++ )
+    {
+        n *= f.m_Shape[i];
+    }
+    return n;
+}
+
+static uint64_t degen_bin_field_size( const DegenBinField &f )
+{
+    uint64_t ndata = degen_bin_data_size( f );
+    return 16 + 8 * f.m_Shape.size() + f.m_Name.size() + degen_bin_pad( f.m_Name.size() ) + ndata + degen_bin_pad( ndata );
+}
+
+static void degen_bin_write_record( FILE* file_id, const char* kind, const vector < DegenBinField > &fields )
+{
+    char tag[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    strncpy( tag, kind, 8 );
+
+    uint64_t nbytes = 0;
+    for ( int i = 0; i < ( int )fields.size(); i++ )
+    {
+        nbytes += degen_bin_field_size( fields[i] );
+    }
+
+    uint32_t rec[2] = { ( uint32_t ) fields.size(), 0 };
+
+    fwrite( tag, 1, 8, file_id );
+    fwrite( &nbytes, sizeof( uint64_t ), 1, file_id );
+    fwrite( rec, sizeof( uint32_t ), 2, file_id );
+
+    for ( int i = 0; i < ( int )fields.size(); i++ )
+    {
+        const DegenBinField &f = fields[i];
+
+        uint32_t hdr[4] = { ( uint32_t ) f.m_Name.size(), ( uint32_t ) f.m_Type, ( uint32_t ) f.m_Shape.size(), 0 };
+        fwrite( hdr, sizeof( uint32_t ), 4, file_id );
+        if ( !f.m_Shape.empty() )
+        {
+            fwrite( f.m_Shape.data(), sizeof( uint64_t ), f.m_Shape.size(), file_id );
+        }
+
+        fwrite( f.m_Name.data(), 1, f.m_Name.size(), file_id );
+        degen_bin_write_pad( file_id, degen_bin_pad( f.m_Name.size() ) );
+
+        f.m_Write( file_id );
+        degen_bin_write_pad( file_id, degen_bin_pad( degen_bin_data_size( f ) ) );
+    }
+}
+
+static DegenBinField degen_bin_text( const string &name, const string &val )
+{
+    DegenBinField f;
+    f.m_Name = name;
+    f.m_Type = DEGEN_BIN_TEXT;
+    f.m_Shape = { val.size() };
+    f.m_Write = [val]( FILE* file_id )
+    {
+        fwrite( val.data(), 1, val.size(), file_id );
+    };
+    return f;
+}
+
+static DegenBinField degen_bin_int( const string &name, int val )
+{
+    DegenBinField f;
+    f.m_Name = name;
+    f.m_Type = DEGEN_BIN_INT32;
+    f.m_Write = [val]( FILE* file_id )
+    {
+        int32_t v = val;
+        fwrite( &v, sizeof( int32_t ), 1, file_id );
+    };
+    return f;
+}
+
+static DegenBinField degen_bin_double( const string &name, double val )
+{
+    DegenBinField f;
+    f.m_Name = name;
+    f.m_Type = DEGEN_BIN_FLOAT64;
+    f.m_Write = [val]( FILE* file_id )
+    {
+        fwrite( &val, sizeof( double ), 1, file_id );
+    };
+    return f;
+}
+
+// Array fields reference the DegenGeom data, which must outlive the record write.
+static DegenBinField degen_bin_doubles( const string &name, const vector < double > &vec )
+{
+    DegenBinField f;
+    f.m_Name = name;
+    f.m_Type = DEGEN_BIN_FLOAT64;
+    f.m_Shape = { vec.size() };
+    f.m_Write = [&vec]( FILE* file_id )
+    {
+        fwrite( vec.data(), sizeof( double ), vec.size(), file_id );
+    };
+    return f;
+}
+
+static DegenBinField degen_bin_vec3ds( const string &name, const vector < vec3d > &vec )
+{
+    DegenBinField f;
+    f.m_Name = name;
+    f.m_Type = DEGEN_BIN_FLOAT64;
+    f.m_Shape = { vec.size(), 3 };
+    f.m_Write = [&vec]( FILE* file_id )
+    {
+        fwrite( vec.data(), sizeof( vec3d ), vec.size(), file_id );
+    };
+    return f;
+}
+
+// Rows shorter than the first are zero filled so the array stays rectangular.
+static DegenBinField degen_bin_doubles2( const string &name, const vector < vector < double > > &vec )
+{
+    uint64_t m = vec.empty() ? 0 : vec[0].size();
+
+    DegenBinField f;
+    f.m_Name = name;
+    f.m_Type = DEGEN_BIN_FLOAT64;
+    f.m_Shape = { vec.size(), m };
+    f.m_Write = [&vec, m]( FILE* file_id )
+    {
+        for ( int i = 0; i < ( int )vec.size(); i++ )
+        {
+            uint64_t n = std::min( m, ( uint64_t ) vec[i].size() );
+            fwrite( vec[i].data(), sizeof( double ), n, file_id );
+            for ( uint64_t j = n; j < m; j++ )
+            {
+                degen_bin_write_pad( file_id, sizeof( double ) );
+            }
+        }
+    };
+    return f;
+}
+
+static DegenBinField degen_bin_vec3ds2( const string &name, const vector < vector < vec3d > > &vec )
+{
+    uint64_t m = vec.empty() ? 0 : vec[0].size();
+
+    DegenBinField f;
+    f.m_Name = name;
+    f.m_Type = DEGEN_BIN_FLOAT64;
+    f.m_Shape = { vec.size(), m, 3 };
+    f.m_Write = [&vec, m]( FILE* file_id )
+    {
+        for ( int i = 0; i < ( int )vec.size(); i++ )
+        {
+            uint64_t n = std::min( m, ( uint64_t ) vec[i].size() );
+            fwrite( vec[i].data(), sizeof( vec3d ), n, file_id );
+            for ( uint64_t j = n; j < m; j++ )
+            {
+                degen_bin_write_pad( file_id, sizeof( vec3d ) );
+            }
+        }
+    };
+    return f;
+}
+
+void DegenGeom::write_degenGeomBin_header( FILE* file_id )
+{
+    uint32_t hdr[2] = { DEGEN_BIN_VERSION, 0x01020304 };
+    fwrite( "VSPDEGEN", 1, 8, file_id );
+    fwrite( hdr, sizeof( uint32_t ), 2, file_id );
+}
+
+void DegenGeom::write_degenPtMassBin_file( FILE* file_id, const DegenPtMass &ptMass )
+{
+    vector < vec3d > x( 1, ptMass.x );
+
+    vector < DegenBinField > fields;
+    fields.push_back( degen_bin_text( "name", ptMass.name ) );
+    fields.push_back( degen_bin_text( "geom_id", ptMass.geom_id ) );
+    fields.push_back( degen_bin_double( "mass", ptMass.mass ) );
+    fields.push_back( degen_bin_vec3ds( "X", x ) );
+
+    degen_bin_write_record( file_id, "BLANK", fields );
+}
+
+void DegenGeom::write_degenGeomBin_file( FILE* file_id )
+{
+    string typestr;
+
+    if( type == SURFACE_TYPE )
+    {
+        typestr = "LIFTING_SURFACE";
+    }
+    else if( type == DISK_TYPE )
+    {
+        typestr = "DISK";
+    }
+    else if( type == MESH_TYPE )
+    {
+        typestr = "MESH";
+    }
+    else
+    {
+        typestr = "BODY";
+    }
+
+    // Copies that the fields below reference while the record is written.
+    vector < vec3d > diskx( 1, degenDisk.x );
+    vector < vec3d > diskn( 1, degenDisk.nvec );
+
+    vector < DegenBinField > fields;
+    fields.push_back( degen_bin_text( "type", typestr ) );
+    fields.push_back( degen_bin_text( "name", name ) );
+    fields.push_back( degen_bin_text( "geom_id", parentGeom->GetID() ) );
+    fields.push_back( degen_bin_int( "surf_index", getSurfNum() ) );
+    fields.push_back( degen_bin_int( "main_surf_index", getMainSurfInd() ) );
+    fields.push_back( degen_bin_int( "sym_copy_index", getSymCopyInd() ) );
+    fields.push_back( degen_bin_int( "flip_normal", getFlipNormal() ) );
+    fields.push_back( degen_bin_int( "nxsecs", num_xsecs ) );
+    fields.push_back( degen_bin_int( "num_pnts", num_pnts ) );
+    fields.push_back( degen_bin_doubles( "transmat", transmat ) );
+
+    if ( type == DISK_TYPE )
+    {
+        fields.push_back( degen_bin_double( "disk.diameter", degenDisk.d ) );
+        fields.push_back( degen_bin_vec3ds( "disk.pos", diskx ) );
+        fields.push_back( degen_bin_vec3ds( "disk.n", diskn ) );
+    }
+
+    if ( type != MESH_TYPE )
+    {
+        fields.push_back( degen_bin_vec3ds2( "surf.x", degenSurface.x ) );
+        fields.push_back( degen_bin_doubles2( "surf.u", degenSurface.u ) );
+        fields.push_back( degen_bin_doubles2( "surf.w", degenSurface.w ) );
+        fields.push_back( degen_bin_vec3ds2( "surf.n", degenSurface.nvec ) );
+        fields.push_back( degen_bin_doubles2( "surf.area", degenSurface.area ) );
+    }
+
+    if ( type != DISK_TYPE )
+    {
+        for ( int i = 0; i < ( int )degenPlates.size(); i++ )
+        {
+            const DegenPlate &p = degenPlates[i];
+            string pre = "plate" + std::to_string( i ) + ".";
+
+            fields.push_back( degen_bin_vec3ds( pre + "n", p.nPlate ) );
+            fields.push_back( degen_bin_vec3ds2( pre + "x", p.x ) );
+            fields.push_back( degen_bin_vec3ds2( pre + "xCamber", p.xCamber ) );
+            fields.push_back( degen_bin_doubles2( pre + "zCamber", p.zcamber ) );
+            fields.push_back( degen_bin_doubles2( pre + "t", p.t ) );
+            fields.push_back( degen_bin_vec3ds2( pre + "nCamber", p.nCamber ) );
+            fields.push_back( degen_bin_doubles2( pre + "u", p.u ) );
+            fields.push_back( degen_bin_doubles2( pre + "wTop", p.wTop ) );
+            fields.push_back( degen_bin_doubles2( pre + "wBot", p.wBot ) );
+        }
+
+        for ( int i = 0; i < ( int )degenSticks.size(); i++ )
+        {
+            const DegenStick &s = degenSticks[i];
+            string pre = "stick" + std::to_string( i ) + ".";
+
+            fields.push_back( degen_bin_vec3ds( pre + "le", s.xle ) );
+            fields.push_back( degen_bin_vec3ds( pre + "te", s.xte ) );
+            fields.push_back( degen_bin_vec3ds( pre + "cgShell", s.xcgShell ) );
+            fields.push_back( degen_bin_vec3ds( pre + "cgSolid", s.xcgSolid ) );
+            fields.push_back( degen_bin_doubles( pre + "toc", s.toc ) );
+            fields.push_back( degen_bin_doubles( pre + "tLoc", s.tLoc ) );
+            fields.push_back( degen_bin_doubles( pre + "chord", s.chord ) );
+            fields.push_back( degen_bin_doubles2( pre + "Ishell", s.Ishell ) );
+            fields.push_back( degen_bin_doubles2( pre + "Isolid", s.Isolid ) );
+            fields.push_back( degen_bin_doubles( pre + "sectArea", s.sectarea ) );
+            fields.push_back( degen_bin_vec3ds( pre + "sectNormal", s.sectnvec ) );
+            fields.push_back( degen_bin_doubles( pre + "perimTop", s.perimTop ) );
+            fields.push_back( degen_bin_doubles( pre + "perimBot", s.perimBot ) );
+            fields.push_back( degen_bin_doubles( pre + "u", s.u ) );
+            fields.push_back( degen_bin_doubles2( pre + "transmat", s.transmat ) );
+            fields.push_back( degen_bin_doubles2( pre + "invtransmat", s.invtransmat ) );
+            fields.push_back( degen_bin_doubles( pre + "toc2", s.toc2 ) );
+            fields.push_back( degen_bin_doubles( pre + "tLoc2", s.tLoc2 ) );
+            fields.push_back( degen_bin_doubles( pre + "anglele", s.anglele ) );
+            fields.push_back( degen_bin_doubles( pre + "anglete", s.anglete ) );
+            fields.push_back( degen_bin_doubles( pre + "radleTop", s.radleTop ) );
+            fields.push_back( degen_bin_doubles( pre + "radleBot", s.radleBot ) );
+            fields.push_back( degen_bin_doubles( pre + "sweeple", s.sweeple ) );
+            fields.push_back( degen_bin_doubles( pre + "sweepte", s.sweepte ) );
+            fields.push_back( degen_bin_doubles( pre + "areaTop", s.areaTop ) );
+            fields.push_back( degen_bin_doubles( pre + "areaBot", s.areaBot ) );
+        }
+
+        if ( !degenPoint.vol.empty() )
+        {
+            fields.push_back( degen_bin_double( "point.vol", degenPoint.vol[0] ) );
+            fields.push_back( degen_bin_double( "point.volWet", degenPoint.volWet[0] ) );
+            fields.push_back( degen_bin_double( "point.area", degenPoint.area[0] ) );
+            fields.push_back( degen_bin_double( "point.areaWet", degenPoint.areaWet[0] ) );
+            fields.push_back( degen_bin_doubles( "point.Ishell", degenPoint.Ishell[0] ) );
+            fields.push_back( degen_bin_doubles( "point.Isolid", degenPoint.Isolid[0] ) );
+            fields.push_back( degen_bin_vec3ds( "point.cgShell", degenPoint.xcgShell ) );
+            fields.push_back( degen_bin_vec3ds( "point.cgSolid", degenPoint.xcgSolid ) );
+        }
+
+        for ( int i = 0; i < ( int )degenSubSurfs.size(); i++ )
+        {
+            const DegenSubSurf &ss = degenSubSurfs[i];
+            string pre = "subsurf" + std::to_string( i ) + ".";
+
+            fields.push_back( degen_bin_text( pre + "name", ss.name ) );
+            fields.push_back( degen_bin_text( pre + "typeName", ss.typeName ) );
+            fields.push_back( degen_bin_int( pre + "typeId", ss.typeId ) );
+            fields.push_back( degen_bin_text( pre + "fullName", ss.fullName ) );
+            fields.push_back( degen_bin_int( pre + "testType", ss.testType ) );
+            fields.push_back( degen_bin_doubles( pre + "u", ss.u ) );
+            fields.push_back( degen_bin_doubles( pre + "w", ss.w ) );
+            fields.push_back( degen_bin_vec3ds( pre + "x", ss.x ) );
+        }
+
+        for ( int i = 0; i < ( int )degenHingeLines.size(); i++ )
+        {
+            const DegenHingeLine &hl = degenHingeLines[i];
+            string pre = "hinge" + std::to_string( i ) + ".";
+
+            fields.push_back( degen_bin_text( pre + "name", hl.name ) );
+            fields.push_back( degen_bin_doubles( pre + "uStart", hl.uStart ) );
+            fields.push_back( degen_bin_doubles( pre + "uEnd", hl.uEnd ) );
+            fields.push_back( degen_bin_doubles( pre + "wStart", hl.wStart ) );
+            fields.push_back( degen_bin_doubles( pre + "wEnd", hl.wEnd ) );
+            fields.push_back( degen_bin_vec3ds( pre + "xStart", hl.xStart ) );
+            fields.push_back( degen_bin_vec3ds( pre + "xEnd", hl.xEnd ) );
+        }
+    }
+
+    degen_bin_write_record( file_id, "COMP", fields );
+}
+
 void DegenGeom::write_degenGeomResultsManager( vector< string> &degen_results_ids )
 {
     Results *res = ResultsMgr.CreateResults( "Degen_DegenGeom", "Degen geom results." );
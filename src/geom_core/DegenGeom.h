@@ -322,6 +322,11 @@ public:
     void write_degenSubSurfM_file( FILE* file_id, int isubsurf );
     void write_degenHingeLineM_file( FILE* file_id, int ihingeline );
 
+    // Binary file of self-describing, 8 byte aligned records, one per component.
+    static void write_degenGeomBin_header( FILE* file_id );
+    static void write_degenPtMassBin_file( FILE* file_id, const DegenPtMass &ptMass );
+    void write_degenGeomBin_file( FILE* file_id );
+
     void write_degenGeomResultsManager( vector< string> &degen_results_ids );
     void write_degenGeomDiskResultsManager( Results * res );
     void write_degenGeomSurfResultsManager( Results * res );
@@ -1500,6 +1500,7 @@ void GeomXForm::BuildRigidAttachedDescendantList( vector< string > &descendant )
 Geom::Geom( Vehicle* vehicle_ptr ) : GeomXForm( vehicle_ptr )
 {
     m_UpdateBlock = false;
+    m_ShapeUpdateCount = 0;
 
     m_Name = "Geom";
     m_Type.m_Type = GEOM_GEOM_TYPE;
@@ -1767,7 +1768,11 @@ void Geom::CopyFrom( Geom* geom )
 {
     xmlNodePtr root = xmlNewNode( nullptr, ( const xmlChar * )"Vsp_Geometry" );
 
+    // Parm values are copied straight from the source containers, only structure goes through XML
+    ParmMgr.SetDirectCopyFlag( ParmMgr.GetDirectCopyEnabled() );
     geom->EncodeGeom( root );
+    ParmMgr.SetDirectCopyFlag( false );
+
     DecodeGeom( root );
 
     xmlFreeNode( root );
@@ -1918,6 +1923,9 @@ void Geom::Update( bool fullupdate )
         }
     }
 
+    if ( m_SurfDirty || m_TessDirty )
+        m_ShapeUpdateCount++;
+
     m_UpdateXForm = false;
     if ( m_XFormDirty )
         m_UpdateXForm = true;
@@ -3009,9 +3017,12 @@ void Geom::WriteProjectionLinesSVG( xmlNodePtr root, const BndBox &svgbox )
 void Geom::UpdateDrawObj()
 {
     m_FeatureDrawObj_vec.clear();
-    m_WireShadeDrawObj_vec.clear();
 
-    if ( m_GuiDraw.GetDisplayType() == DISPLAY_TYPE::DISPLAY_BEZIER )
+    if ( m_GuiDraw.GetDisplayType() != DISPLAY_TYPE::DISPLAY_BEZIER )
+    {
+        m_WireShadeDrawObj_vec.clear();
+    }
+    else
     {
         m_FeatureDrawObj_vec.resize(1);
         m_FeatureDrawObj_vec[0].m_GeomChanged = true;
@@ -3021,7 +3032,14 @@ void Geom::UpdateDrawObj()
         m_FeatureDrawObj_vec[0].m_GeomID = m_ID + "Feature_0";
         m_FeatureDrawObj_vec[0].m_Type = DrawObj::VSP_LINES;
 
+        // Wire/shade DrawObjs are kept between updates so their packed buffers are
+        // refilled in place and the element buffer survives unchanged topology.
         m_WireShadeDrawObj_vec.resize( 4 );
+        for ( int i = 0; i < 4; i++ )
+        {
+            m_WireShadeDrawObj_vec[i].BeginMeshBuffers();
+        }
+
         m_WireShadeDrawObj_vec[0].m_FlipNormals = false;
         m_WireShadeDrawObj_vec[1].m_FlipNormals = true;
         m_WireShadeDrawObj_vec[2].m_FlipNormals = false;
@@ -3065,15 +3083,8 @@ void Geom::UpdateDrawObj()
                     iflip += 2;
                 }
 
-                m_WireShadeDrawObj_vec[iflip].m_PntMesh.insert( m_WireShadeDrawObj_vec[iflip].m_PntMesh.end(),
-                        m_TessVec[i].m_pnts.begin(), m_TessVec[i].m_pnts.end() );
-                m_WireShadeDrawObj_vec[iflip].m_NormMesh.insert( m_WireShadeDrawObj_vec[iflip].m_NormMesh.end(),
-                        m_TessVec[i].m_norms.begin(), m_TessVec[i].m_norms.end() );
-
-                m_WireShadeDrawObj_vec[iflip].m_uTexMesh.insert( m_WireShadeDrawObj_vec[iflip].m_uTexMesh.end(),
-                        m_TessVec[i].m_utex.begin(), m_TessVec[i].m_utex.end() );
-                m_WireShadeDrawObj_vec[iflip].m_vTexMesh.insert( m_WireShadeDrawObj_vec[iflip].m_vTexMesh.end(),
-                        m_TessVec[i].m_vtex.begin(), m_TessVec[i].m_vtex.end() );
+                m_WireShadeDrawObj_vec[iflip].AppendMeshBuffers( m_TessVec[i].m_pnts, m_TessVec[i].m_norms,
+                                                                 m_TessVec[i].m_utex, m_TessVec[i].m_vtex );
 
                 if( m_GuiDraw.GetDispFeatureFlag() )
                 {
@@ -3093,6 +3104,11 @@ void Geom::UpdateDrawObj()
                 }
             }
         }
+
+        for ( int i = 0; i < 4; i++ )
+        {
+            m_WireShadeDrawObj_vec[i].EndMeshBuffers();
+        }
     }
 
     //==== Bounding Box ====//
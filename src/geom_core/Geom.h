@@ -541,6 +541,13 @@ public:
         return m_TransMatVec;
     }
 
+    // Incremented by Update() whenever the surfaces or their tessellation change.
+    // Transform only updates leave it alone.
+    int GetShapeUpdateCount() const
+    {
+        return m_ShapeUpdateCount;
+    }
+
     //==== XSec Surfs ====//
     virtual int GetNumXSecSurfs() const
     {
@@ -811,6 +818,7 @@ public:
 protected:
 
     bool m_UpdateBlock;
+    int m_ShapeUpdateCount;
 
     virtual void UpdateSurf() = 0;
     void UpdateEndCaps();
@@ -186,6 +186,20 @@ void GeomCoreTestSuite::XmlTest()
         TEST_ASSERT( std::abs( dbl_vec[i] - dbl_ret_vec[i] ) < DBL_EPSILON  );
     }
 
+    //==== Binary Arrays Round Trip Exactly ====//
+    vector< double > big_vec( 200 );
+    for ( int i = 0 ; i < ( int )big_vec.size() ; i++ )
+    {
+        big_vec[i] = 1.0 / ( i + 3.0 ) - 1.0e-200 * i;
+    }
+
+    XmlUtil::SetBinaryArrayMode( XmlUtil::BINARY_ARRAY_BASE64 );
+    XmlUtil::AddVectorDoubleNode( root, "Bin_Vec_Test", big_vec );
+    XmlUtil::SetBinaryArrayMode( XmlUtil::BINARY_ARRAY_NONE );
+
+    vector< double > big_ret_vec = XmlUtil::ExtractVectorDoubleNode( root, "Bin_Vec_Test" );
+    TEST_ASSERT( big_vec == big_ret_vec );
+
     xmlFreeNode( root );
 }
 
@@ -37,6 +37,16 @@
 
 #include "AnalysisMgr.h"
 #include "VSPAEROMgr.h"
+#include "ParallelUtil.h"
+
+#include <chrono>
+
+#define GEOMETRY_ANALYSIS_PARALLEL_CHUNK 1
+
+static double ElapsedSeconds( const std::chrono::steady_clock::time_point &tstart )
+{
+    return std::chrono::duration < double > ( std::chrono::steady_clock::now() - tstart ).count();
+}
 
 GeometryAnalysisCase::GeometryAnalysisCase()
 {
@@ -121,11 +131,18 @@ GeometryAnalysisCase::GeometryAnalysisCase()
     m_GeometryAnalysisType.Init( "IntererenceCheckType", m_GroupName, this, vsp::COMP_GEOM, vsp::EXTERNAL_INTERFERENCE, vsp::NUM_INTERFERENCE_TYPES - 1 );
 
     m_LastResultValue.Init( "LastResult", m_GroupName, this, 0.0, -1e12, 1e12 );
+
+    m_LastEvalTime = 0;
+
+    m_BatchPrimary = nullptr;
+    m_BatchSecondary = nullptr;
+    m_BatchSwept = nullptr;
 }
 
 GeometryAnalysisCase::~GeometryAnalysisCase()
 {
     RemoveAllAzEl();
+    delete m_BatchSwept;
 }
 
 void GeometryAnalysisCase::Update()
@@ -1010,6 +1027,8 @@ xmlNodePtr GeometryAnalysisCase::DecodeXml( xmlNodePtr & node )
 
 string GeometryAnalysisCase::Evaluate()
 {
+    auto tstart = std::chrono::steady_clock::now();
+
     m_LastResultValue = 1.0;
     m_LastResult.clear();
 
@@ -2600,9 +2619,217 @@ string GeometryAnalysisCase::Evaluate()
 
     UpdateDrawObj_PostAnalysis();
 
+    m_LastEvalTime = ElapsedSeconds( tstart );
+
     return m_LastResult;
 }
 
+bool GeometryAnalysisCase::IsBatchable()
+{
+    if ( m_PrimaryType() == vsp::MODE_TARGET )
+    {
+        return false;
+    }
+
+    return m_GeometryAnalysisType() == vsp::EXTERNAL_INTERFERENCE ||
+           m_GeometryAnalysisType() == vsp::PACKAGING_INTERFERENCE ||
+           m_GeometryAnalysisType() == vsp::LINEAR_SWEPT_VOLUME_ANALYSIS;
+}
+
+string GeometryAnalysisCase::GetMeshKey( int target )
+{
+    int type = m_SecondaryType();
+    int set = m_SecondarySet();
+    string id = m_SecondaryGeomID;
+
+    if ( target == PRIMARY_MESH )
+    {
+        type = m_PrimaryType();
+        set = m_PrimarySet();
+        id = m_PrimaryGeomID;
+    }
+
+    if ( type == vsp::SET_TARGET )
+    {
+        return "Set_" + std::to_string( set );
+    }
+    else if ( type == vsp::GEOM_TARGET )
+    {
+        if ( target == HINGE_SECONDARY_MESH )
+        {
+            return "Hinge_" + id;
+        }
+        return "Geom_" + id;
+    }
+    return string();
+}
+
+GeometryAnalysisMesh* GeometryAnalysisCase::GetSharedMesh( int target )
+{
+    string key = GetMeshKey( target );
+
+    GeometryAnalysisMesh* gm = GeometryAnalysisMgr.FindSharedMesh( key );
+    if ( !gm )
+    {
+        vector< TMesh* > tmv;
+        if ( target == PRIMARY_MESH )
+        {
+            tmv = GetPrimaryTMeshVec();
+        }
+        else if ( target == SECONDARY_MESH )
+        {
+            tmv = GetSecondaryTMeshVec();
+        }
+        else
+        {
+            tmv = GetHingeSecondaryTMeshVec();
+        }
+
+        gm = GeometryAnalysisMgr.AddSharedMesh( key, tmv );
+    }
+    return gm;
+}
+
+bool GeometryAnalysisCase::PrepareBatch()
+{
+    auto tstart = std::chrono::steady_clock::now();
+
+    m_LastResultValue = 1.0;
+    m_LastResult.clear();
+
+    DeleteTMeshVec( m_TMeshVec );
+    DeleteTMeshVec( m_SliceTMeshVec );
+    m_LinePtsVec.clear();
+    m_PointsVec.clear();
+
+    m_BatchData = InterferenceData();
+    delete m_BatchSwept;
+    m_BatchSwept = nullptr;
+    m_BatchDispVec.clear();
+
+    m_BatchPrimary = GetSharedMesh( PRIMARY_MESH );
+
+    if ( m_GeometryAnalysisType() == vsp::LINEAR_SWEPT_VOLUME_ANALYSIS )
+    {
+        m_BatchSecondary = GetSharedMesh( HINGE_SECONDARY_MESH );
+    }
+    else
+    {
+        m_BatchSecondary = GetSharedMesh( SECONDARY_MESH );
+    }
+
+    if ( !m_BatchPrimary->m_TMesh || !m_BatchSecondary->m_TMesh )
+    {
+        MessageData errMsgData;
+        errMsgData.m_String = "Error";
+        errMsgData.m_IntVec.push_back( vsp::VSP_WRONG_GEOM_TYPE );
+        char buf[255];
+        snprintf( buf, sizeof( buf ), "Error:  Empty primary or secondary mesh in %s.", m_Name.c_str() );
+        errMsgData.m_StringVec.emplace_back( string( buf ) );
+
+        MessageMgr::getInstance().SendAll( errMsgData );
+
+        UpdateDrawObj_PostAnalysis();
+
+        m_LastEvalTime = ElapsedSeconds( tstart );
+        return false;
+    }
+
+    if ( m_GeometryAnalysisType() == vsp::LINEAR_SWEPT_VOLUME_ANALYSIS )
+    {
+        BndBox bbox = m_BatchSecondary->m_BBox;
+        m_BatchPrimary->m_TMesh->UpdateBBox( bbox );
+
+        double dist = 1.1 * bbox.DiagDist();
+
+        vec3d disp;
+        GetDisplacement( dist, m_BatchDStart, disp );
+        HandleDispersion( disp, m_BatchDispVec );
+
+        // Built here, not in MeasureBatch().  Swept volume construction creates TTri /
+        // TMesh objects and runs Intersect / Split, none of which is thread safe.
+        m_BatchSwept = SweptVolumeMesh( m_BatchSecondary->m_TMesh, m_BatchDStart, m_BatchDispVec );
+        m_BatchData.m_VolSecondary = m_BatchSwept->ComputeTheoVol();
+    }
+
+    m_LastEvalTime = ElapsedSeconds( tstart );
+    return true;
+}
+
+void GeometryAnalysisCase::MeasureBatch()
+{
+    auto tstart = std::chrono::steady_clock::now();
+
+    TMesh *secondary_tm = m_BatchSecondary->m_TMesh;
+
+    m_BatchData.m_VolPrimary = m_BatchPrimary->m_Vol;
+    if ( m_BatchSwept )
+    {
+        secondary_tm = m_BatchSwept;
+    }
+    else
+    {
+        m_BatchData.m_VolSecondary = m_BatchSecondary->m_Vol;
+    }
+
+    InterferenceMeasure( m_BatchPrimary->m_TMesh, secondary_tm, m_GeometryAnalysisType() == vsp::PACKAGING_INTERFERENCE, m_BatchData );
+
+    m_LastEvalTime += ElapsedSeconds( tstart );
+}
+
+void GeometryAnalysisCase::FinishBatch()
+{
+    auto tstart = std::chrono::steady_clock::now();
+
+    bool packaging = m_GeometryAnalysisType() == vsp::PACKAGING_INTERFERENCE;
+
+    TMesh *secondary_tm = m_BatchSecondary->m_TMesh;
+    if ( m_BatchSwept )
+    {
+        secondary_tm = m_BatchSwept;
+    }
+
+    InterferenceResolve( m_BatchPrimary->m_TMesh, secondary_tm, packaging, m_BatchData, m_TMeshVec );
+
+    Results *res = nullptr;
+    if ( m_GeometryAnalysisType() == vsp::EXTERNAL_INTERFERENCE )
+    {
+        res = ResultsMgr.CreateResults( "External_Interference", "External interference check." );
+    }
+    else if ( packaging )
+    {
+        res = ResultsMgr.CreateResults( "Packaging_Interference", "Packaging interference check." );
+    }
+    else
+    {
+        res = ResultsMgr.CreateResults( "Linear_Swept_Volume_Interference", "Linear swept volume interference check." );
+
+        // Place swept volume at start of result meshes.
+        m_TMeshVec.insert( m_TMeshVec.begin(), m_BatchSwept );
+        m_BatchSwept = nullptr;
+    }
+
+    if ( res )
+    {
+        m_LastResult = res->GetID();
+        m_BatchData.AddResults( res );
+        m_LinePtsVec = ResultsMgr.GetVec3dResults( m_LastResult, "Pts", 0 );
+    }
+
+    vector < double > resvec = ResultsMgr.GetDoubleResults( m_LastResult, "Result", 0 );
+    if ( resvec.size() > 0 )
+    {
+        m_LastResultValue = resvec[0];
+    }
+
+    UpdateDrawObj_PostAnalysis();
+
+    m_BatchPrimary = nullptr;
+    m_BatchSecondary = nullptr;
+
+    m_LastEvalTime += ElapsedSeconds( tstart );
+}
+
 vec3d GeometryAnalysisCase::weightdist( const vec3d &cg, const vector < vec3d > &ptvec, const vec3d &normal )
 {
     typedef Eigen::Matrix< double, 3, 3 > mat3;
@@ -2933,7 +3160,8 @@ string GeometryAnalysisCase::MakeMeshGeom()
 
 GeometryAnalysisMgrSingleton::GeometryAnalysisMgrSingleton()
 {
-
+    m_NumSharedMeshBuilt = 0;
+    m_SharedMeshTime = 0;
 }
 
 GeometryAnalysisMgrSingleton::~GeometryAnalysisMgrSingleton()
@@ -3008,25 +3236,140 @@ void GeometryAnalysisMgrSingleton::Update()
 
 }
 
+// Batchable cases between the other cases are evaluated together.  Cases
+// with the same primary or secondary target share one prepared mesh, and the
+// distance and containment queries run concurrently.  Mode cases change the
+// vehicle, so the shared meshes are rebuilt after them.
 string GeometryAnalysisMgrSingleton::EvaluateAll()
 {
+    auto tstart = std::chrono::steady_clock::now();
+
+    ClearSharedMeshes();
+    m_NumSharedMeshBuilt = 0;
+    m_SharedMeshTime = 0;
+
+    vector < GeometryAnalysisCase* > batch;
+
+    for ( int i = 0; i < (int)m_GeometryAnalysisVec.size(); i++ )
+    {
+        GeometryAnalysisCase *gcase = m_GeometryAnalysisVec[i];
+
+        if ( gcase->IsBatchable() )
+        {
+            batch.push_back( gcase );
+        }
+        else
+        {
+            EvaluateBatch( batch );
+            batch.clear();
+
+            gcase->Evaluate();
+
+            if ( gcase->m_PrimaryType() == vsp::MODE_TARGET )
+            {
+                ClearSharedMeshes();
+            }
+        }
+    }
+    EvaluateBatch( batch );
+
+    ClearSharedMeshes();
+
     std::vector <string> res_id_vector;
+    std::vector <double> time_vector;
 
     for ( int i = 0; i < (int)m_GeometryAnalysisVec.size(); i++ )
     {
-        string rid = m_GeometryAnalysisVec[i]->Evaluate();
-        res_id_vector.push_back( rid );
+        res_id_vector.push_back( m_GeometryAnalysisVec[i]->m_LastResult );
+        time_vector.push_back( m_GeometryAnalysisVec[i]->m_LastEvalTime );
     }
 
     Results *res = ResultsMgr.CreateResults( "GeometryAnalysisAll", "All geometry analysis results for model." );
     if( res )
     {
         res->Add( new NameValData( "ResultsVec", res_id_vector, "ID's of geometry analysis results." ) );
+        res->Add( new NameValData( "Eval_Time", time_vector, "Seconds spent evaluating each geometry analysis, including shared meshes it built first." ) );
+        res->Add( new NameValData( "Num_Shared_Mesh", m_NumSharedMeshBuilt, "Number of meshes built and shared between geometry analyses." ) );
+        res->Add( new NameValData( "Shared_Mesh_Time", m_SharedMeshTime, "Seconds spent building shared meshes." ) );
+        res->Add( new NameValData( "Total_Time", ElapsedSeconds( tstart ), "Seconds spent evaluating all geometry analyses." ) );
         return res->GetID();
     }
     return string();
 }
 
+void GeometryAnalysisMgrSingleton::EvaluateBatch( const vector < GeometryAnalysisCase* > &batch )
+{
+    vector < GeometryAnalysisCase* > ready;
+    for ( int i = 0; i < (int)batch.size(); i++ )
+    {
+        if ( batch[i]->PrepareBatch() )
+        {
+            ready.push_back( batch[i] );
+        }
+    }
+
+    ParallelFor( (int)ready.size(), GEOMETRY_ANALYSIS_PARALLEL_CHUNK, [&]( int begin, int end )
+    {
+        for ( int i = begin; i < end; i++ )
+        {
+            ready[i]->MeasureBatch();
+        }
+    } );
+
+    for ( int i = 0; i < (int)ready.size(); i++ )
+    {
+        ready[i]->FinishBatch();
+    }
+}
+
+GeometryAnalysisMesh* GeometryAnalysisMgrSingleton::FindSharedMesh( const string &key )
+{
+    std::map < string, GeometryAnalysisMesh >::iterator it = m_SharedMeshMap.find( key );
+    if ( it != m_SharedMeshMap.end() )
+    {
+        return &it->second;
+    }
+    return nullptr;
+}
+
+// Takes ownership of tmv.
+GeometryAnalysisMesh* GeometryAnalysisMgrSingleton::AddSharedMesh( const string &key, vector< TMesh* > &tmv )
+{
+    auto tstart = std::chrono::steady_clock::now();
+
+    GeometryAnalysisMesh &gm = m_SharedMeshMap[ key ];
+    gm.m_TMesh = nullptr;
+    gm.m_Vol = 0;
+
+    if ( !tmv.empty() )
+    {
+        UpdateBBox( gm.m_BBox, tmv );
+
+        CSGMesh( tmv );
+        FlattenTMeshVec( tmv );
+        gm.m_TMesh = MergeTMeshVec( tmv );
+        gm.m_TMesh->LoadBndBox();
+        gm.m_Vol = gm.m_TMesh->ComputeTheoVol();
+
+        DeleteTMeshVec( tmv );
+    }
+
+    m_NumSharedMeshBuilt++;
+    m_SharedMeshTime += ElapsedSeconds( tstart );
+
+    return &gm;
+}
+
+void GeometryAnalysisMgrSingleton::ClearSharedMeshes()
+{
+    std::map < string, GeometryAnalysisMesh >::iterator it;
+    for ( it = m_SharedMeshMap.begin(); it != m_SharedMeshMap.end(); ++it )
+    {
+        delete it->second.m_TMesh;
+    }
+    m_SharedMeshMap.clear();
+}
+
 void GeometryAnalysisMgrSingleton::AddLinkableContainers( vector< string > & linkable_container_vec )
 {
     for ( int i = 0; i < (int)m_GeometryAnalysisVec.size(); i++ )
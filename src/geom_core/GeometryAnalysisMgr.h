@@ -17,8 +17,18 @@
 #include "DrawObj.h"
 #include "MaterialMgr.h"
 
+#include <map>
+
 class AuxiliaryGeom;
 
+//==== Merged Mesh Shared By All Cases With The Same Target ====//
+struct GeometryAnalysisMesh
+{
+    TMesh *m_TMesh;     // CSG, flattened, merged and bounding boxed.  nullptr if empty.
+    double m_Vol;
+    BndBox m_BBox;      // Of the target meshes before CSG.
+};
+
 class GeometryAnalysisCase : public ParmContainer
 {
 public:
@@ -65,6 +75,20 @@ public:
 
     string Evaluate();
 
+    // Exterior, packaging and linear swept volume checks can be evaluated as a
+    // batch.  Prepare and Finish run on the main thread, Measure may run on a
+    // worker thread and only reads meshes, so Prepare also builds the swept
+    // volume.  Prepare returns false if there is nothing to measure.
+    enum { PRIMARY_MESH, SECONDARY_MESH, HINGE_SECONDARY_MESH };
+
+    bool IsBatchable();
+    string GetMeshKey( int target );
+    GeometryAnalysisMesh* GetSharedMesh( int target );
+
+    bool PrepareBatch();
+    void MeasureBatch();
+    void FinishBatch();
+
     vec3d weightdist( const vec3d &cg, const vector < vec3d > &ptvec, const vec3d &normal );
     double tipback( const vec3d &cg, const vec3d &normal, const vec3d &ptaxis, const vec3d &axis, vec3d &p0, vec3d &p1 );
     double tipover( const vec3d &cg, const vec3d &normal, const vec3d &ptaxis, const vec3d &axis, vec3d &p0, vec3d &p1 );
@@ -167,6 +191,17 @@ public:
     DrawObj m_PointResultDO;
 
     DrawObj m_SecondaryVizPointDO;
+
+    double m_LastEvalTime;      // Seconds spent in the last evaluation.
+
+protected:
+
+    GeometryAnalysisMesh *m_BatchPrimary;
+    GeometryAnalysisMesh *m_BatchSecondary;
+    TMesh *m_BatchSwept;
+    vec3d m_BatchDStart;
+    vector < vec3d > m_BatchDispVec;
+    InterferenceData m_BatchData;
 };
 
 
@@ -194,6 +229,11 @@ public:
     virtual void Update();
 
     string EvaluateAll();
+    void EvaluateBatch( const vector < GeometryAnalysisCase* > &batch );
+
+    GeometryAnalysisMesh* FindSharedMesh( const string &key );
+    GeometryAnalysisMesh* AddSharedMesh( const string &key, vector< TMesh* > &tmv );
+    void ClearSharedMeshes();
 
     void AddLinkableContainers( vector< string > & linkable_container_vec );
 
@@ -214,6 +254,11 @@ public:
 protected:
     vector < GeometryAnalysisCase* > m_GeometryAnalysisVec;
 
+    // Meshes shared between the cases of one EvaluateAll(), keyed by target.
+    std::map < string, GeometryAnalysisMesh > m_SharedMeshMap;
+    int m_NumSharedMeshBuilt;
+    double m_SharedMeshTime;
+
 };
 
 #define GeometryAnalysisMgr GeometryAnalysisMgrSingleton::getInstance()
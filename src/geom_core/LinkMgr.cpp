@@ -24,6 +24,13 @@ LinkMgrSingleton::LinkMgrSingleton()
     m_UserParms.SetNumPredefined( m_NumPredefinedUserParms );
     m_UserParms.Renew(m_NumPredefinedUserParms);
     m_FreezeUpdateFlag = false;
+    m_BatchFlag = false;
+    m_BatchResolveFlag = false;
+    m_LinkGraphDirty = true;
+    m_LinkOrderDirty = true;
+    m_LinkGraphParmStamp = 0;
+    m_PropagateFlag = false;
+    m_RecursiveFlag = false;
 }
 
 void LinkMgrSingleton::Init()
@@ -159,6 +166,7 @@ void LinkMgrSingleton::CheckLinks()
     if ( num_delete > 0 )
     {
         m_CurrLinkIndex = -1;
+        m_LinkGraphDirty = true;
     }
 }
 
@@ -194,6 +202,10 @@ bool LinkMgrSingleton::AddCurrLink()
         m_LinkVec.back()->SetUpperLimitFlag( m_WorkingLink->GetUpperLimitFlag() );
         m_LinkVec.back()->m_UpperLimit.Set( m_WorkingLink->m_UpperLimit() );
     }
+    else
+    {
+        return false;
+    }
 
     return true;
 }
@@ -247,6 +259,21 @@ bool LinkMgrSingleton::AddLink( const string& pidA, const string& pidB, bool ini
         return false;
     }
 
+    //==== Reject Links That Would Close A Loop ====//
+    if ( CheckForLinkLoop( pidA, pidB ) )
+    {
+        MessageData errMsgData;
+        errMsgData.m_String = "Error";
+
+        errMsgData.m_IntVec.push_back( vsp::VSP_LINK_LOOP_DETECTED );
+        char buf[255];
+        snprintf( buf, sizeof( buf ), "Warning: Linking '%s' (%s) to '%s' (%s) would create a link loop.  Link not added.\n",
+                  pA->GetName().c_str(), pidA.c_str(), pB->GetName().c_str(), pidB.c_str() );
+        errMsgData.m_StringVec.emplace_back( string( buf ) );
+        MessageMgr::getInstance().SendAll( errMsgData );
+        return false;
+    }
+
     Link* pl = new Link();
 
     pl->SetParmA( pidA );
@@ -263,6 +290,20 @@ bool LinkMgrSingleton::AddLink( const string& pidA, const string& pidB, bool ini
     m_LinkVec.push_back( pl );
     m_CurrLinkIndex = ( int )m_LinkVec.size() - 1;
 
+    //==== Add The Edge Directly If The Graph Is Current - Only The Order Needs Redoing ====//
+    if ( !m_LinkGraphDirty && !m_PropagateFlag && m_LinkGraphParmStamp == ParmMgr.GetNumParmChanges() )
+    {
+        int a = AddLinkNode( pidA );
+        int b = AddLinkNode( pidB );
+        m_LinkGraph[a].m_OutNodes.push_back( b );
+        m_LinkGraph[a].m_OutLinks.push_back( pl );
+        m_LinkOrderDirty = true;
+    }
+    else
+    {
+        m_LinkGraphDirty = true;
+    }
+
     return true;
 }
 
@@ -281,6 +322,7 @@ void LinkMgrSingleton::DelCurrLink()
     delete pl;
 
     m_CurrLinkIndex = -1;
+    m_LinkGraphDirty = true;
 }
 
 void LinkMgrSingleton::DelLinks( const set < int > &toDel )
@@ -301,6 +343,7 @@ void LinkMgrSingleton::DelLinks( const set < int > &toDel )
     m_LinkVec = keep;
 
     m_CurrLinkIndex = -1;
+    m_LinkGraphDirty = true;
 }
 
 //==== Delete All Links ====//
@@ -313,6 +356,7 @@ void LinkMgrSingleton::DelAllLinks()
 
     m_LinkVec.clear();
     m_CurrLinkIndex = -1;
+    m_LinkGraphDirty = true;
 }
 //==== Link All Parms In A Group ====//
 bool LinkMgrSingleton::LinkAllGroup()
@@ -414,6 +458,47 @@ void LinkMgrSingleton::ResetWorkingLink()
     m_WorkingLink->SetOffsetFlag( true );
 }
 
+//==== Value Of Link Output Given Input Value ====//
+static double LinkedValue( Link* pl, double val )
+{
+    double offset = 0.0;
+    if ( pl->GetOffsetFlag() )
+    {
+        offset = pl->m_Offset();
+    }
+    double scale = 1.0;
+    if ( pl->GetScaleFlag() )
+    {
+        scale = pl->m_Scale();
+    }
+
+    val = val * scale + offset;
+
+    if ( pl->GetLowerLimitFlag() && val < pl->m_LowerLimit() )      // Constraints
+    {
+        val = pl->m_LowerLimit();
+    }
+
+    if ( pl->GetUpperLimitFlag() && val > pl->m_UpperLimit() )      // Constraints
+    {
+        val = pl->m_UpperLimit();
+    }
+
+    return val;
+}
+
+static void SendMissingLinkParmMessage( const string & pid )
+{
+    MessageData errMsgData;
+    errMsgData.m_String = "Error";
+
+    errMsgData.m_IntVec.push_back( vsp::VSP_CANT_FIND_PARM );
+    char buf[255];
+    snprintf( buf, sizeof( buf ), "Error: Link Output parm '%s' not found.\n", pid.c_str() );
+    errMsgData.m_StringVec.emplace_back( string( buf ) );
+    MessageMgr::getInstance().SendAll( errMsgData );
+}
+
 //==== Parm Changed ====//
 void LinkMgrSingleton::ParmChanged( const string& pid, bool start_flag  )
 {
@@ -425,33 +510,76 @@ void LinkMgrSingleton::ParmChanged( const string& pid, bool start_flag  )
     if ( m_FreezeUpdateFlag )
         return;
 
+    //==== Defer Until The Batch Is Done ====//
+    if ( m_BatchFlag )
+    {
+        m_BatchParmVec.push_back( pid );
+        return;
+    }
+
+    //==== Links Loop Back On Themselves - Depth First Like Before ====//
+    if ( m_RecursiveFlag )
+    {
+        UpdateLinksRecursive( parm_ptr );
+        return;
+    }
+
+    //==== Already Covered By The Current Pass, Or Queue A Pass Behind It ====//
+    if ( m_PropagateFlag )
+    {
+        int indx = FindLinkNode( pid );
+        if ( indx >= 0 && ( indx >= ( int )m_ReachedVec.size() || !m_ReachedVec[ indx ] ) )
+        {
+            m_PendingParmVec.push_back( pid );
+        }
+        return;
+    }
+
+    //==== Abort if No Links ====//
+    vector< string > pid_vec( 1, pid );
+    if ( !PropagateLinks( pid_vec ) )
+        return;
+
+    //==== Clean Up ====/
+    if ( start_flag )
+    {
+        Vehicle* veh = VehicleMgr.GetVehicle();
+        if ( veh )
+        {
+            veh->ParmChanged( parm_ptr, Parm::SET );
+        }
+    }
+}
+
+//==== Update Links Depth First - Only Used When The Links Contain A Loop ====//
+void LinkMgrSingleton::UpdateLinksRecursive( Parm* parm_ptr )
+{
+    string pid = parm_ptr->GetID();
+
     //==== Check For Advanced Links ====//
     bool adv_link_flag = AdvLinkMgr.IsInputParm( pid );
 
     //==== Look for Reg Links  ====//
     vector < Link* > parm_link_vec;
-    for ( int i = 0 ; i < ( int )m_LinkVec.size() ; i++ )
+    int indx = FindLinkNode( pid );
+    if ( indx >= 0 )
     {
-        if ( m_LinkVec[i]->GetParmA() == pid )
+        for ( int i = 0 ; i < ( int )m_LinkGraph[ indx ].m_OutLinks.size() ; i++ )
         {
-            parm_link_vec.push_back( m_LinkVec[i] );
+            if ( m_LinkGraph[ indx ].m_OutLinks[i] )
+            {
+                parm_link_vec.push_back( m_LinkGraph[ indx ].m_OutLinks[i] );
+            }
         }
     }
 
-    //==== Check Links ====//
-    bool reg_link_flag = false;
-    if ( parm_link_vec.size() )
-    {
-        reg_link_flag = true;
-    }
-
     //==== Abort if No Links ====//
-    if ( !adv_link_flag && !reg_link_flag )
+    if ( !adv_link_flag && parm_link_vec.empty() )
         return;
 
     //==== Set Link Update Flag ====//
     parm_ptr->SetLinkUpdateFlag( true );
-    m_UpdatedParmVec.push_back( parm_ptr->GetID() );
+    m_UpdatedParmVec.push_back( pid );
 
     //==== Update Linked Parms ====//
     for ( int i = 0 ; i < ( int )parm_link_vec.size() ; i++ )
@@ -461,30 +589,7 @@ void LinkMgrSingleton::ParmChanged( const string& pid, bool start_flag  )
 
         if ( pB && ! pB->GetLinkUpdateFlag() )       // Prevent Circular
         {
-            double offset = 0.0;
-            if ( pl->GetOffsetFlag() )
-            {
-                offset = pl->m_Offset();
-            }
-            double scale = 1.0;
-            if ( pl->GetScaleFlag() )
-            {
-                scale = pl->m_Scale();
-            }
-
-            double val = parm_ptr->Get() * scale + offset;
-
-            if ( pl->GetLowerLimitFlag() && val < pl->m_LowerLimit() )      // Constraints
-            {
-                val = pl->m_LowerLimit();
-            }
-
-            if ( pl->GetUpperLimitFlag() && val > pl->m_UpperLimit() )      // Constraints
-            {
-                val = pl->m_UpperLimit();
-            }
-
-            pB->SetFromLink( val );
+            pB->SetFromLink( LinkedValue( pl, parm_ptr->Get() ) );
         }
         else if ( pB )
         {
@@ -499,14 +604,7 @@ void LinkMgrSingleton::ParmChanged( const string& pid, bool start_flag  )
         }
         else
         {
-            MessageData errMsgData;
-            errMsgData.m_String = "Error";
-
-            errMsgData.m_IntVec.push_back( vsp::VSP_CANT_FIND_PARM );
-            char buf[255];
-            snprintf( buf, sizeof( buf ), "Error: Link Output parm '%s' not found.\n", pl->GetParmB().c_str() );
-            errMsgData.m_StringVec.emplace_back( string( buf ) );
-            MessageMgr::getInstance().SendAll( errMsgData );
+            SendMissingLinkParmMessage( pl->GetParmB() );
         }
     }
 
@@ -515,29 +613,399 @@ void LinkMgrSingleton::ParmChanged( const string& pid, bool start_flag  )
     {
         AdvLinkMgr.UpdateLinks( pid );
     }
+}
 
-    //==== Clean Up ====/
-    if ( start_flag )      
+//==== Push Changed Parms Through Everything Downstream Of Them, In Dependency Order ====//
+bool LinkMgrSingleton::PropagateLinks( const vector< string > & pid_vec )
+{
+    UpdateLinkGraph();
+
+    //==== Find Downstream Nodes ====//
+    m_ReachedVec.assign( m_LinkGraph.size(), 0 );
+
+    vector< int > stack;
+    vector< int > root_vec;
+    for ( int i = 0 ; i < ( int )pid_vec.size() ; i++ )
     {
-        for ( int i = 0 ; i < ( int )m_UpdatedParmVec.size() ; i++ )
+        int indx = FindLinkNode( pid_vec[i] );
+        if ( indx >= 0 && !m_ReachedVec[ indx ] && !m_LinkGraph[ indx ].m_OutNodes.empty() )
         {
-            Parm* p = ParmMgr.FindParm( m_UpdatedParmVec[i] );
+            m_ReachedVec[ indx ] = 1;
+            stack.push_back( indx );
+            root_vec.push_back( indx );
+        }
+    }
+
+    if ( root_vec.empty() )
+    {
+        m_ReachedVec.clear();
+        return false;
+    }
+
+    vector< int > reached_vec;
+    bool loop_flag = false;
+    while ( !stack.empty() )
+    {
+        int n = stack.back();
+        stack.pop_back();
+        reached_vec.push_back( n );
+
+        if ( m_LinkGraph[n].m_Order < 0 )
+        {
+            loop_flag = true;
+        }
+
+        for ( int i = 0 ; i < ( int )m_LinkGraph[n].m_OutNodes.size() ; i++ )
+        {
+            int out = m_LinkGraph[n].m_OutNodes[i];
+            if ( !m_ReachedVec[ out ] )
+            {
+                m_ReachedVec[ out ] = 1;
+                stack.push_back( out );
+            }
+        }
+    }
+
+    //==== No Order Through A Loop - Fall Back To Depth First With Loop Warnings ====//
+    if ( loop_flag )
+    {
+        m_ReachedVec.clear();
+        m_RecursiveFlag = true;
+
+        for ( int i = 0 ; i < ( int )root_vec.size() ; i++ )
+        {
+            Parm* p = ParmMgr.FindParm( m_LinkGraph[ root_vec[i] ].m_ParmID );
             if ( p )
             {
-                p->SetLinkUpdateFlag( false );
+                UpdateLinksRecursive( p );
             }
+            ClearLinkUpdateFlags();
         }
-        m_UpdatedParmVec.clear();
 
-        Vehicle* veh = VehicleMgr.GetVehicle();
-        if ( veh )
+        m_RecursiveFlag = false;
+        return true;
+    }
+
+    //==== Orders Are Unique - Bucket The Reached Nodes By Order ====//
+    vector< int > order_vec( m_LinkGraph.size(), -1 );
+    for ( int i = 0 ; i < ( int )reached_vec.size() ; i++ )
+    {
+        order_vec[ m_LinkGraph[ reached_vec[i] ].m_Order ] = reached_vec[i];
+    }
+
+    //==== Single Pass - Every Node Is Visited After Everything It Depends On ====//
+    vector< char > changed_vec( m_LinkGraph.size(), 0 );
+    for ( int i = 0 ; i < ( int )root_vec.size() ; i++ )
+    {
+        changed_vec[ root_vec[i] ] = 1;
+    }
+
+    m_PropagateFlag = true;
+    m_PendingParmVec.clear();
+
+    for ( int r = 0 ; r < ( int )order_vec.size() ; r++ )
+    {
+        int n = order_vec[r];
+        if ( n < 0 || !changed_vec[n] )
         {
-            veh->ParmChanged( parm_ptr, Parm::SET );
+            continue;
+        }
+
+        const LinkNode & node = m_LinkGraph[n];
+
+        if ( node.m_AdvLink )
+        {
+            //==== Run Advanced Link Once, After All Its Inputs Are Final ====//
+            vector< double > old_val_vec( node.m_OutNodes.size(), 0.0 );
+            for ( int i = 0 ; i < ( int )node.m_OutNodes.size() ; i++ )
+            {
+                Parm* p = ParmMgr.FindParm( m_LinkGraph[ node.m_OutNodes[i] ].m_ParmID );
+                if ( p )
+                {
+                    old_val_vec[i] = p->Get();
+                }
+            }
+
+            node.m_AdvLink->ForceUpdate();
+
+            for ( int i = 0 ; i < ( int )node.m_OutNodes.size() ; i++ )
+            {
+                Parm* p = ParmMgr.FindParm( m_LinkGraph[ node.m_OutNodes[i] ].m_ParmID );
+                if ( p && p->Get() != old_val_vec[i] )
+                {
+                    changed_vec[ node.m_OutNodes[i] ] = 1;
+                }
+            }
+        }
+        else
+        {
+            Parm* pA = ParmMgr.FindParm( node.m_ParmID );
+            if ( !pA )
+            {
+                continue;
+            }
+
+            for ( int i = 0 ; i < ( int )node.m_OutNodes.size() ; i++ )
+            {
+                Link* pl = node.m_OutLinks[i];
+                if ( !pl )
+                {
+                    changed_vec[ node.m_OutNodes[i] ] = 1;      // Input To Advanced Link
+                    continue;
+                }
+
+                Parm* pB = ParmMgr.FindParm( pl->GetParmB() );
+                if ( !pB )
+                {
+                    SendMissingLinkParmMessage( pl->GetParmB() );
+                    continue;
+                }
+
+                double old_val = pB->Get();
+                pB->SetFromLink( LinkedValue( pl, pA->Get() ) );
+
+                if ( pB->Get() != old_val )
+                {
+                    changed_vec[ node.m_OutNodes[i] ] = 1;
+                }
+            }
+        }
+    }
+
+    m_PropagateFlag = false;
+    m_ReachedVec.clear();
+
+    //==== Parms Changed From Scripts Outside This Pass Get Their Own ====//
+    if ( !m_PendingParmVec.empty() )
+    {
+        vector< string > pending_vec;
+        pending_vec.swap( m_PendingParmVec );
+        PropagateLinks( pending_vec );
+    }
+
+    return true;
+}
+
+//==== Find Graph Node For Parm ====//
+int LinkMgrSingleton::FindLinkNode( const string & pid )
+{
+    unordered_map< string, int >::const_iterator it = m_LinkGraphIndex.find( pid );
+    if ( it != m_LinkGraphIndex.end() )
+    {
+        return it->second;
+    }
+    return -1;
+}
+
+//==== Find Or Add Graph Node For Parm ====//
+int LinkMgrSingleton::AddLinkNode( const string & pid )
+{
+    int indx = FindLinkNode( pid );
+    if ( indx < 0 )
+    {
+        LinkNode node;
+        node.m_ParmID = pid;
+        node.m_AdvLink = nullptr;
+        node.m_Order = -1;
+
+        indx = ( int )m_LinkGraph.size();
+        m_LinkGraph.push_back( node );
+        m_LinkGraphIndex[ pid ] = indx;
+    }
+    return indx;
+}
+
+//==== Rebuild Link Graph If Links Or Parms Have Changed ====//
+void LinkMgrSingleton::UpdateLinkGraph()
+{
+    if ( m_LinkGraphDirty || m_LinkGraphParmStamp != ParmMgr.GetNumParmChanges() )
+    {
+        m_LinkGraphDirty = false;
+        m_LinkGraphParmStamp = ParmMgr.GetNumParmChanges();
+
+        m_LinkGraph.clear();
+        m_LinkGraphIndex.clear();
+
+        //==== Regular Links - Edge From A To B ====//
+        for ( int i = 0 ; i < ( int )m_LinkVec.size() ; i++ )
+        {
+            int a = AddLinkNode( m_LinkVec[i]->GetParmA() );
+            int b = AddLinkNode( m_LinkVec[i]->GetParmB() );
+            m_LinkGraph[a].m_OutNodes.push_back( b );
+            m_LinkGraph[a].m_OutLinks.push_back( m_LinkVec[i] );
+        }
+
+        //==== Advanced Links - Each Input Feeds The Link, The Link Feeds Each Output ====//
+        vector< AdvLink* > adv_vec = AdvLinkMgr.GetLinks();
+        for ( int i = 0 ; i < ( int )adv_vec.size() ; i++ )
+        {
+            LinkNode node;
+            node.m_AdvLink = adv_vec[i];
+            node.m_Order = -1;
+
+            int n = ( int )m_LinkGraph.size();
+            m_LinkGraph.push_back( node );
+
+            vector< VarDef > in_vec = adv_vec[i]->GetInputVars();
+            for ( int j = 0 ; j < ( int )in_vec.size() ; j++ )
+            {
+                if ( ParmMgr.FindParm( in_vec[j].m_ParmID ) )
+                {
+                    int in = AddLinkNode( in_vec[j].m_ParmID );
+                    m_LinkGraph[in].m_OutNodes.push_back( n );
+                    m_LinkGraph[in].m_OutLinks.push_back( nullptr );
+                }
+            }
+
+            vector< VarDef > out_vec = adv_vec[i]->GetOutputVars();
+            for ( int j = 0 ; j < ( int )out_vec.size() ; j++ )
+            {
+                if ( ParmMgr.FindParm( out_vec[j].m_ParmID ) )
+                {
+                    int out = AddLinkNode( out_vec[j].m_ParmID );
+                    m_LinkGraph[n].m_OutNodes.push_back( out );
+                    m_LinkGraph[n].m_OutLinks.push_back( nullptr );
+                }
+            }
+        }
+
+        m_LinkOrderDirty = true;
+    }
+
+    if ( !m_LinkOrderDirty )
+        return;
+
+    m_LinkOrderDirty = false;
+
+    //==== Topological Order - Nodes Left Unordered Are On Or Downstream Of A Loop ====//
+    vector< int > in_count( m_LinkGraph.size(), 0 );
+    for ( int i = 0 ; i < ( int )m_LinkGraph.size() ; i++ )
+    {
+        m_LinkGraph[i].m_Order = -1;
+        for ( int j = 0 ; j < ( int )m_LinkGraph[i].m_OutNodes.size() ; j++ )
+        {
+            in_count[ m_LinkGraph[i].m_OutNodes[j] ]++;
+        }
+    }
+
+    deque< int > ready;
+    for ( int i = 0 ; i < ( int )m_LinkGraph.size() ; i++ )
+    {
+        if ( in_count[i] == 0 )
+        {
+            ready.push_back( i );
+        }
+    }
+
+    int order = 0;
+    while ( !ready.empty() )
+    {
+        int n = ready.front();
+        ready.pop_front();
+        m_LinkGraph[n].m_Order = order++;
+
+        for ( int j = 0 ; j < ( int )m_LinkGraph[n].m_OutNodes.size() ; j++ )
+        {
+            int out = m_LinkGraph[n].m_OutNodes[j];
+            in_count[ out ]--;
+            if ( in_count[ out ] == 0 )
+            {
+                ready.push_back( out );
+            }
         }
     }
 }
 
+//==== Check If Linking pA To pB Would Close A Loop (pA Reachable From pB) ====//
+bool LinkMgrSingleton::CheckForLinkLoop( const string & pA, const string & pB )
+{
+    if ( pA == pB )
+    {
+        return true;
+    }
+
+    UpdateLinkGraph();
+
+    int start = FindLinkNode( pB );
+    int target = FindLinkNode( pA );
+    if ( start < 0 || target < 0 )
+    {
+        return false;
+    }
+
+    vector< char > visited( m_LinkGraph.size(), 0 );
+    vector< int > stack( 1, start );
+    visited[ start ] = 1;
+
+    while ( !stack.empty() )
+    {
+        int n = stack.back();
+        stack.pop_back();
 
+        if ( n == target )
+        {
+            return true;
+        }
+
+        for ( int i = 0 ; i < ( int )m_LinkGraph[n].m_OutNodes.size() ; i++ )
+        {
+            int out = m_LinkGraph[n].m_OutNodes[i];
+            if ( !visited[ out ] )
+            {
+                visited[ out ] = 1;
+                stack.push_back( out );
+            }
+        }
+    }
+
+    return false;
+}
+
+//==== Clear Circular Link Flags ====//
+void LinkMgrSingleton::ClearLinkUpdateFlags()
+{
+    for ( int i = 0 ; i < ( int )m_UpdatedParmVec.size() ; i++ )
+    {
+        Parm* p = ParmMgr.FindParm( m_UpdatedParmVec[i] );
+        if ( p )
+        {
+            p->SetLinkUpdateFlag( false );
+        }
+    }
+    m_UpdatedParmVec.clear();
+}
+
+//==== Start Deferring Link Updates ====//
+void LinkMgrSingleton::StartBatch()
+{
+    m_BatchFlag = true;
+    m_BatchParmVec.clear();
+}
+
+//==== Resolve Links For Every Parm Changed In The Batch ====//
+void LinkMgrSingleton::EndBatch()
+{
+    if ( !m_BatchFlag )
+        return;
+
+    m_BatchFlag = false;
+
+    //==== One Ordered Pass Over Everything Downstream Of The Batch ====//
+    vector< string > pid_vec;
+    pid_vec.swap( m_BatchParmVec );
+
+    //==== Link Targets Are Marked For Update Like The Batch Parms, Not Updated Per Link ====//
+    m_BatchResolveFlag = true;
+    bool link_flag = PropagateLinks( pid_vec );
+    m_BatchResolveFlag = false;
+
+    //==== Single Vehicle Notification For The Whole Batch ====//
+    Vehicle* veh = VehicleMgr.GetVehicle();
+    if ( veh && link_flag )
+    {
+        veh->ParmChanged( nullptr, Parm::SET );
+    }
+}
 
 void LinkMgrSingleton::SetParm( bool flagA, string parm_id )
 {
@@ -817,9 +1285,11 @@ bool LinkNameCompareB( const Link *lnkA, const Link *lnkB )
 void LinkMgrSingleton::SortLinksByA()
 {
     std::sort( m_LinkVec.begin(), m_LinkVec.end(), LinkNameCompareA );
+    m_LinkGraphDirty = true;
 }
 
 void LinkMgrSingleton::SortLinksByB()
 {
     std::sort( m_LinkVec.begin(), m_LinkVec.end(), LinkNameCompareB );
+    m_LinkGraphDirty = true;
 }
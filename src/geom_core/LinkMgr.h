@@ -15,10 +15,14 @@
 #include "UserParmContainer.h"
 #include <deque>
 #include <set>
+#include <unordered_map>
 using std::string;
 using std::vector;
 using std::deque;
 using std::set;
+using std::unordered_map;
+
+class AdvLink;
 
 //==== Parm Link Manager ====//
 class LinkMgrSingleton
@@ -47,7 +51,7 @@ public:
     virtual bool UsedInLink( const string & pid );
 
     virtual bool AddLink( const string& pA, const string& pB, bool init_link_parms = true );         // Link Two Parms
-    virtual void AddLink( Link* link )                      {  m_LinkVec.push_back( link ); }
+    virtual void AddLink( Link* link )                      {  m_LinkVec.push_back( link ); m_LinkGraphDirty = true; }
     virtual void ParmChanged( const string& pid, bool start_flag );     // A Parm Has Changed Check Links
 
     virtual void SetCurrLinkIndex( int i )                  { m_CurrLinkIndex = i; }
@@ -107,6 +111,25 @@ public:
         return m_FreezeUpdateFlag;
     }
 
+    //==== Batch Parm Changes - Links Are Resolved Once At EndBatch ====//
+    void StartBatch();
+    void EndBatch();
+    bool InBatch() const
+    {
+        return m_BatchFlag;
+    }
+    bool InBatchResolve() const
+    {
+        return m_BatchResolveFlag;
+    }
+
+    //==== Link Dependency Graph - Rebuilt On Next Use ====//
+    void InvalidateLinkGraph()
+    {
+        m_LinkGraphDirty = true;
+    }
+    bool CheckForLinkLoop( const string & pA, const string & pB );     // Would Linking pA To pB Create A Loop
+
 private:
 
     LinkMgrSingleton();
@@ -127,6 +150,39 @@ private:
 
     vector< string > m_UpdatedParmVec;      // Keep Track Of Linked Parm To Prevent Circular Links
 
+    bool m_BatchFlag;                       // Defer link updates until EndBatch
+    vector< string > m_BatchParmVec;        // Parms changed during the batch, in order
+    bool m_BatchResolveFlag;                // EndBatch is running links - targets wait for the batch's one update
+
+    void ClearLinkUpdateFlags();
+
+    //==== Link Dependency Graph - Parms And Advanced Links Are The Nodes ====//
+    struct LinkNode
+    {
+        string m_ParmID;                    // Empty For Advanced Link Nodes
+        AdvLink* m_AdvLink;                 // Null For Parm Nodes
+        vector< int > m_OutNodes;           // Downstream Nodes
+        vector< Link* > m_OutLinks;         // Link To Each Downstream Node, Null Into/Out Of Advanced Links
+        int m_Order;                        // Topological Order, -1 If On Or Below A Loop
+    };
+
+    vector< LinkNode > m_LinkGraph;
+    unordered_map< string, int > m_LinkGraphIndex;  // Parm ID To Node
+    bool m_LinkGraphDirty;
+    bool m_LinkOrderDirty;
+    int m_LinkGraphParmStamp;
+
+    bool m_PropagateFlag;                   // Inside An Ordered Propagation Pass
+    bool m_RecursiveFlag;                   // Inside A Recursive (Loop) Propagation
+    vector< char > m_ReachedVec;            // Nodes Covered By The Current Pass
+    vector< string > m_PendingParmVec;      // Parms Changed Outside The Current Pass
+
+    void UpdateLinkGraph();
+    int FindLinkNode( const string & pid );
+    int AddLinkNode( const string & pid );
+    bool PropagateLinks( const vector< string > & pid_vec );
+    void UpdateLinksRecursive( Parm* parm_ptr );
+
     vector< string > m_BaseLinkableContainers;              // Base Registered Parm Containers
     vector< string > m_LinkableContainers;                  // All valid Linkable Container
 
@@ -620,6 +620,19 @@ void MaterialMgrSingleton::AddMaterial( const Material &mat )
     }
 }
 
+void MaterialMgrSingleton::Renew()
+{
+    std::vector< Material > lib_materials;
+    for( int i = 0; i < (int)m_Materials.size(); i++ )
+    {
+        if( !m_Materials[i].m_UserMaterial )
+        {
+            lib_materials.push_back( m_Materials[i] );
+        }
+    }
+    m_Materials.swap( lib_materials );
+}
+
 xmlNodePtr MaterialMgrSingleton::EncodeXml( xmlNodePtr & node )
 {
     xmlNodePtr materials_node = xmlNewChild( node, nullptr, BAD_CAST "Materials", nullptr );
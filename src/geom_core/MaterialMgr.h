@@ -73,6 +73,9 @@ public:
 
     void AddMaterial( const Material &mat );
 
+    // Removes the user materials, which belong to the model rather than the library.
+    void Renew();
+
     virtual xmlNodePtr EncodeXml( xmlNodePtr & node );
     virtual xmlNodePtr DecodeXml( xmlNodePtr & node );
 
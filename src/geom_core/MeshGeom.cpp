@@ -29,6 +29,7 @@
 #include "StlHelper.h"
 
 #include "SubSurfaceMgr.h"
+#include "TMeshSection.h"
 #include "VspUtil.h"
 #include <cstdio>
 #include <cstdlib>
@@ -1717,53 +1718,31 @@ void MeshGeom::WaveDragSlice( int numSlices, double sliceAngle, int coneSections
         WaveDragMgr.m_XNorm[islice] = ( ( double )islice / ( double )( numSlices - 1 ) );
     }
 
-    //==== Build Slice Mesh Object =====//
+    //==== Cutting Planes, Slice Major Then Theta ====//
+    vector < vec3d > orgs;
+    vector < vec3d > norms;
+    orgs.reserve( numSlices * coneSections + 2 );
+    norms.reserve( numSlices * coneSections + 2 );
+
     for ( int islice = 0 ; islice < numSlices ; islice++ )
     {
         // For number of rotation sections, rotate  slices about x-axis
         for ( int itheta = 0; itheta < coneSections; itheta++ )
         {
-            TMesh* tm = new TMesh();
-            m_SliceVec.push_back( tm );
-
-            tm->m_ThickSurf = false;
-            tm->m_SurfCfdType = vsp::CFD_STRUCTURE;
-
             // Location of theta slices on x-axis
             double xcenter = WaveDragMgr.m_StartX[itheta] + WaveDragMgr.m_XNorm[islice] * ( WaveDragMgr.m_EndX[itheta] - WaveDragMgr.m_StartX[itheta] );
 
             // Current theta (checks for XZ symmetry option)
             double theta = WaveDragMgr.m_ThetaRad[itheta];
 
-            // Establish generic plane
-            const unsigned int ngp = 4;
-            vector< vec3d > gp(ngp);
-            gp[0].set_xyz( 0,  2.5*size,  2.5*size );
-            gp[1].set_xyz( 0, -2.5*size,  2.5*size );
-            gp[2].set_xyz( 0, -2.5*size, -2.5*size );
-            gp[3].set_xyz( 0,  2.5*size, -2.5*size );
+            vec3d norm( 1, 0, 0 );
+            // Rotate plane to Mach angle
+            norm.rotate_y( -( 0.5 * M_PI - sliceAngle ) );
+            // Rotate plane to current theta
+            norm.rotate_x( theta );
 
-            for ( int m = 0; m < ngp; m++ )
-            {
-                // Rotate plane to Mach angle
-                gp[m].rotate_y( -( 0.5 * M_PI - sliceAngle ) );
-                // Rotate plane to current theta
-                gp[m].rotate_x( theta );
-                // Translate plane to current x
-                gp[m].offset_x( xcenter );
-                // Relocate to center YZ
-                gp[m].offset_y( center.y() );
-                gp[m].offset_z( center.z() );
-            }
-
-            // Get plane normal
-            vec3d gpnorm = cross( gp[3]-gp[2], gp[1]-gp[2] );
-            gpnorm.normalize();
-
-            // Build triangles
-            tm->AddTri( gp[ 2 ], gp[ 3 ], gp[ 0 ], gpnorm, iQuad );
-            tm->AddTri( gp[ 2 ], gp[ 0 ], gp[ 1 ], gpnorm, iQuad );
-            iQuad++;
+            orgs.push_back( vec3d( xcenter, center.y(), center.z() ) );
+            norms.push_back( norm );
         }
     }
 
@@ -1780,77 +1759,39 @@ void MeshGeom::WaveDragSlice( int numSlices, double sliceAngle, int coneSections
         tubeslicesX.push_back( tubeend + 0.001 );
     }
 
-    //==== Build Tube Slice Mesh Objects =====//
     for ( int itube = 0 ; itube < tubeslicesX.size() ; itube++ )
     {
-        TMesh* tm = new TMesh();
-        m_SliceVec.push_back( tm );
-
-        tm->m_ThickSurf = false;
-        tm->m_SurfCfdType = vsp::CFD_STRUCTURE;
-
-        // Location of theta slices on x-axis
-        double xcenter = (double)tubeslicesX[itube];
-
-        // Establish generic plane
-        const unsigned int ngp = 4;
-        vector< vec3d > gp(ngp);
-        gp[0].set_xyz( 0,  2.5*size,  2.5*size );
-        gp[1].set_xyz( 0, -2.5*size,  2.5*size );
-        gp[2].set_xyz( 0, -2.5*size, -2.5*size );
-        gp[3].set_xyz( 0,  2.5*size, -2.5*size );
-
-        // Get plane normal
-        vec3d gpnorm = cross( gp[3]-gp[2], gp[1]-gp[2] );
-        gpnorm.normalize();
-
-        // Move plane to current slice section location
-        for ( int m = 0; m < ngp; m++ )
-        {
-            // Translate plane to current x
-            gp[m].offset_x( xcenter );
-            // Relocate to center YZ
-            gp[m].offset_y( center.y() );
-            gp[m].offset_z( center.z() );
-        }
-
-        // Build triangles
-        tm->AddTri( gp[ 2 ], gp[ 3 ], gp[ 0 ], gpnorm, iQuad );
-        tm->AddTri( gp[ 2 ], gp[ 0 ], gp[ 1 ], gpnorm, iQuad );
-        iQuad++;
+        orgs.push_back( vec3d( tubeslicesX[itube], center.y(), center.z() ) );
+        norms.push_back( vec3d( 1, 0, 0 ) );
     }
 
-    // Fill vector of cfdtypes so we don't have to pass TMeshVec all the way down.
-    vector < int > bTypes( m_TMeshVec.size() );
-    vector < bool > thicksurf( m_TMeshVec.size() );
-    for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        bTypes[i] = m_TMeshVec[i]->m_SurfCfdType;
-        thicksurf[i] = m_TMeshVec[i]->m_ThickSurf;
-    }
+    //==== Cut All Planes Directly, In Parallel ====//
+    TMeshSectionEngine engine( m_TMeshVec );
+    vector < TMeshSection > secs;
+    engine.Section( orgs, norms, vsp::CFD_STRUCTURE, secs, true );
 
-    //==== Load Bnding Box ====//
-    for ( int islice = 0 ; islice < ( int )m_SliceVec.size() ; islice++ )
+    //==== Areas Come From The Regions, Only The Drawn Slice Misses Failed Triangulations ====//
+    int num_tri_fail = 0;
+    string tri_fail_id;
+    for ( int isec = 0 ; isec < ( int )secs.size() ; isec++ )
     {
-        TMesh* tm = m_SliceVec[islice];
-        tm->LoadBndBox();
-
-        //==== Intersect All Mesh Geoms ====//
-        for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+        if ( !secs[isec].m_TriFailMesh.empty() && num_tri_fail == 0 )
         {
-            tm->Intersect( m_TMeshVec[i] );
-
-            m_TMeshVec[i]->RemoveIsectEdges();
+            tri_fail_id = engine.GetMeshGeomID( secs[isec].m_TriFailMesh[0] );
         }
+        num_tri_fail += ( int )secs[isec].m_TriFailMesh.size();
+    }
 
-        //==== Split Intersected Tri in Mesh ====//
-        tm->Split();
-
-        //==== Determine Which Triangles Are Interior/Exterior ====//
-        tm->DeterIntExt( m_TMeshVec );
-
-        //==== Mark which triangles to ignore ====//
-        tm->SetIgnoreTriFlag( bTypes, thicksurf );
+    if ( num_tri_fail > 0 )
+    {
+        MessageData errMsgData;
+        errMsgData.m_String = "Error";
+        errMsgData.m_IntVec.push_back( vsp::VSP_UNKNOWN );
+        char buf[255];
+        snprintf( buf, sizeof( buf ), "Error:  %d wave drag slice regions could not be triangulated, first in %s.  Slice areas are unaffected, the regions are left out of the slice meshes.",
+                  num_tri_fail, tri_fail_id.c_str() );
+        errMsgData.m_StringVec.emplace_back( string( buf ) );
+        MessageMgr::getInstance().SendAll( errMsgData );
     }
 
     //==== Pushback slice and area results ====//
@@ -1861,14 +1802,28 @@ void MeshGeom::WaveDragSlice( int numSlices, double sliceAngle, int coneSections
         compIdMap[ compIdVec[icomp] ] = icomp;
     }
 
-    m_SliceVec[numSlices*coneSections]->m_CompAreaVec.resize( compIdVec.size() );
-    double inA = m_SliceVec[numSlices*coneSections]->ComputeWaveDragArea( compIdMap );
-    WaveDragMgr.m_InletArea = inA;
+    // Wave drag uses area projected onto the YZ plane.
+    for ( int isec = 0 ; isec < ( int )secs.size() ; isec++ )
+    {
+        double yzfactor = std::abs( secs[isec].m_Norm.x() );
 
-    m_SliceVec[numSlices*coneSections+1]->m_CompAreaVec.resize( compIdVec.size() );
-    double exA = m_SliceVec[numSlices*coneSections+1]->ComputeWaveDragArea( compIdMap );
-    WaveDragMgr.m_ExitArea = exA;
+        TMesh* tm = engine.MakeSliceTMesh( secs[isec], vsp::CFD_STRUCTURE );
+        m_SliceVec.push_back( tm );
+
+        tm->m_WetArea = secs[isec].m_Area * yzfactor;
+        tm->m_CompAreaVec.resize( compIdVec.size(), 0.0 );
+        for ( int m = 0 ; m < engine.GetNumMeshes() ; m++ )
+        {
+            std::unordered_map<string, int>::const_iterator it = compIdMap.find( engine.GetMeshGeomID( m ) );
+            if ( it != compIdMap.end() )
+            {
+                tm->m_CompAreaVec[ it->second ] += secs[isec].m_MeshArea[m] * yzfactor;
+            }
+        }
+    }
 
+    WaveDragMgr.m_InletArea = m_SliceVec[numSlices*coneSections]->m_WetArea;
+    WaveDragMgr.m_ExitArea = m_SliceVec[numSlices*coneSections+1]->m_WetArea;
 
     for ( int islice = 0 ; islice < numSlices ; islice++ )
     {
@@ -1876,9 +1831,6 @@ void MeshGeom::WaveDragSlice( int numSlices, double sliceAngle, int coneSections
         {
             int sindex = ( int )( islice * coneSections + itheta );
 
-            m_SliceVec[sindex]->m_CompAreaVec.resize( compIdVec.size() );
-            m_SliceVec[sindex]->ComputeWaveDragArea( compIdMap );
-
             for ( int icomp = 0; icomp < compIdVec.size(); icomp++ )
             {
                 WaveDragMgr.m_CompSliceAreaDist[itheta][icomp][islice]= m_SliceVec[sindex]->m_CompAreaVec[icomp];
@@ -240,7 +240,8 @@ double Parm::SetFromLink( double val )
 
     if ( m_Container )
     {
-        m_Container->ParmChanged( this, SET_FROM_LINK );
+        //==== Inside A Batch The Container Updates Once With The Batch ====//
+        m_Container->ParmChanged( this, LinkMgr.InBatchResolve() ? SET : SET_FROM_LINK );
     }
 
     return m_Val;
@@ -346,8 +347,6 @@ void Parm::DecodeXml( xmlNodePtr & node, bool detailed )
 {
     xmlNodePtr n;
 
-    double val = m_Val;
-
     if ( detailed )
     {
          n = node;
@@ -357,6 +356,14 @@ void Parm::DecodeXml( xmlNodePtr & node, bool detailed )
          n = XmlUtil::GetNode( node, m_Name.c_str(), 0 );
     }
 
+    DecodeNode( n, detailed );
+}
+
+//==== Decode From This Parm's Own Node, Already Found By Caller ====//
+void Parm::DecodeNode( xmlNodePtr n, bool detailed )
+{
+    double val = m_Val;
+
     if ( n )
     {
         val = XmlUtil::FindDoubleProp( n, "Value", m_Val );
@@ -386,6 +393,24 @@ void Parm::DecodeXml( xmlNodePtr & node, bool detailed )
     Set( val );
 }
 
+//==== Decode Directly From Source Parm - Same Result As Non-Detailed DecodeXml ====//
+void Parm::DecodeFrom( Parm* src )
+{
+    if ( !src )
+    {
+        return;
+    }
+
+    string newID = ParmMgr.RemapID( src->GetID(), m_ID );
+
+    if( newID.compare( m_ID ) != 0 )        // they differ
+    {
+        ChangeID( newID );
+    }
+
+    Set( src->Get() );
+}
+
 ParmContainer* Parm::GetLinkContainer() const
 {
     string id = GetLinkContainerID();
@@ -582,10 +607,18 @@ bool NotEqParm::SetValCheckLimits( double val )
 }
 
 //==== Decode Data To XML Data Structure ====//
-void NotEqParm::DecodeXml( xmlNodePtr & node, bool detailed )
+void NotEqParm::DecodeNode( xmlNodePtr n, bool detailed )
+{
+    m_CheckFlag = false;
+    Parm::DecodeNode( n, detailed );
+    m_CheckFlag = true;
+}
+
+//==== Decode Directly From Source Parm ====//
+void NotEqParm::DecodeFrom( Parm* src )
 {
     m_CheckFlag = false;
-    Parm::DecodeXml( node, detailed );
+    Parm::DecodeFrom( src );
     m_CheckFlag = true;
 }
 
@@ -688,7 +721,7 @@ double FractionParm::SetFromLink( double val )
 
     if ( m_Container )
     {
-        m_Container->ParmChanged( this, SET_FROM_LINK );
+        m_Container->ParmChanged( this, LinkMgr.InBatchResolve() ? SET : SET_FROM_LINK );
     }
 
 
@@ -163,6 +163,8 @@ public:
 
     virtual void EncodeXml( xmlNodePtr & node, bool detailed = false );
     virtual void DecodeXml( xmlNodePtr & node, bool detailed = false );
+    virtual void DecodeNode( xmlNodePtr n, bool detailed = false );
+    virtual void DecodeFrom( Parm* src );
 
     AttributeCollection* GetAttrCollection()
     {
@@ -331,7 +333,8 @@ public:
         m_Tol = tol;
     }
 
-    virtual void DecodeXml( xmlNodePtr & node, bool detailed = false );
+    virtual void DecodeNode( xmlNodePtr n, bool detailed = false );
+    virtual void DecodeFrom( Parm* src );
 
 protected:
     string m_OtherParmID;
@@ -166,6 +166,22 @@ void ParmContainer::SetName( const string& name, bool removeslashes )
     m_Name = temp_name;
 }
 
+//==== Name Compare ====//
+bool ParmNameCompare( const std::pair< string, string >& a, const std::pair< string, string >& b )
+{
+    return a.second < b.second;
+}
+
+//==== Find Container A Direct Copy Node Was Encoded From ====//
+ParmContainer* ParmContainer::FindDirectCopySrc( xmlNodePtr & child_node )
+{
+    if ( child_node && XmlUtil::FindInt( child_node, "DirectCopy", 0 ) )
+    {
+        return ParmMgr.FindParmContainer( XmlUtil::FindString( child_node, "ID", string() ) );
+    }
+    return nullptr;
+}
+
 //==== Encode Data Into XML Data Struct ====//
 xmlNodePtr ParmContainer::EncodeXml( xmlNodePtr & node )
 {
@@ -177,6 +193,13 @@ xmlNodePtr ParmContainer::EncodeXml( xmlNodePtr & node )
         m_AttrCollection.EncodeXml( parmcontain_node );
     }
 
+    //==== Direct Copy - Parm Values Are Read From This Container When Decoded ====//
+    bool direct_flag = ParmMgr.GetDirectCopyFlag() && ParmMgr.FindParmContainer( m_ID ) == this;
+    if ( direct_flag && parmcontain_node )
+    {
+        XmlUtil::AddIntNode( parmcontain_node, "DirectCopy", 1 );
+    }
+
     xmlNodePtr gnode;
 
     LoadGroupParmVec( m_ParmVec, false );
@@ -186,18 +209,30 @@ xmlNodePtr ParmContainer::EncodeXml( xmlNodePtr & node )
     for ( groupIter = m_GroupParmMap.begin() ; groupIter != m_GroupParmMap.end() ; ++groupIter )
     {
         string name = groupIter->first;
-        gnode = xmlNewChild( parmcontain_node, nullptr, BAD_CAST name.c_str(), nullptr );
+        gnode = nullptr;
 
-        if ( gnode )
+        if ( !direct_flag )
         {
-            vector< std::pair< string, string > >::iterator parmIter;
-            for ( parmIter = groupIter->second.begin(); parmIter != groupIter->second.end(); ++parmIter )
+            gnode = xmlNewChild( parmcontain_node, nullptr, BAD_CAST name.c_str(), nullptr );
+        }
+
+        vector< std::pair< string, string > >::iterator parmIter;
+        for ( parmIter = groupIter->second.begin(); parmIter != groupIter->second.end(); ++parmIter )
+        {
+            string parmID = parmIter->first;
+            Parm* p = ParmMgr.FindParm( parmID );
+            if ( p )
             {
-                string parmID = parmIter->first;
-                Parm* p = ParmMgr.FindParm( parmID );
-                if ( p )
+                // Parms carrying attributes still go through XML when copied directly
+                bool attr_flag = p->m_ParmAttrCollection.GetNumAttrs() > 0;
+                if ( direct_flag && attr_flag && !gnode )
                 {
-                    p->EncodeXml(gnode);
+                    gnode = xmlNewChild( parmcontain_node, nullptr, BAD_CAST name.c_str(), nullptr );
+                }
+
+                if ( gnode && ( !direct_flag || attr_flag ) )
+                {
+                    p->EncodeXml( gnode );
                 }
             }
         }
@@ -209,10 +244,15 @@ xmlNodePtr ParmContainer::EncodeXml( xmlNodePtr & node )
 //==== Decode Data From XML Data Struct ====//
 xmlNodePtr ParmContainer::DecodeXml( xmlNodePtr & node )
 {
+    ParmContainer* src = nullptr;
+
     xmlNodePtr child_node = XmlUtil::GetNode( node, "ParmContainer", 0 );
     if ( child_node )
     {
         string oldID = XmlUtil::FindString( child_node, "ID", m_ID );
+
+        src = FindDirectCopySrc( child_node );
+
         string newID = ParmMgr.RemapID( oldID, m_ID );
 
         if( newID.compare( m_ID ) != 0 )        // they differ
@@ -228,13 +268,42 @@ xmlNodePtr ParmContainer::DecodeXml( xmlNodePtr & node )
     LoadGroupParmVec( m_ParmVec, false );
     ParmMgr.IncNumParmChanges();
 
+    if ( src && src != this )
+    {
+        src->LoadGroupParmVec( src->m_ParmVec, false );
+    }
+    else
+    {
+        src = nullptr;
+    }
+
+    //==== Hashed Lookup Of Group And Parm Nodes By Name ====//
+    unordered_map< string, xmlNodePtr > group_node_map;
+    unordered_map< string, xmlNodePtr > parm_node_map;
+    XmlUtil::BuildChildNodeMap( child_node, group_node_map );
+
     unordered_map< string, vector< std::pair< string, string > > >::iterator groupIter;
     for ( groupIter = m_GroupParmMap.begin() ; groupIter != m_GroupParmMap.end() ; ++groupIter )
     {
         string name = groupIter->first;
-        gnode = XmlUtil::GetNode( child_node, name.c_str(), 0 );
 
-        if ( gnode )
+        unordered_map< string, xmlNodePtr >::iterator node_iter = group_node_map.find( name );
+        gnode = ( node_iter != group_node_map.end() ) ? node_iter->second : nullptr;
+
+        XmlUtil::BuildChildNodeMap( gnode, parm_node_map );
+
+        //==== Matching Source Group For Direct Copy ====//
+        vector< std::pair< string, string > >* src_group = nullptr;
+        if ( src )
+        {
+            unordered_map< string, vector< std::pair< string, string > > >::iterator src_iter = src->m_GroupParmMap.find( name );
+            if ( src_iter != src->m_GroupParmMap.end() )
+            {
+                src_group = &src_iter->second;
+            }
+        }
+
+        if ( gnode || src_group )
         {
             vector< std::pair< string, string > >::iterator parmIter;
             for ( parmIter = groupIter->second.begin(); parmIter != groupIter->second.end(); ++parmIter )
@@ -243,7 +312,24 @@ xmlNodePtr ParmContainer::DecodeXml( xmlNodePtr & node )
                 Parm* p = ParmMgr.FindParm( parmID );
                 if ( p )
                 {
-                    p->DecodeXml( gnode );
+                    node_iter = parm_node_map.find( p->GetName() );
+                    xmlNodePtr pnode = ( node_iter != parm_node_map.end() ) ? node_iter->second : nullptr;
+
+                    if ( pnode || !src_group )
+                    {
+                        p->DecodeNode( pnode );
+                    }
+                    else
+                    {
+                        // Group vectors are sorted by name, so this finds the same parm the XML lookup would
+                        vector< std::pair< string, string > >::iterator src_parm_iter =
+                            lower_bound( src_group->begin(), src_group->end(), *parmIter, ParmNameCompare );
+
+                        if ( src_parm_iter != src_group->end() && src_parm_iter->second == parmIter->second )
+                        {
+                            p->DecodeFrom( ParmMgr.FindParm( src_parm_iter->first ) );
+                        }
+                    }
                 }
             }
         }
@@ -254,12 +340,6 @@ xmlNodePtr ParmContainer::DecodeXml( xmlNodePtr & node )
 
 }
 
-//==== Name Compare ====//
-bool ParmNameCompare( const std::pair< string, string >& a, const std::pair< string, string >& b )
-{
-    return a.second < b.second;
-}
-
 //==== Load Parm Vec, Find Groups And Sort ====//
 void ParmContainer::LoadGroupParmVec( vector< string > & parm_vec, bool displaynames )
 {
@@ -121,6 +121,8 @@ protected:
     virtual void LoadGroupParmVec( vector< string > & parm_vec );
     virtual void LoadGroupParmVec( vector< string > & parm_vec, bool displaynames );
 
+    ParmContainer* FindDirectCopySrc( xmlNodePtr & child_node );
+
     virtual void ChangeID( const string &id );
 
 };
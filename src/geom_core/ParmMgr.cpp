@@ -24,6 +24,8 @@ ParmMgrSingleton::ParmMgrSingleton()
     m_LastUndoFlag = false;
     m_LastReset = "";
     m_DirtyFlag = true;
+    m_DirectCopyFlag = false;
+    m_DirectCopyEnabled = true;
 }
 
 //==== Add Parm To Map ====//
@@ -128,6 +130,25 @@ ParmContainer* ParmMgrSingleton::FindParmContainer( const string & id )
     return nullptr;
 }
 
+//==== Get IDs And Values Of All Registered Parms ====//
+void ParmMgrSingleton::GetAllParmVals( vector< string > & id_vec, vector< double > & val_vec )
+{
+    id_vec.clear();
+    val_vec.clear();
+    id_vec.reserve( m_ParmMap.size() );
+    val_vec.reserve( m_ParmMap.size() );
+
+    unordered_map< string, Parm* >::iterator iter;
+    for ( iter = m_ParmMap.begin() ; iter != m_ParmMap.end() ; ++iter )
+    {
+        if ( iter->second )
+        {
+            id_vec.push_back( iter->first );
+            val_vec.push_back( iter->second->Get() );
+        }
+    }
+}
+
 bool ParmMgrSingleton::ValidateParmMap()
 {
     bool pass = true;
@@ -47,6 +47,8 @@ private:
     int m_ChangeCnt;
 
     bool m_DirtyFlag;
+    bool m_DirectCopyFlag;                                          // Encode parm values for direct in-memory copy
+    bool m_DirectCopyEnabled;                                       // Geom::CopyFrom may use direct copy
 
     string RemapID( const string & oldID, const string & suggestID, int size );
 
@@ -64,6 +66,7 @@ public:
 
     Parm* FindParm( const string & id );
     ParmContainer* FindParmContainer( const string & id );
+    void GetAllParmVals( vector< string > & id_vec, vector< double > & val_vec );
 
     bool ValidateParmMap();
     bool ValidateParmContainerMap();
@@ -92,6 +95,14 @@ public:
     bool GetDirtyFlag()                     { return m_DirtyFlag; }
     void SetDirtyFlag( bool flag )          { m_DirtyFlag = flag; }
 
+    //==== Direct Copy - Parm Values Are Read From The Source Container Instead Of XML ====//
+    bool GetDirectCopyFlag()                { return m_DirectCopyFlag; }
+    void SetDirectCopyFlag( bool flag )     { m_DirectCopyFlag = flag; }
+
+    //==== Turning Direct Copy Off Sends Every Parm Value Through XML Again ====//
+    bool GetDirectCopyEnabled()             { return m_DirectCopyEnabled; }
+    void SetDirectCopyEnabled( bool flag )  { m_DirectCopyEnabled = flag; }
+
 };
 
 #define ParmMgr ParmMgrSingleton::getInstance()
@@ -23,6 +23,10 @@
 #include "delabella.h"
 
 #include "StlHelper.h"
+#include "ParallelUtil.h"
+
+#define PATH_PARALLEL_CHUNK 1024     // Triangles converted to paths per thread.
+#define UNION_TREE_CHUNK 2048        // Paths per leaf of a tree-reduced union.
 
 //==== Constructor ====//
 ProjectionMgrSingleton::ProjectionMgrSingleton()
@@ -1186,23 +1190,29 @@ void ProjectionMgrSingleton::MeshToPaths( const vector < TMesh* > & tmv, Clipper
     unsigned int itri = 0;
     for ( unsigned int i = 0 ; i < ( int )tmv.size() ; i++ )
     {
-        for ( int j = 0 ; j < ( int )tmv[i]->m_TVec.size() ; j++ )
-        {
-            pths[itri].resize(3);
+        const vector < TTri* > &tvec = tmv[i]->m_TVec;
+        Clipper2Lib::Path64 *tpths = &pths[itri];
 
-            for ( int k = 0; k < 3; k++ )
+        ParallelFor( tvec.size(), PATH_PARALLEL_CHUNK, [&]( int begin, int end )
+        {
+            for ( int j = begin ; j < end ; j++ )
             {
-                vec3d p = tmv[i]->m_TVec[j]->GetTriNode( k )->m_Pnt;
-                pths[itri][k] = Clipper2Lib::Point64( (int64_t) p.y(), (int64_t) p.z() );
-            }
+                tpths[j].resize( 3 );
 
-            if ( !Clipper2Lib::IsPositive( pths[itri] ) )
-            {
-                std::reverse( pths[itri].begin(), pths[itri].end() );
+                for ( int k = 0; k < 3; k++ )
+                {
+                    vec3d p = tvec[j]->GetTriNode( k )->m_Pnt;
+                    tpths[j][k] = Clipper2Lib::Point64( (int64_t) p.y(), (int64_t) p.z() );
+                }
+
+                if ( !Clipper2Lib::IsPositive( tpths[j] ) )
+                {
+                    std::reverse( tpths[j].begin(), tpths[j].end() );
+                }
             }
+        } );
 
-            itri++;
-        }
+        itri += tvec.size();
     }
 }
 
@@ -1277,109 +1287,125 @@ void ProjectionMgrSingleton::MeshToPathsVec( const vector < TMesh* > & tmv, vect
 
     for ( int i = 0 ; i < ( int )tmv.size() ; i++ )
     {
-        pthvec[i].resize( tmv[i]->m_TVec.size() );
+        const vector < TTri* > &tvec = tmv[i]->m_TVec;
+        Clipper2Lib::Paths64 &pths = pthvec[i];
+
+        pths.resize( tvec.size() );
         ids[i] = tmv[i]->m_OriginGeomID;
 
-        for ( int j = 0 ; j < ( int )tmv[i]->m_TVec.size() ; j++ )
+        ParallelFor( tvec.size(), PATH_PARALLEL_CHUNK, [&]( int begin, int end )
         {
-            pthvec[i][j].resize( 3 );
-
-            for ( int k = 0; k < 3; k++ )
+            for ( int j = begin ; j < end ; j++ )
             {
-                vec3d p = tmv[i]->m_TVec[j]->GetTriNode( k )->m_Pnt;
-                pthvec[i][j][k] = Clipper2Lib::Point64( (int64_t) p.v[keepdir1], (int64_t) p.v[keepdir2] );
-            }
+                pths[j].resize( 3 );
 
-            if ( !Clipper2Lib::IsPositive( pthvec[i][j] ) )
-            {
-                std::reverse( pthvec[i][j].begin(), pthvec[i][j].end() );
+                for ( int k = 0; k < 3; k++ )
+                {
+                    vec3d p = tvec[j]->GetTriNode( k )->m_Pnt;
+                    pths[j][k] = Clipper2Lib::Point64( (int64_t) p.v[keepdir1], (int64_t) p.v[keepdir2] );
+                }
+
+                if ( !Clipper2Lib::IsPositive( pths[j] ) )
+                {
+                    std::reverse( pths[j].begin(), pths[j].end() );
+                }
             }
-        }
+        } );
     }
 }
 
 void ProjectionMgrSingleton::MeshToSphericalPathsVec( TMesh* tm, Clipper2Lib::Paths64 & pth )
 {
-    pth.resize( tm->m_TVec.size() );
+    const vector < TTri* > &tvec = tm->m_TVec;
+    pth.resize( tvec.size() );
 
     constexpr double thtol = 1.0 * M_PI / 180.0; // degrees of arc per edge.
 
     double tol = 1e-6;
-    Clipper2Lib::Paths64 polepths;
 
-    for ( int j = 0 ; j < ( int )tm->m_TVec.size() ; j++ )
-    {
-        TTri *t = tm->m_TVec[j];
-
-        vector < vec3d > ptlist;
+    // Pole fill triangles are kept per source triangle so they append in a fixed order.
+    vector < Clipper2Lib::Paths64 > polepthvec( tvec.size() );
 
-        int polepoint = -1;
-        for ( int k = 0; k < 3; k++ )
+    ParallelFor( tvec.size(), PATH_PARALLEL_CHUNK, [&]( int begin, int end )
+    {
+        for ( int j = begin ; j < end ; j++ )
         {
-            vec3d s = t->GetTriNode( k )->m_Pnt;
-            vec3d e = t->GetTriNode( k + 1 )->m_Pnt;
-            double th = angle( s, e );
-            int nref = ceil( th / thtol );
+            TTri *t = tvec[j];
 
-            for ( int i = 0; i < nref; i++ )
-            {
-                double frac = ( double )i / ( double )nref;
-                vec3d p = s + frac * ( e - s );
-                ptlist.push_back( p );
-            }
+            vector < vec3d > ptlist;
 
-            if ( std::abs( s.x() ) < tol && std::abs( s.y() ) < tol )
+            int polepoint = -1;
+            for ( int k = 0; k < 3; k++ )
             {
-                polepoint = k;
+                vec3d s = t->GetTriNode( k )->m_Pnt;
+                vec3d e = t->GetTriNode( k + 1 )->m_Pnt;
+                double th = angle( s, e );
+                int nref = ceil( th / thtol );
+
+                for ( int i = 0; i < nref; i++ )
+                {
+                    double frac = ( double )i / ( double )nref;
+                    vec3d p = s + frac * ( e - s );
+                    ptlist.push_back( p );
+                }
+
+                if ( std::abs( s.x() ) < tol && std::abs( s.y() ) < tol )
+                {
+                    polepoint = k;
+                }
             }
-        }
 
-        pth[j].resize( ptlist.size() );
+            pth[j].resize( ptlist.size() );
 
-        // Get triangle center to determine octant for transformation.
-        vec3d pcen = t->ComputeCenter();
+            // Get triangle center to determine octant for transformation.
+            vec3d pcen = t->ComputeCenter();
 
-        for ( int k = 0; k < ptlist.size(); k++ )
-        {
-            vec3d s = ToSpherical2( ptlist[k], pcen );
+            for ( int k = 0; k < ptlist.size(); k++ )
+            {
+                vec3d s = ToSpherical2( ptlist[k], pcen );
 
-            pth[j][k] = Clipper2Lib::Point64( ( int64_t ) ( SCALERAD * s.y() ), ( int64_t ) ( SCALERAD * s.z() ) );
-        }
+                pth[j][k] = Clipper2Lib::Point64( ( int64_t ) ( SCALERAD * s.y() ), ( int64_t ) ( SCALERAD * s.z() ) );
+            }
 
-        if ( !Clipper2Lib::IsPositive( pth[j] ) )
-        {
-            std::reverse( pth[j].begin(), pth[j].end() );
-        }
+            if ( !Clipper2Lib::IsPositive( pth[j] ) )
+            {
+                std::reverse( pth[j].begin(), pth[j].end() );
+            }
 
-        if ( polepoint >= 0 ) // Add triangles to fill out az,el domain around pole.
-        {
-            for ( int i = 0; i < 2; i++ )
+            if ( polepoint >= 0 ) // Add triangles to fill out az,el domain around pole.
             {
-                constexpr int incr[] = {-1, 1};
+                for ( int i = 0; i < 2; i++ )
+                {
+                    constexpr int incr[] = {-1, 1};
 
-                int o = polepoint + incr[i];
+                    int o = polepoint + incr[i];
 
-                vec3d pole = ToSpherical2( t->GetTriNode( polepoint )->m_Pnt, pcen );
-                vec3d other = ToSpherical2( t->GetTriNode( o )->m_Pnt, pcen );
+                    vec3d pole = ToSpherical2( t->GetTriNode( polepoint )->m_Pnt, pcen );
+                    vec3d other = ToSpherical2( t->GetTriNode( o )->m_Pnt, pcen );
 
-                vec3d o2 = other;
-                o2.set_z( pole.z() );
+                    vec3d o2 = other;
+                    o2.set_z( pole.z() );
 
-                Clipper2Lib::Path64 p;
-                p.resize( 3 );
-                p[0] = Clipper2Lib::Point64( ( int64_t ) ( SCALERAD * pole.y() ), ( int64_t ) ( SCALERAD * pole.z() ) );
-                p[1] = Clipper2Lib::Point64( ( int64_t ) ( SCALERAD * o2.y() ), ( int64_t ) ( SCALERAD * o2.z() ) );
-                p[2] = Clipper2Lib::Point64( ( int64_t ) ( SCALERAD * other.y() ), ( int64_t ) ( SCALERAD * other.z() ) );
+                    Clipper2Lib::Path64 p;
+                    p.resize( 3 );
+                    p[0] = Clipper2Lib::Point64( ( int64_t ) ( SCALERAD * pole.y() ), ( int64_t ) ( SCALERAD * pole.z() ) );
+                    p[1] = Clipper2Lib::Point64( ( int64_t ) ( SCALERAD * o2.y() ), ( int64_t ) ( SCALERAD * o2.z() ) );
+                    p[2] = Clipper2Lib::Point64( ( int64_t ) ( SCALERAD * other.y() ), ( int64_t ) ( SCALERAD * other.z() ) );
 
-                if ( !Clipper2Lib::IsPositive( p ) )
-                {
-                    std::reverse( p.begin(), p.end() );
+                    if ( !Clipper2Lib::IsPositive( p ) )
+                    {
+                        std::reverse( p.begin(), p.end() );
+                    }
+                    polepthvec[j].push_back( p );
                 }
-                polepths.push_back( p );
             }
         }
+    } );
+
+    for ( int j = 0 ; j < ( int )polepthvec.size() ; j++ )
+    {
+        pth.insert( pth.end(), polepthvec[j].begin(), polepthvec[j].end() );
     }
-    pth.insert( pth.end(), polepths.begin(), polepths.end() );
 }
 
 void ProjectionMgrSingleton::SphericalDomainPath( Clipper2Lib::Paths64 & pth )
@@ -1566,11 +1592,20 @@ void ProjectionMgrSingleton::ClosePaths( Clipper2Lib::Paths64 & pths )
     }
 }
 
-void ProjectionMgrSingleton::Union( Clipper2Lib::Paths64 & pths, Clipper2Lib::Paths64 & sol )
+//==== Union A Range Of Paths With A Single Clipper Pass ====//
+static void UnionRange( const Clipper2Lib::Paths64 & pths, size_t begin, size_t end, Clipper2Lib::Paths64 & sol )
 {
     Clipper2Lib::Clipper64 clpr;
     clpr.PreserveCollinear( false );
-    clpr.AddSubject( pths );
+
+    if ( begin == 0 && end == pths.size() )
+    {
+        clpr.AddSubject( pths );
+    }
+    else
+    {
+        clpr.AddSubject( Clipper2Lib::Paths64( pths.begin() + begin, pths.begin() + end ) );
+    }
 
     if ( !clpr.Execute( Clipper2Lib::ClipType::Union, Clipper2Lib::FillRule::Positive, sol ) )
     {
@@ -1578,6 +1613,121 @@ void ProjectionMgrSingleton::Union( Clipper2Lib::Paths64 & pths, Clipper2Lib::Pa
     }
 }
 
+//==== Union Each Group Of Paths By Tree Reduction ====//
+// Groups are split into leaves of about UNION_TREE_CHUNK paths.  All leaves of all
+// groups are unioned concurrently, then partial results are merged pairwise one
+// level at a time.  Union results are positive outers with negative holes, so
+// merging them with the Positive fill rule gives the same region as a single pass.
+static void UnionTree( const vector < Clipper2Lib::Paths64 > & groups, vector < Clipper2Lib::Paths64 > & solvec )
+{
+    struct Leaf
+    {
+        int m_Group;
+        int m_Part;
+        size_t m_Begin;
+        size_t m_End;
+    };
+
+    vector < Leaf > leaves;
+    vector < vector < Clipper2Lib::Paths64 > > parts( groups.size() );
+
+    for ( int g = 0; g < ( int )groups.size(); g++ )
+    {
+        size_t npth = groups[g].size();
+        size_t nleaf = std::max( ( size_t ) 1, npth / UNION_TREE_CHUNK );
+        size_t leafsize = ( npth + nleaf - 1 ) / nleaf;
+
+        parts[g].resize( nleaf );
+        for ( size_t l = 0; l < nleaf; l++ )
+        {
+            Leaf leaf;
+            leaf.m_Group = g;
+            leaf.m_Part = l;
+            leaf.m_Begin = std::min( npth, l * leafsize );
+            leaf.m_End = std::min( npth, ( l + 1 ) * leafsize );
+            leaves.push_back( leaf );
+        }
+    }
+
+    ParallelFor( leaves.size(), 1, [&]( int begin, int end )
+    {
+        for ( int l = begin; l < end; l++ )
+        {
+            const Leaf &leaf = leaves[l];
+            UnionRange( groups[leaf.m_Group], leaf.m_Begin, leaf.m_End, parts[leaf.m_Group][leaf.m_Part] );
+        }
+    } );
+
+    //==== Merge Pairs Across All Groups Until One Part Per Group Remains ====//
+    while ( true )
+    {
+        vector < std::pair < int, int > > pairs;
+        for ( int g = 0; g < ( int )parts.size(); g++ )
+        {
+            for ( int i = 0; i + 1 < ( int )parts[g].size(); i += 2 )
+            {
+                pairs.emplace_back( g, i );
+            }
+        }
+
+        if ( pairs.empty() )
+        {
+            break;
+        }
+
+        ParallelFor( pairs.size(), 1, [&]( int begin, int end )
+        {
+            for ( int ip = begin; ip < end; ip++ )
+            {
+                vector < Clipper2Lib::Paths64 > &gparts = parts[ pairs[ip].first ];
+                int i = pairs[ip].second;
+
+                Clipper2Lib::Paths64 &pa = gparts[i];
+                pa.insert( pa.end(), gparts[i + 1].begin(), gparts[i + 1].end() );
+                Clipper2Lib::Paths64().swap( gparts[i + 1] );
+
+                Clipper2Lib::Paths64 sol;
+                UnionRange( pa, 0, pa.size(), sol );
+                pa.swap( sol );
+            }
+        } );
+
+        for ( int g = 0; g < ( int )parts.size(); g++ )
+        {
+            vector < Clipper2Lib::Paths64 > next;
+            for ( int i = 0; i < ( int )parts[g].size(); i += 2 )
+            {
+                next.push_back( std::move( parts[g][i] ) );
+            }
+            parts[g].swap( next );
+        }
+    }
+
+    solvec.resize( groups.size() );
+    for ( int g = 0; g < ( int )parts.size(); g++ )
+    {
+        solvec[g] = std::move( parts[g][0] );
+    }
+}
+
+void ProjectionMgrSingleton::Union( Clipper2Lib::Paths64 & pths, Clipper2Lib::Paths64 & sol )
+{
+    if ( pths.size() < 2 * UNION_TREE_CHUNK )
+    {
+        UnionRange( pths, 0, pths.size(), sol );
+        return;
+    }
+
+    vector < Clipper2Lib::Paths64 > groups( 1 );
+    groups[0].swap( pths );
+
+    vector < Clipper2Lib::Paths64 > solvec;
+    UnionTree( groups, solvec );
+
+    groups[0].swap( pths );
+    sol.swap( solvec[0] );
+}
+
 void ProjectionMgrSingleton::Union( vector < Clipper2Lib::Paths64 > & pthsvec,  Clipper2Lib::Paths64 & sol )
 {
     // Append all paths into one path.
@@ -1601,25 +1751,17 @@ void ProjectionMgrSingleton::Union( vector < Clipper2Lib::Paths64 > & pthsvec, v
     sit = std::unique( uids.begin(), uids.end() );
     uids.resize( distance( uids.begin(), sit ) );
 
-    solvec.resize( uids.size() );
-
-    for ( int i = 0; i < uids.size(); i++ )
+    // Append all matching paths into one set per id.
+    vector < Clipper2Lib::Paths64 > groups( uids.size() );
+    for ( int j = 0; j < ids.size(); j++ )
     {
-        // Append all matching paths into one path.
-        Clipper2Lib::Paths64 pth;
-
-        for ( int j = 0; j < ids.size(); j++ )
-        {
-            if ( uids[i] == ids[j] ) // Match, append.
-            {
-                pth.insert( pth.end(), pthsvec[j].begin(), pthsvec[j].end() );
-            }
-        }
-
-        // Then union into its own set.
-        Union( pth, solvec[i] );
+        int i = std::lower_bound( uids.begin(), uids.end(), ids[j] ) - uids.begin();
+        groups[i].insert( groups[i].end(), pthsvec[j].begin(), pthsvec[j].end() );
     }
 
+    // Then union each set into its own solution, all sets concurrently.
+    UnionTree( groups, solvec );
+
     // Copy unique ids over passed in id vector.
     ids = uids;
 }
@@ -1641,24 +1783,43 @@ void ProjectionMgrSingleton::Intersect( vector < Clipper2Lib::Paths64 > & pthsve
 {
     solvec.resize( pthsvecA.size() );
 
-    for ( int i = 0; i < pthsvecA.size(); i++ )
+    ParallelFor( pthsvecA.size(), 1, [&]( int begin, int end )
     {
-        Intersect( pthsvecA[i], pthB, solvec[i] );
-    }
+        for ( int i = begin; i < end; i++ )
+        {
+            Intersect( pthsvecA[i], pthB, solvec[i] );
+        }
+    } );
 }
 
 void ProjectionMgrSingleton::Intersect( vector < Clipper2Lib::Paths64 > & pthsvec, Clipper2Lib::Paths64 & sol )
 {
     if ( !pthsvec.empty() )
     {
-        sol = pthsvec[ 0 ];
+        // Intersect pairs one level at a time until one set remains.
+        vector < Clipper2Lib::Paths64 > parts = pthsvec;
 
-        for ( int j = 1; j < pthsvec.size(); j++ )
+        while ( parts.size() > 1 )
         {
-            Clipper2Lib::Paths64 pth;
-            Intersect( sol, pthsvec[ j ], pth );
-            sol = pth;
+            int npair = parts.size() / 2;
+            vector < Clipper2Lib::Paths64 > next( ( parts.size() + 1 ) / 2 );
+
+            ParallelFor( npair, 1, [&]( int begin, int end )
+            {
+                for ( int i = begin; i < end; i++ )
+                {
+                    Intersect( parts[ 2 * i ], parts[ 2 * i + 1 ], next[ i ] );
+                }
+            } );
+
+            if ( parts.size() % 2 )
+            {
+                next.back().swap( parts.back() );
+            }
+            parts.swap( next );
         }
+
+        sol.swap( parts[ 0 ] );
     }
 }
 
@@ -2109,6 +2109,14 @@ xmlNodePtr PropGeom::DecodeXml( xmlNodePtr & node )
                 ReserveBlades( (int) nblade - 1 );
             }
         }
+
+        //==== Direct Copy - Blade Count Comes From Source Prop ====//
+        PropGeom* src = dynamic_cast< PropGeom* >( FindDirectCopySrc( child_node ) );
+        if ( src && src != this )
+        {
+            m_Nblade.Set( src->m_Nblade() );
+            ReserveBlades( m_Nblade() - 1 );
+        }
     }
 
     Geom::DecodeXml( node );
@@ -288,8 +288,12 @@ xmlNodePtr PtCloudGeom::EncodeXml( xmlNodePtr & node )
     xmlNodePtr ptcloud_node = xmlNewChild( node, nullptr, BAD_CAST "PtCloudGeom", nullptr );
 
     // Previous encoding -- all points as a large vector.
-    // required too much memory to read in.
-    // XmlUtil::AddVectorVec3dNode( ptcloud_node, "Points" , m_Pts );
+    // required too much memory to read in as text, but is compact as a binary block.
+    if ( XmlUtil::GetBinaryArrayMode() != XmlUtil::BINARY_ARRAY_NONE )
+    {
+        XmlUtil::AddVectorVec3dNode( ptcloud_node, "Points" , m_Pts );
+        return ptcloud_node;
+    }
 
     xmlNodePtr pt_list_node = xmlNewChild( ptcloud_node, nullptr, BAD_CAST "Pt_List", nullptr );
     for ( int i = 0 ; i < ( int ) m_Pts.size() ; i++ )
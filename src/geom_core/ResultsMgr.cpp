@@ -114,6 +114,48 @@ NameValData::NameValData( const string &name, const vector< vector< double > > &
     m_Doc = doc;
 }
 
+NameValData::NameValData( const string & name, vector< int > && i_data, const string & doc, const string & id )
+{
+    Init( name, vsp::INT_DATA, id );
+    m_IntData = std::move( i_data );
+    m_Doc = doc;
+}
+
+NameValData::NameValData( const string & name, vector< double > && d_data, const string & doc, const string & id )
+{
+    Init( name, vsp::DOUBLE_DATA, id );
+    m_DoubleData = std::move( d_data );
+    m_Doc = doc;
+}
+
+NameValData::NameValData( const string & name, vector< string > && s_data, const string & doc, const string & id )
+{
+    Init( name, vsp::STRING_DATA, id );
+    m_StringData = std::move( s_data );
+    m_Doc = doc;
+}
+
+NameValData::NameValData( const string & name, vector< vec3d > && v_data, const string & doc, const string & id )
+{
+    Init( name, vsp::VEC3D_DATA, id );
+    m_Vec3dData = std::move( v_data );
+    m_Doc = doc;
+}
+
+NameValData::NameValData( const string &name, vector< vector< int > > && imat_data, const string & doc, const string & id )
+{
+    Init( name, vsp::INT_MATRIX_DATA, id );
+    m_IntMatData = std::move( imat_data );
+    m_Doc = doc;
+}
+
+NameValData::NameValData( const string &name, vector< vector< double > > && dmat_data, const string & doc, const string & id )
+{
+    Init( name, vsp::DOUBLE_MATRIX_DATA, id );
+    m_DoubleMatData = std::move( dmat_data );
+    m_Doc = doc;
+}
+
 NameValData::~NameValData()
 {
     if ( m_AttributeCollection )
@@ -298,6 +340,57 @@ vec3d NameValData::GetVec3d( int i ) const
     return vec3d();
 }
 
+int NameValData::GetNumRows() const
+{
+    switch ( m_Type )
+    {
+        case vsp::BOOL_DATA:
+        case vsp::INT_DATA:
+            return ( int )m_IntData.size();
+        case vsp::DOUBLE_DATA:
+            return ( int )m_DoubleData.size();
+        case vsp::STRING_DATA:
+            return ( int )m_StringData.size();
+        case vsp::PARM_REFERENCE_DATA:
+            return ( int )m_ParmIDData.size();
+        case vsp::VEC3D_DATA:
+            return ( int )m_Vec3dData.size();
+        case vsp::INT_MATRIX_DATA:
+            return ( int )m_IntMatData.size();
+        case vsp::DOUBLE_MATRIX_DATA:
+            return ( int )m_DoubleMatData.size();
+    }
+    return 0;
+}
+
+int NameValData::GetNumCols() const
+{
+    size_t ncol = 0;
+    if ( m_Type == vsp::VEC3D_DATA )
+    {
+        ncol = 3;
+    }
+    else if ( m_Type == vsp::INT_MATRIX_DATA )
+    {
+        for ( size_t i = 0; i < m_IntMatData.size(); i++ )
+        {
+            ncol = std::max( ncol, m_IntMatData[i].size() );
+        }
+    }
+    else if ( m_Type == vsp::DOUBLE_MATRIX_DATA )
+    {
+        for ( size_t i = 0; i < m_DoubleMatData.size(); i++ )
+        {
+            ncol = std::max( ncol, m_DoubleMatData[i].size() );
+        }
+    }
+    else if ( GetNumRows() > 0 )
+    {
+        ncol = 1;
+    }
+    return ( int )ncol;
+}
+
 AttributeCollection* NameValData::GetAttributeCollectionPtr()
 {
     if ( !m_AttributeCollection )
@@ -571,6 +664,95 @@ void NameValData::DecodeXml( xmlNodePtr & node )
     }
 }
 
+//==== Binary Results Records - Native Byte Order, Ints Are 32 Bit, Strings Are Length Prefixed ====//
+static void WriteBinaryInt( FILE* fid, int val )
+{
+    int32_t v = val;
+    fwrite( &v, sizeof( v ), 1, fid );
+}
+
+static void WriteBinaryString( FILE* fid, const string & str )
+{
+    WriteBinaryInt( fid, ( int )str.size() );
+    fwrite( str.data(), 1, str.size(), fid );
+}
+
+static void WriteBinaryInts( FILE* fid, const vector< int > & vec )
+{
+    if ( sizeof( int ) == sizeof( int32_t ) )
+    {
+        fwrite( vec.data(), sizeof( int ), vec.size(), fid );
+    }
+    else
+    {
+        for ( size_t i = 0; i < vec.size(); i++ )
+        {
+            WriteBinaryInt( fid, vec[i] );
+        }
+    }
+}
+
+//==== Write Name, Type, Shape Then The Contiguous Data Buffer ====//
+void NameValData::WriteBinary( FILE* fid ) const
+{
+    int nrow = GetNumRows();
+
+    WriteBinaryString( fid, m_Name );
+    WriteBinaryInt( fid, m_Type );
+    WriteBinaryInt( fid, nrow );
+    WriteBinaryInt( fid, GetNumCols() );
+
+    switch ( m_Type )
+    {
+        case vsp::BOOL_DATA:
+        case vsp::INT_DATA:
+            WriteBinaryInts( fid, m_IntData );
+            break;
+        case vsp::DOUBLE_DATA:
+            fwrite( m_DoubleData.data(), sizeof( double ), m_DoubleData.size(), fid );
+            break;
+        case vsp::VEC3D_DATA:
+            for ( size_t i = 0; i < m_Vec3dData.size(); i++ )
+            {
+                fwrite( m_Vec3dData[i].v, sizeof( double ), 3, fid );
+            }
+            break;
+        case vsp::STRING_DATA:
+            for ( size_t i = 0; i < m_StringData.size(); i++ )
+            {
+                WriteBinaryString( fid, m_StringData[i] );
+            }
+            break;
+        case vsp::PARM_REFERENCE_DATA:
+            for ( size_t i = 0; i < m_ParmIDData.size(); i++ )
+            {
+                WriteBinaryString( fid, m_ParmIDData[i] );
+            }
+            break;
+        case vsp::INT_MATRIX_DATA:
+            // Rows may be ragged, so row lengths come first.
+            for ( int i = 0; i < nrow; i++ )
+            {
+                WriteBinaryInt( fid, ( int )m_IntMatData[i].size() );
+            }
+            for ( int i = 0; i < nrow; i++ )
+            {
+                WriteBinaryInts( fid, m_IntMatData[i] );
+            }
+            break;
+        case vsp::DOUBLE_MATRIX_DATA:
+            for ( int i = 0; i < nrow; i++ )
+            {
+                WriteBinaryInt( fid, ( int )m_DoubleMatData[i].size() );
+            }
+            for ( int i = 0; i < nrow; i++ )
+            {
+                fwrite( m_DoubleMatData[i].data(), sizeof( double ), m_DoubleMatData[i].size(), fid );
+            }
+            break;
+    }
+}
+
 string NameValData::GetAsString( bool inline_data_flag )
 {
     char str[255];
@@ -1412,98 +1594,90 @@ void Results::WriteCSVFile( FILE* fid )
         fprintf( fid, "Results_Date,%d,%d,%d\n", m_Month, m_Day, m_Year );
         fprintf( fid, "Results_Time,%d,%d,%d\n", m_Hour, m_Min, m_Sec );
 
+        // Each line is formatted into one buffer and written with a single fwrite.
+        string line;
+        char buf[128];
+
         map< string, vector< NameValData* > >::iterator iter;
         for ( iter = m_DataMap.begin() ; iter != m_DataMap.end() ; ++iter )
         {
             for ( int i = 0 ; i < ( int )iter->second.size() ; i++ )
             {
-                fprintf( fid, "%s", iter->second[i]->GetName().c_str() );
-                if ( iter->second[i]->GetType() == vsp::BOOL_DATA )
-                {
-                    for ( int d = 0 ; d < ( int )iter->second[i]->GetBoolData().size() ; d++ )
-                    {
-                        fprintf( fid, ",%d", iter->second[i]->GetBoolData()[d] );
-                    }
-                }
-                if ( iter->second[i]->GetType() == vsp::INT_DATA )
+                const NameValData* nvd = iter->second[i];
+                line = nvd->GetName();
+
+                if ( nvd->GetType() == vsp::BOOL_DATA || nvd->GetType() == vsp::INT_DATA )
                 {
-                    for ( int d = 0 ; d < ( int )iter->second[i]->GetIntData().size() ; d++ )
+                    const vector< int > & ivec = nvd->GetIntData();
+                    for ( int d = 0 ; d < ( int )ivec.size() ; d++ )
                     {
-                        fprintf( fid, ",%d", iter->second[i]->GetIntData()[d] );
+                        line.append( buf, snprintf( buf, sizeof( buf ), ",%d", ivec[d] ) );
                     }
                 }
-                else if ( iter->second[i]->GetType() == vsp::DOUBLE_DATA )
+                else if ( nvd->GetType() == vsp::DOUBLE_DATA )
                 {
-                    for ( int d = 0 ; d < ( int )iter->second[i]->GetDoubleData().size() ; d++ )
+                    const vector< double > & dvec = nvd->GetDoubleData();
+                    for ( int d = 0 ; d < ( int )dvec.size() ; d++ )
                     {
-                        fprintf( fid, ",%.*e", DBL_DIG + 3, iter->second[i]->GetDoubleData()[d] );
+                        line.append( buf, snprintf( buf, sizeof( buf ), ",%.*e", DBL_DIG + 3, dvec[d] ) );
                     }
                 }
-                else if ( iter->second[i]->GetType() == vsp::INT_MATRIX_DATA )
+                else if ( nvd->GetType() == vsp::INT_MATRIX_DATA )
                 {
-                    vector< vector< int > > current_int_mat_val = iter->second[i]->GetIntMatData();
+                    const vector< vector< int > > & current_int_mat_val = nvd->GetIntMatData();
                     for ( unsigned int row = 0; row < current_int_mat_val.size(); row++ )
                     {
                         for ( unsigned int col = 0; col < current_int_mat_val[row].size(); col++ )
                         {
-                            fprintf( fid, ",%d", current_int_mat_val[row][col] );
+                            line.append( buf, snprintf( buf, sizeof( buf ), ",%d", current_int_mat_val[row][col] ) );
                         }
                         if ( row < current_int_mat_val.size() - 1 )
                         {
-                            fprintf( fid, "\n ");
+                            line.append( "\n " );
                         }
                     }
                 }
-                else if ( iter->second[i]->GetType() == vsp::DOUBLE_MATRIX_DATA )
+                else if ( nvd->GetType() == vsp::DOUBLE_MATRIX_DATA )
                 {
-                    vector< vector< double > > current_double_mat_val = iter->second[i]->GetDoubleMatData();
+                    const vector< vector< double > > & current_double_mat_val = nvd->GetDoubleMatData();
                     for ( unsigned int row = 0; row < current_double_mat_val.size(); row++ )
                     {
                         for ( unsigned int col = 0; col < current_double_mat_val[row].size(); col++ )
                         {
-                            fprintf( fid, ",%.*e", DBL_DIG + 3, current_double_mat_val[row][col] );
+                            line.append( buf, snprintf( buf, sizeof( buf ), ",%.*e", DBL_DIG + 3, current_double_mat_val[row][col] ) );
                         }
                         if ( row < current_double_mat_val.size() - 1 )
                         {
-                            fprintf( fid, "\n ");
+                            line.append( "\n " );
                         }
                     }
                 }
-                else if ( iter->second[i]->GetType() == vsp::STRING_DATA )
+                else if ( nvd->GetType() == vsp::STRING_DATA )
                 {
                     // If this is a "ResultsVec" wrapper result replace result UIDs with result names
-                    if ( strcmp( iter->second[i]->GetName().c_str(), "ResultsVec" ) == 0 )
+                    bool results_vec = ( strcmp( nvd->GetName().c_str(), "ResultsVec" ) == 0 );
+                    const vector< string > & svec = nvd->GetStringData();
+                    for ( int d = 0; d < (int)svec.size(); d++ )
                     {
-                        for ( int d = 0; d < (int)iter->second[i]->GetStringData().size(); d++ )
-                        {
-                            fprintf( fid, ",%s", ResultsMgr.FindResultsPtr(iter->second[i]->GetStringData()[d])->GetName().c_str() );
-                        }
-                    }
-                    else
-                    {
-                        for ( int d = 0; d < (int)iter->second[i]->GetStringData().size(); d++ )
-                        {
-                            fprintf( fid, ",%s", iter->second[i]->GetStringData()[d].c_str() );
-                        }
+                        line.push_back( ',' );
+                        line.append( results_vec ? ResultsMgr.FindResultsPtr( svec[d] )->GetName() : svec[d] );
                     }
                 }
-                else if ( iter->second[i]->GetType() == vsp::VEC3D_DATA )
+                else if ( nvd->GetType() == vsp::VEC3D_DATA )
                 {
-                    for ( int d = 0 ; d < ( int )iter->second[i]->GetVec3dData().size() ; d++ )
+                    const vector< vec3d > & vvec = nvd->GetVec3dData();
+                    for ( int d = 0 ; d < ( int )vvec.size() ; d++ )
                     {
-                        vec3d v = iter->second[i]->GetVec3dData()[d];
-                        fprintf( fid, ",%.*e,%.*e,%.*e", DBL_DIG + 3, v.x(), DBL_DIG + 3, v.y(), DBL_DIG + 3, v.z() );
+                        const vec3d & v = vvec[d];
+                        line.append( buf, snprintf( buf, sizeof( buf ), ",%.*e,%.*e,%.*e", DBL_DIG + 3, v.x(), DBL_DIG + 3, v.y(), DBL_DIG + 3, v.z() ) );
                     }
                 }
-                else if ( iter->second[i]->GetType() == vsp::PARM_REFERENCE_DATA )
+                else if ( nvd->GetType() == vsp::PARM_REFERENCE_DATA || nvd->GetType() == vsp::ATTR_COLLECTION_DATA )
                 {
-                    fprintf( fid, "NameValData type %s reserved for Attributes functionality", iter->second[i]->GetTypeName().c_str() );
+                    line.append( "NameValData type " + nvd->GetTypeName() + " reserved for Attributes functionality" );
                 }
-                else if ( iter->second[i]->GetType() == vsp::ATTR_COLLECTION_DATA )
-                {
-                    fprintf( fid, "NameValData type %s reserved for Attributes functionality", iter->second[i]->GetTypeName().c_str() );
-                }
-                fprintf( fid, "\n" );
+                line.push_back( '\n' );
+                fwrite( line.data(), 1, line.size(), fid );
             }
         }
 
@@ -1529,6 +1703,64 @@ void Results::WriteCSVFile( FILE* fid )
     }
 }
 
+void Results::WriteBinaryFile( const string & file_name )
+{
+    FILE* fid = fopen( file_name.c_str(), "wb" );
+    if ( fid )
+    {
+        fwrite( "VSPRES01", 1, 8, fid );
+        WriteBinaryFile( fid );
+        fclose( fid );          // Close File
+    }
+}
+
+//==== Write One Results Record - Same Content And Order As The CSV File ====//
+void Results::WriteBinaryFile( FILE* fid )
+{
+    if ( fid )
+    {
+        int ndata = 0;
+        map< string, vector< NameValData* > >::iterator iter;
+        for ( iter = m_DataMap.begin() ; iter != m_DataMap.end() ; ++iter )
+        {
+            ndata += ( int )iter->second.size();
+        }
+
+        WriteBinaryString( fid, m_Name );
+        WriteBinaryString( fid, m_ID );
+        int64_t timestamp = m_Timestamp;
+        fwrite( &timestamp, sizeof( timestamp ), 1, fid );
+        WriteBinaryInt( fid, ndata );
+
+        for ( iter = m_DataMap.begin() ; iter != m_DataMap.end() ; ++iter )
+        {
+            for ( int i = 0 ; i < ( int )iter->second.size() ; i++ )
+            {
+                iter->second[i]->WriteBinary( fid );
+            }
+        }
+
+        // Sub-results of a "ResultsVec" wrapper follow as their own records
+        for ( iter = m_DataMap.begin(); iter != m_DataMap.end(); ++iter )
+        {
+            for ( int i = 0; i < (int)iter->second.size(); i++ )
+            {
+                if ( (iter->second[i]->GetType() == vsp::STRING_DATA) && (strcmp( iter->second[i]->GetName().c_str(), "ResultsVec" ) == 0) )
+                {
+                    for ( int d = 0; d < (int)iter->second[i]->GetStringData().size(); d++ )
+                    {
+                        Results * res = ResultsMgr.FindResultsPtr( iter->second[i]->GetStringData()[d] );
+                        if ( res )
+                        {
+                            res->WriteBinaryFile( fid );
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
 //==== Write The Mass Prop Results ====//
 void Results::WriteMassProp( const string & file_name )
 {
@@ -2796,3 +3028,26 @@ int ResultsMgrSingleton::WriteCSVFile( const string & file_name, const vector <
         return vsp::VSP_FILE_WRITE_FAILURE;
     }
 }
+
+int ResultsMgrSingleton::WriteBinaryFile( const string & file_name, const vector < string > &resids )
+{
+    FILE* fid = fopen( file_name.c_str(), "wb" );
+    if( fid )
+    {
+        fwrite( "VSPRES01", 1, 8, fid );
+        for( unsigned int iRes=0; iRes<resids.size(); iRes++ )
+        {
+            Results* resptr = ResultsMgr.FindResultsPtr( resids[iRes] );
+            if( resptr )
+            {
+                resptr->WriteBinaryFile( fid );    //append this result to the binary file
+            }
+        }
+        fclose( fid );          // Close File
+        return vsp::VSP_OK;
+    }
+    else
+    {
+        return vsp::VSP_FILE_WRITE_FAILURE;
+    }
+}
@@ -20,6 +20,8 @@
 #include <list>
 #include <vector>
 #include <string>
+#include <utility>
+#include <cstdio>
 
 using std::unordered_map;
 using std::map;
@@ -46,6 +48,14 @@ public:
     NameValData( const string & name, const vector< vec3d > & v_data, const string & doc, const string & id = string() );
     NameValData( const string & name, const vector< vector< int > > &imat_data, const string & doc, const string & id = string() );
     NameValData( const string & name, const vector< vector< double > > &dmat_data, const string & doc, const string & id = string() );
+
+    //==== Take Ownership Of Large Buffers Without Copying ====//
+    NameValData( const string & name, vector< int > && i_data, const string & doc, const string & id = string() );
+    NameValData( const string & name, vector< double > && d_data, const string & doc, const string & id = string() );
+    NameValData( const string & name, vector< string > && s_data, const string & doc, const string & id = string() );
+    NameValData( const string & name, vector< vec3d > && v_data, const string & doc, const string & id = string() );
+    NameValData( const string & name, vector< vector< int > > && imat_data, const string & doc, const string & id = string() );
+    NameValData( const string & name, vector< vector< double > > && dmat_data, const string & doc, const string & id = string() );
     ~NameValData();
 
     NameValData( const NameValData &nvd ) = delete;
@@ -146,6 +156,10 @@ public:
     vec3d GetVec3d( int index ) const;
     AttributeCollection* GetAttributeCollectionPtr();
 
+    //==== Shape Of The Stored Data - Vec3d Is n x 3, Matrices Use Their Longest Row ====//
+    int GetNumRows() const;
+    int GetNumCols() const;
+
     void AddAttributeCollection();
 
     string GetAsString( bool inline_data_flag = false );
@@ -190,6 +204,21 @@ public:
         m_DoubleMatData = d;
     }
 
+    void SetIntData( vector< int > && d )
+    {
+        m_IntData = std::move( d );
+    }
+
+    void SetDoubleData( vector< double > && d )
+    {
+        m_DoubleData = std::move( d );
+    }
+
+    void SetVec3dData( vector< vec3d > && d )
+    {
+        m_Vec3dData = std::move( d );
+    }
+
     void SetName( const string & name )
     {
         m_Name = name;
@@ -242,6 +271,8 @@ public:
     virtual void EncodeXml( xmlNodePtr & node ) const;
     virtual void DecodeXml( xmlNodePtr & node );
 
+    void WriteBinary( FILE* fid ) const;
+
 protected:
 
     void Init( const string & name, int type = 0, const string & id = string() );
@@ -406,6 +437,8 @@ public:
 
     void WriteCSVFile( const string & file_name );
     void WriteCSVFile( FILE* fid );
+    void WriteBinaryFile( const string & file_name );
+    void WriteBinaryFile( FILE* fid );
     void WriteMassProp( const string & file_name );
     void WriteCompGeomTxtFile( const string & file_name );
     void WriteCompGeomCsvFile( const string & file_name );
@@ -491,6 +524,7 @@ public:
     void TestSpeed();               // Test Speed
 
     static int WriteCSVFile( const string & file_name, const vector < string > &resids );
+    static int WriteBinaryFile( const string & file_name, const vector < string > &resids );
 
 private:
     ResultsMgrSingleton();
@@ -315,8 +315,40 @@ int ScriptMgrSingleton::ExecuteScript( const char* module_name, const char* func
         return 1;
     }
 
-    // Create our context, prepare it, and then execute
-    asIScriptContext *ctx = m_ScriptEngine->CreateContext();
+    return ExecuteFunction( func, arg_flag, arg );
+}
+
+//==== Find Function In Module And Hold A Reference To It ====//
+asIScriptFunction* ScriptMgrSingleton::FindFunction( const string & module_name, const string & function_decl )
+{
+    asIScriptModule *mod = m_ScriptEngine->GetModule( module_name.c_str() );
+
+    if ( !mod )
+    {
+        return nullptr;
+    }
+
+    asIScriptFunction *func = mod->GetFunctionByDecl( function_decl.c_str() );
+
+    if ( func )
+    {
+        func->AddRef();
+    }
+
+    return func;
+}
+
+//==== Execute Function ====//
+int ScriptMgrSingleton::ExecuteFunction( asIScriptFunction* func, bool arg_flag, double arg )
+{
+    if ( !func )
+    {
+        return 1;
+    }
+
+    // Take a context from the engine's pool, prepare it, and then execute.  The
+    // pool hands out a fresh context if this is a nested call.
+    asIScriptContext *ctx = m_ScriptEngine->RequestContext();
     ctx->Prepare( func );
     if ( arg_flag )
     {
@@ -331,14 +363,14 @@ int ScriptMgrSingleton::ExecuteScript( const char* module_name, const char* func
             // An exception occurred, let the script writer know what happened so it can be corrected.
             printf( "An exception '%s' occurred \n", ctx->GetExceptionString() );
         }
-        ctx->Release();
+        m_ScriptEngine->ReturnContext( ctx );
         return 1;
     }
 
     asDWORD ret = ctx->GetReturnDWord();
     int32_t rval = ret;
 
-    ctx->Release();
+    m_ScriptEngine->ReturnContext( ctx );
     return rval;
 }
 
@@ -912,6 +944,8 @@ void ScriptMgrSingleton::RegisterEnums( asIScriptEngine* se )
     assert( r >= 0 );
     r = se->RegisterEnumValue( "COMPUTATION_FILE_TYPE", "VSPAERO_VSPGEOM_TYPE", VSPAERO_VSPGEOM_TYPE );
     assert( r >= 0 );
+    r = se->RegisterEnumValue( "COMPUTATION_FILE_TYPE", "DEGEN_GEOM_BIN_TYPE", DEGEN_GEOM_BIN_TYPE );
+    assert( r >= 0 );
 
 
     r = se->RegisterEnum( "CONFORMAL_TRIM_TYPE" );
@@ -3287,6 +3321,15 @@ void ScriptMgrSingleton::RegisterAdvLinkMgr( asIScriptEngine* se )
 
     r = se->RegisterGlobalFunction( "double GetVar( const string & in var_name )", asMETHOD( AdvLinkMgrSingleton, GetVar ), asCALL_THISCALL_ASGLOBAL, &AdvLinkMgr );
     assert( r );
+
+
+    //==== Slot Access Used By Generated Link Scripts ====//
+    r = se->RegisterGlobalFunction( "void SetVarSlot( int slot, double val )", asMETHOD( AdvLinkMgrSingleton, SetVarSlot ), asCALL_THISCALL_ASGLOBAL, &AdvLinkMgr );
+    assert( r );
+
+
+    r = se->RegisterGlobalFunction( "double GetVarSlot( int slot )", asMETHOD( AdvLinkMgrSingleton, GetVarSlot ), asCALL_THISCALL_ASGLOBAL, &AdvLinkMgr );
+    assert( r );
 }
 
 //==== Register API E Functions ====//
@@ -3391,6 +3434,10 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
     assert( r >= 0 );
 
 
+    r = se->RegisterGlobalFunction( "void ScreenGrabViews( array<string>@+ fname_vec, array<vec3d>@+ rot_vec, array<double>@+ zoom_vec, array<vec3d>@+ pan_vec, array<vec3d>@+ cor_vec, int w, int h, bool transparentBG, bool autocrop = false )", asMETHOD( ScriptMgrSingleton, ScreenGrabViews ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr );
+    assert( r >= 0 );
+
+
     r = se->RegisterGlobalFunction( "void SetViewAxis( bool vaxis )", asFUNCTION( vsp::SetViewAxis ), asCALL_CDECL );
     assert( r >= 0 );
 
@@ -3482,6 +3529,14 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
 
     r = se->RegisterGlobalFunction( "void ClearVSPModel()", asFUNCTION( vsp::ClearVSPModel ), asCALL_CDECL );
     assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "string SaveVehicleSnapshot()", asFUNCTION( vsp::SaveVehicleSnapshot ), asCALL_CDECL );
+    assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "int RestoreVehicleSnapshot( const string & in snapshot_id )", asFUNCTION( vsp::RestoreVehicleSnapshot ), asCALL_CDECL );
+    assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "void DeleteVehicleSnapshot( const string & in snapshot_id )", asFUNCTION( vsp::DeleteVehicleSnapshot ), asCALL_CDECL );
+    assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "void DeleteAllVehicleSnapshots()", asFUNCTION( vsp::DeleteAllVehicleSnapshots ), asCALL_CDECL );
+    assert( r >= 0 );
 
 
     r = se->RegisterGlobalFunction( "string GetVSPFileName()", asFUNCTION( vsp::GetVSPFileName ), asCALL_CDECL );
@@ -3987,6 +4042,8 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
 
     r = se->RegisterGlobalFunction( "void WriteResultsCSVFile( const string & in id, const string & in file_name )", asFUNCTION( vsp::WriteResultsCSVFile ), asCALL_CDECL );
     assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "void WriteResultsBinaryFile( const string & in id, const string & in file_name )", asFUNCTION( vsp::WriteResultsBinaryFile ), asCALL_CDECL );
+    assert( r >= 0 );
 
 
     r = se->RegisterGlobalFunction( "void PrintResults( const string & in id )", asFUNCTION( vsp::PrintResults ), asCALL_CDECL );
@@ -4829,6 +4886,10 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
     assert( r >= 0 );
 
 
+    r = se->RegisterGlobalFunction( "void SetParmValBatch( array<string>@+ parm_ids, array<double>@+ vals )", asMETHOD( ScriptMgrSingleton, SetParmValBatch ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr );
+    assert( r >= 0 );
+
+
     r = se->RegisterGlobalFunction( "double GetParmVal(const string & in parm_id )", asFUNCTIONPR( vsp::GetParmVal, ( const string & ), double ), asCALL_CDECL );
     assert( r >= 0 );
 
@@ -6223,6 +6284,17 @@ void ScriptMgrSingleton::DeleteGeomVec( CScriptArray* del_arr )
     vsp::DeleteGeomVec( del_vec );
 }
 
+void ScriptMgrSingleton::SetParmValBatch( CScriptArray* parm_ids, CScriptArray* vals )
+{
+    vector < string > parm_id_vec;
+    FillSTLVector( parm_ids, parm_id_vec );
+
+    vector < double > val_vec;
+    FillSTLVector( vals, val_vec );
+
+    vsp::SetParmValBatch( parm_id_vec, val_vec );
+}
+
 void ScriptMgrSingleton::SetXSecPnts( const string& xsec_id, CScriptArray* pnt_arr )
 {
     vector< vec3d > pnt_vec;
@@ -6605,6 +6677,26 @@ void ScriptMgrSingleton::SetVec3dAnalysisInput( const string& analysis, const st
     vsp::SetVec3dAnalysisInput( analysis, name, indata_vec, index );
 }
 
+void ScriptMgrSingleton::ScreenGrabViews( CScriptArray* fname_vec, CScriptArray* rot_vec, CScriptArray* zoom_vec, CScriptArray* pan_vec, CScriptArray* cor_vec, int w, int h, bool transparentBG, bool autocrop )
+{
+    vector < string > in_fname_vec;
+    FillSTLVector( fname_vec, in_fname_vec );
+
+    vector < vec3d > in_rot_vec;
+    FillSTLVector( rot_vec, in_rot_vec );
+
+    vector < double > in_zoom_vec;
+    FillSTLVector( zoom_vec, in_zoom_vec );
+
+    vector < vec3d > in_pan_vec;
+    FillSTLVector( pan_vec, in_pan_vec );
+
+    vector < vec3d > in_cor_vec;
+    FillSTLVector( cor_vec, in_cor_vec );
+
+    vsp::ScreenGrabViews( in_fname_vec, in_rot_vec, in_zoom_vec, in_pan_vec, in_cor_vec, w, h, transparentBG, autocrop );
+}
+
 CScriptArray* ScriptMgrSingleton::CompVecPnt01(const string &geom_id, const int &surf_indx, CScriptArray* us, CScriptArray* ws)
 {
     vector < double > in_us;
@@ -65,6 +65,12 @@ public:
 
     int ExecuteScript(  const char* module_name,  const char* function_name, bool arg_flag = false, double arg = 0.0, bool by_decl = true );
 
+    //==== Find Function By Declaration - Caller Must Release The Returned Reference ====//
+    asIScriptFunction* FindFunction( const string & module_name, const string & function_decl );
+
+    //==== Execute Function With A Pooled Context ====//
+    int ExecuteFunction( asIScriptFunction* func, bool arg_flag = false, double arg = 0.0 );
+
     void AddToMessages( const string & msg )                { m_ScriptMessages += msg; }
     void ClearMessages()                                    { m_ScriptMessages.clear(); }
     string GetMessages()                                    { return m_ScriptMessages; }
@@ -242,6 +248,8 @@ private:
 
     void DeleteGeomVec( CScriptArray* del_arr );
 
+    void SetParmValBatch( CScriptArray* parm_ids, CScriptArray* vals );
+
     void SetXSecPnts( const string& xsec_id, CScriptArray* pnt_arr );
     void SetAirfoilUpperPnts( const string& xsec_id, CScriptArray* up_pnt_arr );
     void SetAirfoilLowerPnts( const string& xsec_id, CScriptArray* low_pnt_arr );
@@ -271,6 +279,8 @@ private:
     void SetStringAnalysisInput( const string& analysis, const string & name, CScriptArray* indata, int index );
     void SetVec3dAnalysisInput( const string& analysis, const string & name, CScriptArray* indata, int index );
 
+    void ScreenGrabViews( CScriptArray* fname_vec, CScriptArray* rot_vec, CScriptArray* zoom_vec, CScriptArray* pan_vec, CScriptArray* cor_vec, int w, int h, bool transparentBG, bool autocrop );
+
     // ==== Variable Preset Functions ====//
     CScriptArray* GetVarPresetGroups();
     CScriptArray* GetVarPresetSettings( const string &group_id );
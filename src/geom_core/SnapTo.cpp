@@ -13,6 +13,12 @@
 
 #include "MeshGeom.h"
 
+// Conservative advancement steps before giving up on reaching the target distance.
+#define SNAP_ADVANCE_MAX_ITER 100
+
+// Margin on the sampled surface motion rate, each step covers at most 1/SAFETY of the gap.
+#define SNAP_ADVANCE_SAFETY 1.25
+
 SnapTo::SnapTo() : ParmContainer()
 {
     m_Name = "SnapTo";
@@ -67,31 +73,8 @@ void SnapTo::PreventCollision( const string & geom_id, const string & parm_id )
     AdjParmToMinDist( parm_id, inc_flag );
 }
 
-//==== Returns Large Neg Number If Error and 0.0 If Collision ====//
-double SnapTo::FindMinDistance( const string & geom_id, const vector< TMesh* > & other_tmesh_vec, bool & intersect_flag )
-{
-    intersect_flag = false;
-    Geom* geom_ptr = VehicleMgr.GetVehicle()->FindGeom( geom_id );
-    if ( !geom_ptr )    return -1.0e12;
-
-    vector< TMesh* > tmesh_vec = geom_ptr->CreateTMeshVec( false );        // Must Delete!!!
-
-    for ( int i = 0 ; i < (int)tmesh_vec.size() ; i++ )
-    {
-        tmesh_vec[i]->LoadBndBox();
-    }
-
-    double min_dist = ::FindMinDistance( tmesh_vec, other_tmesh_vec, intersect_flag );
-
-    for ( int i = 0 ; i < (int)tmesh_vec.size() ; i++ )
-    {
-        delete tmesh_vec[i];
-    }
-
-    return min_dist;
-}
-
-void SnapTo::AdjParmToMinDist( const string & parm_id, bool inc_flag )
+//==== Collision Set, Applying Mode Settings When Used ====//
+int SnapTo::GetCollisionSet()
 {
     int set = m_CollisionSet;
 
@@ -105,16 +88,14 @@ void SnapTo::AdjParmToMinDist( const string & parm_id, bool inc_flag )
         }
     }
 
-    Parm* parm_ptr = ParmMgr.FindParm( parm_id );
-    if ( !parm_ptr )   return;
-
-    string geom_id = parm_ptr->GetLinkContainerID();
-    Geom* geom_ptr = VehicleMgr.GetVehicle()->FindGeom( geom_id );
-    if ( !geom_ptr )    return;
+    return set;
+}
 
+//==== Refit Or Rebuild Bodies For All Geoms In Set Except geom_id ====//
+void SnapTo::UpdateCollisionWorld( const string & geom_id, int set )
+{
     Vehicle* veh = VehicleMgr.GetVehicle();
 
-    //==== Find Other Geoms ====//
     vector< string > geom_id_vec = veh->GetGeomSet( set );
     vector< string > other_geom_vec;
     for ( int i = 0 ; i < (int)geom_id_vec.size() ; i++ )
@@ -123,21 +104,21 @@ void SnapTo::AdjParmToMinDist( const string & parm_id, bool inc_flag )
             other_geom_vec.push_back( geom_id_vec[i] );
     }
 
-    //==== Create TMeshes =====//
-    vector< TMesh* > other_tmesh_vec;
-    for ( int i = 0 ; i < (int)other_geom_vec.size() ; i++ )
-    {
-        Geom* g_ptr = veh->FindGeom( other_geom_vec[i] );
-        if ( g_ptr )
-        {
-             vector< TMesh* > tvec = g_ptr->CreateTMeshVec( false );       /////////// MUST DELETE!!!
-             for ( int j = 0 ; j < (int)tvec.size() ; j++ )
-             {
-                tvec[j]->LoadBndBox();
-                other_tmesh_vec.push_back( tvec[j] );
-             }
-        }
-    }
+    m_CollisionWorld.Update( other_geom_vec );
+}
+
+void SnapTo::AdjParmToMinDist( const string & parm_id, bool inc_flag )
+{
+    int set = GetCollisionSet();
+
+    Parm* parm_ptr = ParmMgr.FindParm( parm_id );
+    if ( !parm_ptr )   return;
+
+    string geom_id = parm_ptr->GetLinkContainerID();
+    Geom* geom_ptr = VehicleMgr.GetVehicle()->FindGeom( geom_id );
+    if ( !geom_ptr )    return;
+
+    Vehicle* veh = VehicleMgr.GetVehicle();
 
     double direction = 1.0;
     if ( !inc_flag )
@@ -146,25 +127,46 @@ void SnapTo::AdjParmToMinDist( const string & parm_id, bool inc_flag )
     double orig_val = parm_ptr->Get();
     double revert_val = parm_ptr->Get();
 
-    //==== Create Geom TMesh Vec. Adjust Parm And Create Again ====//
+    //==== Moving Body At Original Value ====//
+    veh->Update( false );
+    double model_size = veh->GetBndBox().DiagDist();
+    int shape_count = geom_ptr->GetShapeUpdateCount();
+    m_MovingBody.Update( geom_ptr );
+
+    //==== Adjust Parm And Create TMeshes Again ====//
     double del_val = 0.01;
-    vector< TMesh* > tmesh_orig = geom_ptr->CreateTMeshVec( false );       // Must Delete
     parm_ptr->Set( orig_val + del_val );
     VehicleMgr.GetVehicle()->Update( false );
     vector< TMesh* > tmesh_adj  = geom_ptr->CreateTMeshVec( false );       // Must Delete
 
-    double max_min = FindMaxMinDistance( tmesh_orig, tmesh_adj );   // Find Max Dist Change Of Mesh 
+    double max_min = m_MovingBody.MaxDisplacement( tmesh_adj );   // Find Max Dist Change Of Mesh
     max_min = max( max_min, 1.0e-06 );
 
+    //==== Transform Only Parms Move The Cached Body Without Tessellating ====//
+    bool refit_flag = false;
+    if ( geom_ptr->GetShapeUpdateCount() == shape_count && m_MovingBody.Refit( geom_ptr ) )
+    {
+        double err = m_MovingBody.MaxDisplacement( tmesh_adj );
+        refit_flag = ( err >= 0.0 && err <= 1.0e-06 * model_size );
+    }
+
     //==== Deleting TMeshes ====//
-    for ( int i = 0 ; i < (int)tmesh_orig.size() ; i++ )
-        delete tmesh_orig[i];
     for ( int i = 0 ; i < (int)tmesh_adj.size() ; i++ )
         delete tmesh_adj[i];
 
+    //==== Bring Other Bodies Up To Date ====//
+    UpdateCollisionWorld( geom_id, set );
+
+    //==== Set Parm And Move Body To Match ====//
+    auto move_body = [&]( double val )
+    {
+        parm_ptr->Set( val );
+        veh->Update( false );
+        m_MovingBody.Update( geom_ptr, refit_flag );
+    };
+
     //==== Restore Value ====//
-    parm_ptr->Set( orig_val );                                     
-    veh->Update( false );
+    move_body( orig_val );
 
    //==== Check If Current Input Matches Last Input ====//
     if ( (parm_id == m_LastParmID) && (inc_flag == m_LastIncFlag)  )
@@ -174,21 +176,19 @@ void SnapTo::AdjParmToMinDist( const string & parm_id, bool inc_flag )
             if ( std::abs( m_LastParmVal - orig_val ) < 1.0e-12 )
             {
                 bool iflag;
-                double d = FindMinDistance( geom_id, other_tmesh_vec, iflag );
+                double d = m_CollisionWorld.MinDistance( m_MovingBody, 1.0e12, iflag );
                 if ( !iflag && std::abs( d - m_LastMinDist ) < 1.0e-12 )
                 {
                     //==== Nudge Parm In Inc Direction To Make Sure Collision ====//
                     double nudge = 2.0*m_LastMinDist*del_val/max_min;
-                    parm_ptr->Set( parm_ptr->Get() + direction*nudge );
+                    move_body( parm_ptr->Get() + direction*nudge );
                     orig_val = parm_ptr->Get();
-                    veh->Update( false );
                 }
             }
         }
     }
 
     //==== Find Reasonable Range For Val =====//
-    double model_size = veh->GetBndBox().DiagDist();
     double val_range = (model_size*del_val)/max_min;
 
     //===== Parm Limits ====//
@@ -202,125 +202,135 @@ void SnapTo::AdjParmToMinDist( const string & parm_id, bool inc_flag )
     //==== Limit Range =====//
     val_range = min( std::abs(limit - orig_val), val_range );
 
-    //==== Move Geom Close To Other Body In Correct Direction ====//
-    int cnt = 0;
+    //==== Largest Surface Motion Per Unit Parm Change ====//
+    double rate = max_min/del_val;
+
     double v_in  = orig_val;
-    double v_out = orig_val;       
+    double v_out = orig_val;
+    double approach = direction;        // Parm direction that closes the gap
 
-    bool init_col_flag = CheckIntersect( geom_ptr, other_tmesh_vec );
+    bool init_col_flag = m_CollisionWorld.CheckIntersect( m_MovingBody );
 
-    //==== Step Forward To Find First Opposite of Collision Flag (col_flag)      ====//
-    //==== This Could Be Faster But Might Skip Over Possible Solns (Still Might) ====//
-    bool found_flag = false;
-    for ( int i = 1 ; i <= 20 ; i++ )
+    bool found_flag = true;
+    if ( init_col_flag )
     {
-        double fract = (double)(i*i)/400.0;     // Closer Spaced Near Init Point
-        double val = orig_val + direction*val_range*fract;
-        parm_ptr->Set( val );
-        veh->Update( false );
-        bool col_flag =  CheckIntersect( geom_ptr, other_tmesh_vec );
-
-        if ( !col_flag )
+        //==== No Penetration Depth - Step Forward To First Clear Value ====//
+        found_flag = false;
+        for ( int i = 1 ; i <= 20 ; i++ )
         {
-            v_out = val;
-            if ( init_col_flag )
+            double fract = (double)(i*i)/400.0;     // Closer Spaced Near Init Point
+            double val = orig_val + direction*val_range*fract;
+            move_body( val );
+
+            if ( !m_CollisionWorld.CheckIntersect( m_MovingBody ) )
             {
+                v_out = val;
                 found_flag = true;
                 break;
             }
+            v_in = val;
         }
-        else
+
+        if ( found_flag )
         {
-            v_in = val;
-            if ( !init_col_flag )
+            //==== Use BiSection To Refine In/Out Solutions ====//
+            for ( int i = 0 ; i < 5 ; i++ )
             {
-                found_flag = true;
-                break;
+                double val = (v_in + v_out)*0.5;
+                move_body( val );
+
+                if ( m_CollisionWorld.CheckIntersect( m_MovingBody ) )
+                    v_in = val;
+                else
+                    v_out = val;
             }
+            move_body( v_out );
+
+            //==== Target Distance Is Back Toward The Collision ====//
+            approach = -direction;
         }
     }
 
-    //==== Nothing Changed - Return ====//
-    if ( !found_flag  )
+    //==== Conservative Advancement To Target Distance ====//
+    // rate is sampled from one small parm change, so it only estimates the fastest
+    // surface motion.  Steps of (dist - target)/rate are shortened by a safety
+    // factor, a step that lands in intersection doubles rate and backs off, and
+    // the final value is checked for intersection.  If rate is badly
+    // underestimated a step can still carry a thin part through another without
+    // landing in it.  Negative steps back away when already too close.
+    if ( found_flag )
     {
-        if ( init_col_flag )
-            m_CollisionErrorFlag = vsp::COLLISION_INTERSECT_NO_SOLUTION;
-        else
-            m_CollisionErrorFlag = vsp::COLLISION_CLEAR_NO_SOLUTION;
-        parm_ptr->Set( revert_val );              // Restore Val
-        veh->Update( false );
-        for ( int i = 0 ; i < (int)other_tmesh_vec.size() ; i++ )
-            delete other_tmesh_vec[i];
-        return;
-    }
+        found_flag = false;
 
-    //==== Use BiSection To Refine In/Out Solutions ====//
-    for ( int i = 0 ; i < 5 ; i++ )
-    {
-        double val = (v_in + v_out)*0.5;
-        parm_ptr->Set( val );
-        veh->Update( false );
-        bool col_flag =  CheckIntersect( geom_ptr, other_tmesh_vec );
+        double target = m_CollisionTargetDist();
+        double max_dist = target + rate*val_range;
+        double tol = 1.0e-06*model_size;
+        double v = v_out;
+        double first_gap = -1.0;
+        double gap = 0.0;
+        bool out_of_iter = true;
 
-        if( col_flag )
-            v_in = val;
-        else
-            v_out = val;
-    }
+        for ( int i = 0 ; i < SNAP_ADVANCE_MAX_ITER ; i++ )
+        {
+            bool iflag;
+            double d = m_CollisionWorld.MinDistance( m_MovingBody, max_dist, iflag );
 
-    //==== Find Del Min Dist to Del Val And Iterate Soln ====//
-    bool iflag;
-    double v0 = v_out;
-    double closest_err = 1.0e12;
-    for ( int i = 0 ; i < 5 ; i++ )
-    {
-        parm_ptr->Set( v0 );
-        veh->Update( false );
-        double d0 = FindMinDistance( geom_id, other_tmesh_vec, iflag );
+            //==== Motion Underestimated (Only If Not Rigid) - Back Off ====//
+            if ( iflag )
+            {
+                rate *= 2.0;
+                v = 0.5*( v + v_out );
+                move_body( v );
+                continue;
+            }
 
-        //==== Check For Intersect ====//
-        if ( iflag )
-            break;
+            v_out = v;
+            gap = d - target;
+            if ( first_gap < 0.0 )
+                first_gap = std::abs( gap );
 
-        //==== Save Best Soln ====//
-        double err = std::abs( d0 - m_CollisionTargetDist() );
-        if ( err < closest_err )
-        {
-            v_out = v0;
-            closest_err = err;
+            if ( std::abs( gap ) < tol )
+            {
+                found_flag = true;
+                out_of_iter = false;
+                break;
+            }
 
-            //==== Good Enough Soln? ====//
-            if ( closest_err < 1.0e-06*model_size ) 
+            //==== Nothing To Reach Within Range ====//
+            double val = v + approach*gap/( SNAP_ADVANCE_SAFETY*rate );
+            if ( gap > 0.0 && std::abs( val - orig_val ) > val_range )
             {
+                out_of_iter = false;
                 break;
             }
-        }
 
-        //==== Slightly Offset v_out ====// 
-        double v1 = (v_out - v_in)*0.0001 + v_out;        // Away From v_in
-        parm_ptr->Set( v1 );
-        veh->Update( false );
-        double d1 = FindMinDistance( geom_id, other_tmesh_vec, iflag );
+            move_body( val );
 
-        //==== Check For Intersect ====//
-        if ( iflag )
-            break;
+            //==== Held At Parm Limit ====//
+            if ( std::abs( parm_ptr->Get() - v ) < DBL_EPSILON )
+            {
+                out_of_iter = false;
+                break;
+            }
 
-        double denom = d1 - d0;
-        if ( std::abs( denom ) < 1.0e-12 )
-            break;
+            v = parm_ptr->Get();
+        }
 
-        double fract = ( m_CollisionTargetDist() - d0 )/denom;
-        double val = v0 + fract*(v1 - v0);
+        //==== Out Of Iterations But Clearly Closing In - Keep Clear Value ====//
+        if ( out_of_iter && gap > 0.0 && gap < 0.5*first_gap )
+            found_flag = true;
+    }
 
-        //==== Check If Predicted Point Intersects ====//
-        parm_ptr->Set( val );
+    //==== Nothing Changed - Return ====//
+    if ( !found_flag  )
+    {
+        if ( init_col_flag )
+            m_CollisionErrorFlag = vsp::COLLISION_INTERSECT_NO_SOLUTION;
+        else
+            m_CollisionErrorFlag = vsp::COLLISION_CLEAR_NO_SOLUTION;
+        parm_ptr->Set( revert_val );              // Restore Val
         veh->Update( false );
-        if ( CheckIntersect( geom_ptr, other_tmesh_vec ) )
-        {
-            val = v0 + 0.5*fract*(v1 - v0);         // Only go half way            
-        }
-        v0 = val;
+        return;
     }
 
     //==== Best Soln is v_out ====//
@@ -334,13 +344,21 @@ void SnapTo::AdjParmToMinDist( const string & parm_id, bool inc_flag )
     }
 
     veh->Update( true );
+    m_MovingBody.Update( geom_ptr, refit_flag );
 
-    m_CollisionMinDist = FindMinDistance( geom_id, other_tmesh_vec, iflag );
-    m_CollisionErrorFlag = vsp::COLLISION_OK;
+    bool iflag;
+    m_CollisionMinDist = m_CollisionWorld.MinDistance( m_MovingBody, 1.0e12, iflag );
+
+    //==== Final Value Must Be Clear ====//
+    if ( iflag )
+    {
+        m_CollisionErrorFlag = init_col_flag ? vsp::COLLISION_INTERSECT_NO_SOLUTION : vsp::COLLISION_CLEAR_NO_SOLUTION;
+        parm_ptr->Set( revert_val );              // Restore Val
+        veh->Update( false );
+        return;
+    }
 
-    //==== Delete Created TMeshes ====//
-    for ( int i = 0 ; i < (int)other_tmesh_vec.size() ; i++ )
-        delete other_tmesh_vec[i];
+    m_CollisionErrorFlag = vsp::COLLISION_OK;
 
     //==== Store Last Results ====//
     m_LastParmID = parm_id;
@@ -353,17 +371,7 @@ void SnapTo::AdjParmToMinDist( const string & parm_id, bool inc_flag )
 
 void SnapTo::CheckClearance( )
 {
-    int set = m_CollisionSet;
-
-    if ( m_UseMode() )
-    {
-        Mode *m = ModeMgr.GetMode( m_ModeID );
-        if ( m )
-        {
-            m->ApplySettings();
-            set = m->m_NormalSet();
-        }
-    }
+    int set = GetCollisionSet();
 
     Vehicle* veh = VehicleMgr.GetVehicle();
     vector< Geom* > select_vec = veh->GetActiveGeomPtrVec();
@@ -376,38 +384,10 @@ void SnapTo::CheckClearance( )
     Geom* geom_ptr = select_vec[0];
     if ( !geom_ptr )    return;
     string geom_id = geom_ptr->GetID();
- 
-    //==== Find Other Geoms ====//
-    vector< string > geom_id_vec = veh->GetGeomSet( set );
-    vector< string > other_geom_vec;
-    for ( int i = 0 ; i < (int)geom_id_vec.size() ; i++ )
-    {
-        if ( geom_id != geom_id_vec[i] )
-            other_geom_vec.push_back( geom_id_vec[i] );
-    }
 
-    //==== Create TMeshes =====//
-    vector< TMesh* > other_tmesh_vec;
-    for ( int i = 0 ; i < (int)other_geom_vec.size() ; i++ )
-    {
-        Geom* g_ptr = veh->FindGeom( other_geom_vec[i] );
-        if ( g_ptr )
-        {
-             vector< TMesh* > tvec = g_ptr->CreateTMeshVec( false );       /////////// MUST DELETE!!!
-             for ( int j = 0 ; j < (int)tvec.size() ; j++ )
-             {
-                tvec[j]->LoadBndBox();
-                other_tmesh_vec.push_back( tvec[j] );
-             }
-        }
-    }
+    UpdateCollisionWorld( geom_id, set );
+    m_MovingBody.Update( geom_ptr );
 
     bool iflag;
-    m_CollisionMinDist = FindMinDistance( geom_id, other_tmesh_vec, iflag );
-
-    //==== Delete Created TMeshes ====//
-    for ( int i = 0 ; i < (int)other_tmesh_vec.size() ; i++ )
-        delete other_tmesh_vec[i];
-
-
+    m_CollisionMinDist = m_CollisionWorld.MinDistance( m_MovingBody, 1.0e12, iflag );
 }
@@ -14,6 +14,7 @@
 #include "Parm.h"
 #include "ParmContainer.h"
 #include "TMesh.h"
+#include "CollisionWorld.h"
 
 //==== SnapTo ====//
 class SnapTo : public ParmContainer
@@ -24,7 +25,6 @@ public:
     virtual void ParmChanged( Parm* parm_ptr, int type );
 
     void PreventCollision( const string & geom_id, const string & parm_id );
-    static double FindMinDistance(const string & geom_id, const vector< TMesh* > & other_tmesh_vec, bool & intersect_flag );
     void AdjParmToMinDist( const string & parm_id, bool inc_flag );
     void CheckClearance(  );
 
@@ -40,6 +40,13 @@ public:
 
 protected:
 
+    int GetCollisionSet();
+    void UpdateCollisionWorld( const string & geom_id, int set );
+
+    //==== Other Geoms And The Moving Geom, Kept Between Calls ====//
+    CollisionWorld m_CollisionWorld;
+    CollisionBody m_MovingBody;
+
     //===== Store Last Values ====//
     string m_LastParmID;
     double m_LastParmVal;
@@ -3600,10 +3600,32 @@ xmlNodePtr TMesh::EncodeXml( xmlNodePtr & node )
 {
     xmlNodePtr tmesh_node = xmlNewChild( node, nullptr, BAD_CAST "TMesh", nullptr );
     XmlUtil::AddIntNode( tmesh_node, "Num_Tris", ( int )m_TVec.size() );
-    EncodeTriList( tmesh_node );
+
+    if ( XmlUtil::GetBinaryArrayMode() != XmlUtil::BINARY_ARRAY_NONE )
+    {
+        EncodeTriData( tmesh_node );
+    }
+    else
+    {
+        EncodeTriList( tmesh_node );
+    }
     return tmesh_node;
 }
 
+//==== All Tris In One Binary Block - N0, N1, N2, Norm Per Tri ====//
+xmlNodePtr TMesh::EncodeTriData( xmlNodePtr & node )
+{
+    vector< double > data( 12 * m_TVec.size() );
+    for ( int i = 0 ; i < ( int ) m_TVec.size() ; i++ )
+    {
+        m_TVec[i]->m_N0->m_Pnt.get_pnt( &data[ 12 * i ] );
+        m_TVec[i]->m_N1->m_Pnt.get_pnt( &data[ 12 * i + 3 ] );
+        m_TVec[i]->m_N2->m_Pnt.get_pnt( &data[ 12 * i + 6 ] );
+        m_TVec[i]->m_Norm.get_pnt( &data[ 12 * i + 9 ] );
+    }
+    return XmlUtil::AddBinaryDoubleArrayNode( node, "Tri_Data", data.data(), ( int )data.size() );
+}
+
 xmlNodePtr TMesh::EncodeTriList( xmlNodePtr & node )
 {
     xmlNodePtr tri_list_node = xmlNewChild( node, nullptr, BAD_CAST "Tri_List", nullptr );
@@ -3622,6 +3644,14 @@ xmlNodePtr TMesh::EncodeTriList( xmlNodePtr & node )
 
 void TMesh::DecodeXml( xmlNodePtr & node )
 {
+    xmlNodePtr tri_data_node = XmlUtil::GetNode( node, "Tri_Data", 0 );
+    if ( tri_data_node && DecodeTriData( tri_data_node ) )
+    {
+        return;
+    }
+
+    // Binary block missing or damaged, use the text triangles if there are any.
+
     xmlNodePtr tri_list_node = XmlUtil::GetNode( node, "Tri_List", 0 );
     if ( tri_list_node )
     {
@@ -3680,6 +3710,39 @@ void TMesh::DecodeTriList( xmlNodePtr & node, int num_tris )
     }
 }
 
+bool TMesh::DecodeTriData( xmlNodePtr & node )
+{
+    vector< double > data;
+    if ( !XmlUtil::GetBinaryDoubleArrayNode( node, data ) )
+    {
+        return false;
+    }
+
+    int num_tris = ( int )data.size() / 12;
+    m_TVec.resize( num_tris );
+    m_NVec.reserve( m_NVec.size() + 3 * num_tris );
+
+    for ( int i = 0 ; i < num_tris ; i++ )
+    {
+        const double* d = &data[ 12 * i ];
+
+        m_TVec[i] = new TTri( this );
+        m_TVec[i]->m_N0 = new TNode();
+        m_TVec[i]->m_N1 = new TNode();
+        m_TVec[i]->m_N2 = new TNode();
+
+        m_NVec.push_back( m_TVec[i]->m_N0 );
+        m_NVec.push_back( m_TVec[i]->m_N1 );
+        m_NVec.push_back( m_TVec[i]->m_N2 );
+
+        m_TVec[i]->m_N0->m_Pnt.set_xyz( d[0], d[1], d[2] );
+        m_TVec[i]->m_N1->m_Pnt.set_xyz( d[3], d[4], d[5] );
+        m_TVec[i]->m_N2->m_Pnt.set_xyz( d[6], d[7], d[8] );
+        m_TVec[i]->m_Norm.set_xyz( d[9], d[10], d[11] );
+    }
+    return true;
+}
+
 void TMesh::LoadGeomAttributes( const Geom* geomPtr )
 {
     /*color       = geomPtr->getColor();
@@ -56,6 +56,7 @@ class TBndBox;
 class NBndBox;
 class TMesh;
 class PGMesh;
+class Results;
 
 struct dba_point
 {
@@ -470,6 +471,8 @@ public:
     virtual void DecodeXml( xmlNodePtr & node );
     virtual xmlNodePtr EncodeTriList( xmlNodePtr & node );
     virtual void DecodeTriList( xmlNodePtr & node, int num_tris );
+    virtual xmlNodePtr EncodeTriData( xmlNodePtr & node );
+    virtual bool DecodeTriData( xmlNodePtr & node );
 
     void LoadGeomAttributes( const Geom* geomPtr );
     int  RemoveDegenerate();
@@ -667,6 +670,29 @@ protected:
 
 };
 
+//==== Outcome Of An Interference Check Between Two Meshes ====//
+class InterferenceData
+{
+public:
+    InterferenceData();
+
+    void AddResults( Results *res ) const;
+
+    bool m_Interference;
+    bool m_Intersection;
+    bool m_PrimaryInSecondary;
+    bool m_SecondaryInPrimary;
+    double m_MinDist;
+    double m_MaxMinDist;
+    vector < vec3d > m_Pts;
+    double m_Vol;
+    double m_VolPrimary;      // Set by the caller.
+    double m_VolSecondary;
+    double m_ConDist;
+    double m_ConVol;
+    int m_Contained;          // -1 none, 0 primary in secondary, 1 secondary in primary.
+};
+
 void CreateTMeshVecFromPts( const Geom * geom,
                             vector < TMesh* > & TMeshVec,
                             const vector< vector<vec3d> > & pnts,
@@ -730,6 +756,13 @@ void LookAtVisibility( TMesh *primary_tm, const vec3d & dir, double n2, const st
 void PlaneInterferenceCheck(  TMesh *primary_tm, const vec3d & org, const vec3d & norm, const string & resid, vector< TMesh* > & result_tmv );
 void CCEInterferenceCheck(  TMesh *primary_tm, TMesh *secondary_tm, const string & resid, vector< TMesh* > & result_tmv );
 string PlaneAngleInterferenceCheck( vector< TMesh* > & primary_tmv, const vec3d & org, const vec3d & norm, const vec3d & ptaxis, const vec3d & axis, vector< TMesh* > & result_tmv );
+// Read-only stage of the exterior and packaging checks.  Both meshes must be flattened
+// with bounding boxes loaded.  They are not modified, so may be shared between threads.
+void InterferenceMeasure( TMesh *primary_tm, TMesh *secondary_tm, bool packaging, InterferenceData & data );
+// Builds the interference meshes into result_tmv from copies of the inputs.  Uses
+// SubSurfaceMgr, so must not run concurrently with other mesh intersections.
+void InterferenceResolve( TMesh *primary_tm, TMesh *secondary_tm, bool packaging, InterferenceData & data, vector< TMesh* > & result_tmv );
+TMesh* SweptVolumeMesh( TMesh *secondary_tm, const vec3d &dstart, const vector < vec3d > & dispvec );
 void SweptVolumeInterferenceCheck( TMesh *primary_tm, TMesh *secondary_tm, const vector < vec3d > & dispvec, const string & resid, vector< TMesh* > & result_tmv );
 void ExteriorInterferenceCheck( TMesh *primary_tm, TMesh *secondary_tm, const string & resid, vector< TMesh* > & result_tmv );
 void ExteriorInterferenceCheck( vector< TMesh* > & primary_tmv, vector< TMesh* > & secondary_tmv, const string & resid, vector< TMesh* > & result_tmv );
@@ -762,6 +795,7 @@ void WriteInsideMStl( const string &file_name, TMesh* tm, int minside );
 void MakeThreePts( const vec3d & org, const vec3d & norm, vector <vec3d> &threepts );
 TMesh* MakeSlice( const vec3d & org, const vec3d & norm, const double & len );
 TMesh* MakeSlice( const int &swdir, const double & len );
+double MakeSliceLocations( const BndBox & bbox, int numSlices, int swdir, vector < double > &slicevec, bool mpslice = true, bool autoBounds = true, double start = 0, double end = 0 );
 double MakeSlices( vector<TMesh*> &tmv, const BndBox & bbox, int numSlices, int swdir, vector < double > &slicevec, bool mpslice = true, bool tesselate = true, bool autoBounds = true, double start = 0, double end = 0, int slctype = vsp::CFD_STRUCTURE );
 
 double CalcMeshDeviation( TMesh *tm, const vec3d &cen, const vec3d &norm );
@@ -780,6 +814,8 @@ TMesh* GetMeshByID( const vector < TMesh* > &tmv, const string &id );
 
 void DumpMeshes( const vector < TMesh* > &tmv, const string &prefix );
 void CreatePrism( vector< TetraMassProp* >& tetraVec, TTri* tri, double len, int idir );
+void CreatePrism( vector< TetraMassProp* >& tetraVec, const string& id, double density,
+                  const vec3d& n0, const vec3d& n1, const vec3d& n2, double len, int idir );
 
 void BuildTriVec( const TMesh* mesh, vector< TTri* > &trivec );
 void BuildTriVec( const vector< TMesh* > &meshvec, vector< TTri* > &trivec );
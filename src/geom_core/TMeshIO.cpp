@@ -151,23 +151,29 @@ void DumpMeshes( const vector < TMesh* > &tmv, const string &prefix )
 //==== Create a Prism Made of Tetras - Extrude Tri +- len/2 ====//
 void CreatePrism( vector< TetraMassProp* >& tetraVec, TTri* tri, double len, int idir )
 {
-    vec3d p0 = tri->m_N0->m_Pnt;
-    vec3d p1 = tri->m_N1->m_Pnt;
-    vec3d p2 = tri->m_N2->m_Pnt;
+    CreatePrism( tetraVec, tri->m_GeomID, tri->m_Density, tri->m_N0->m_Pnt, tri->m_N1->m_Pnt, tri->m_N2->m_Pnt, len, idir );
+}
+
+void CreatePrism( vector< TetraMassProp* >& tetraVec, const string& id, double density,
+                  const vec3d& n0, const vec3d& n1, const vec3d& n2, double len, int idir )
+{
+    vec3d p0 = n0;
+    vec3d p1 = n1;
+    vec3d p2 = n2;
     p0.offset_i( len / 2.0, idir );
     p1.offset_i( len / 2.0, idir );
     p2.offset_i( len / 2.0, idir );
 
-    vec3d p3 = tri->m_N0->m_Pnt;
-    vec3d p4 = tri->m_N1->m_Pnt;
-    vec3d p5 = tri->m_N2->m_Pnt;
+    vec3d p3 = n0;
+    vec3d p4 = n1;
+    vec3d p5 = n2;
     p3.offset_i( -len / 2.0, idir );
     p4.offset_i( -len / 2.0, idir );
     p5.offset_i( -len / 2.0, idir );
 
-    tetraVec.push_back( new TetraMassProp( tri->m_GeomID, tri->m_Density, p0, p2, p1, p3 ) );
-    tetraVec.push_back( new TetraMassProp( tri->m_GeomID, tri->m_Density, p2, p3, p5, p1 ) );
-    tetraVec.push_back( new TetraMassProp( tri->m_GeomID, tri->m_Density, p5, p3, p4, p1 ) );
+    tetraVec.push_back( new TetraMassProp( id, density, p0, p2, p1, p3 ) );
+    tetraVec.push_back( new TetraMassProp( id, density, p2, p3, p5, p1 ) );
+    tetraVec.push_back( new TetraMassProp( id, density, p5, p3, p4, p1 ) );
 }
 
 void BuildTriVec( const TMesh* mesh, vector< TTri* > &trivec )
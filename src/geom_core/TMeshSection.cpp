@@ -0,0 +1,545 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// TMeshSection.cpp: Direct planar cross sections of closed TMeshes.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "TMeshSection.h"
+#include "TMesh.h"
+#include "APIDefines.h"
+#include "ParallelUtil.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+using namespace Clipper2Lib;
+
+#define SECTION_BVH_LEAF 8
+#define SECTION_PARALLEL_CHUNK 4
+
+TMeshSection::TMeshSection()
+{
+    m_Area = 0;
+}
+
+//==== Copy Thick Mesh Triangles And Build BVH ====//
+TMeshSectionEngine::TMeshSectionEngine( const vector < TMesh* > &tmv )
+{
+    int nmesh = tmv.size();
+    m_MeshGeomID.resize( nmesh );
+    m_MeshCfdType.resize( nmesh );
+    m_MeshDensity.resize( nmesh );
+
+    BndBox box;
+    for ( int m = 0 ; m < nmesh ; m++ )
+    {
+        TMesh* tm = tmv[m];
+        m_MeshGeomID[m] = tm->m_OriginGeomID;
+        m_MeshCfdType[m] = tm->m_SurfCfdType;
+        m_MeshDensity[m] = tm->m_Density;
+
+        // Only thick surfaces enclose section area.
+        if ( !tm->m_ThickSurf )
+        {
+            continue;
+        }
+
+        m_PriorOrder.push_back( m );
+
+        for ( int t = 0 ; t < ( int )tm->m_TVec.size() ; t++ )
+        {
+            TTri* tri = tm->m_TVec[t];
+            m_Pnts.push_back( tri->m_N0->m_Pnt );
+            m_Pnts.push_back( tri->m_N1->m_Pnt );
+            m_Pnts.push_back( tri->m_N2->m_Pnt );
+            m_TriMesh.push_back( m );
+
+            box.Update( tri->m_N0->m_Pnt );
+            box.Update( tri->m_N1->m_Pnt );
+            box.Update( tri->m_N2->m_Pnt );
+        }
+    }
+
+    // Stable sort keeps the first mesh on ties, matching DeterIntExtTri().
+    std::stable_sort( m_PriorOrder.begin(), m_PriorOrder.end(), [&]( int a, int b )
+    {
+        return tmv[a]->m_MassPrior > tmv[b]->m_MassPrior;
+    } );
+
+    double size = box.GetLargestDist();
+    if ( size <= 0 )
+    {
+        size = 1.0;
+    }
+    m_Scale = 1.0e9 / size;
+    m_Tol = 1.0e-9 * size;
+
+    int ntri = m_TriMesh.size();
+    m_TriOrder.resize( ntri );
+    for ( int i = 0 ; i < ntri ; i++ )
+    {
+        m_TriOrder[i] = i;
+    }
+
+    if ( ntri > 0 )
+    {
+        m_Nodes.reserve( 2 * ntri / SECTION_BVH_LEAF + 1 );
+        BuildNode( 0, ntri );
+    }
+}
+
+//==== Median Split On Longest Centroid Axis ====//
+int TMeshSectionEngine::BuildNode( int start, int count )
+{
+    int inode = m_Nodes.size();
+    m_Nodes.push_back( BVHNode() );
+
+    BVHNode node;
+    node.m_Left = -1;
+    node.m_Right = -1;
+    node.m_Start = start;
+    node.m_Count = count;
+
+    BndBox box, cbox;
+    for ( int i = start ; i < start + count ; i++ )
+    {
+        int t = m_TriOrder[i];
+        box.Update( m_Pnts[3 * t] );
+        box.Update( m_Pnts[3 * t + 1] );
+        box.Update( m_Pnts[3 * t + 2] );
+        cbox.Update( ( m_Pnts[3 * t] + m_Pnts[3 * t + 1] + m_Pnts[3 * t + 2] ) / 3.0 );
+    }
+
+    for ( int k = 0 ; k < 3 ; k++ )
+    {
+        node.m_Min[k] = box.GetMin( k );
+        node.m_Max[k] = box.GetMax( k );
+    }
+
+    if ( count > SECTION_BVH_LEAF )
+    {
+        int axis = 0;
+        for ( int k = 1 ; k < 3 ; k++ )
+        {
+            if ( cbox.GetMax( k ) - cbox.GetMin( k ) > cbox.GetMax( axis ) - cbox.GetMin( axis ) )
+            {
+                axis = k;
+            }
+        }
+
+        int half = count / 2;
+        std::nth_element( m_TriOrder.begin() + start, m_TriOrder.begin() + start + half, m_TriOrder.begin() + start + count, [&]( int a, int b )
+        {
+            return m_Pnts[3 * a][axis] + m_Pnts[3 * a + 1][axis] + m_Pnts[3 * a + 2][axis] <
+                   m_Pnts[3 * b][axis] + m_Pnts[3 * b + 1][axis] + m_Pnts[3 * b + 2][axis];
+        } );
+
+        node.m_Left = BuildNode( start, half );
+        node.m_Right = BuildNode( start + half, count - half );
+        node.m_Count = 0;
+    }
+
+    m_Nodes[inode] = node;
+    return inode;
+}
+
+//==== Gather Triangles Whose Boxes Touch The Plane ====//
+void TMeshSectionEngine::CollectTris( const vec3d &org, const vec3d &norm, vector < int > &tris ) const
+{
+    tris.clear();
+    if ( m_Nodes.empty() )
+    {
+        return;
+    }
+
+    vector < int > stack;
+    stack.push_back( 0 );
+
+    while ( !stack.empty() )
+    {
+        const BVHNode &node = m_Nodes[ stack.back() ];
+        stack.pop_back();
+
+        double r = 0;
+        double s = 0;
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            double c = 0.5 * ( node.m_Max[k] + node.m_Min[k] );
+            double e = 0.5 * ( node.m_Max[k] - node.m_Min[k] );
+            r += e * std::abs( norm[k] );
+            s += ( c - org[k] ) * norm[k];
+        }
+
+        if ( std::abs( s ) > r + m_Tol )
+        {
+            continue;
+        }
+
+        if ( node.m_Left < 0 )
+        {
+            tris.insert( tris.end(), m_TriOrder.begin() + node.m_Start, m_TriOrder.begin() + node.m_Start + node.m_Count );
+        }
+        else
+        {
+            stack.push_back( node.m_Left );
+            stack.push_back( node.m_Right );
+        }
+    }
+}
+
+void TMeshSectionEngine::PlaneBasis( const vec3d &norm, vec3d &e1, vec3d &e2 ) const
+{
+    // Reference axis along the smallest normal component.
+    double ax = std::abs( norm.x() );
+    double ay = std::abs( norm.y() );
+    double az = std::abs( norm.z() );
+
+    vec3d ref( 0, 0, 1 );
+    if ( ax <= ay && ax <= az )
+    {
+        ref = vec3d( 1, 0, 0 );
+    }
+    else if ( ay <= az )
+    {
+        ref = vec3d( 0, 1, 0 );
+    }
+
+    e1 = cross( norm, ref );
+    e1.normalize();
+    e2 = cross( norm, e1 );
+    e2.normalize();
+}
+
+//==== Triangle-Plane Sweep Into Closed Contours For Each Mesh ====//
+void TMeshSectionEngine::BuildMeshRegions( const vector < int > &tris, const vec3d &org, const vec3d &norm,
+                                           const vec3d &e1, const vec3d &e2, vector < Paths64 > &regions ) const
+{
+    int nmesh = m_MeshGeomID.size();
+    regions.clear();
+    regions.resize( nmesh );
+
+    // Segment endpoints, two per segment, collected per mesh.
+    vector < vector < Point64 > > segpts( nmesh );
+
+    for ( int i = 0 ; i < ( int )tris.size() ; i++ )
+    {
+        int t = tris[i];
+        const vec3d *p = &m_Pnts[3 * t];
+
+        // Points on the plane count as above so shared vertices and edges
+        // classify the same way in every triangle.
+        double d[3];
+        bool above[3];
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            d[k] = dot( p[k] - org, norm );
+            above[k] = d[k] >= 0;
+        }
+
+        if ( above[0] == above[1] && above[1] == above[2] )
+        {
+            continue;
+        }
+
+        Point64 cpt[2];
+        int ncross = 0;
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            int kn = ( k + 1 ) % 3;
+            if ( above[k] != above[kn] )
+            {
+                // Always interpolate from the below vertex so both triangles that
+                // share an edge produce bit-identical crossings.
+                int ib = above[k] ? kn : k;
+                int ia = above[k] ? k : kn;
+                double frac = d[ib] / ( d[ib] - d[ia] );
+                vec3d x = p[ib] + ( p[ia] - p[ib] ) * frac - org;
+
+                cpt[ncross] = Point64( std::llround( dot( x, e1 ) * m_Scale ), std::llround( dot( x, e2 ) * m_Scale ) );
+                ncross++;
+            }
+        }
+
+        if ( ncross == 2 && cpt[0] != cpt[1] )
+        {
+            int m = m_TriMesh[t];
+            segpts[m].push_back( cpt[0] );
+            segpts[m].push_back( cpt[1] );
+        }
+    }
+
+    for ( int m = 0 ; m < nmesh ; m++ )
+    {
+        const vector < Point64 > &pts = segpts[m];
+        int npts = pts.size();
+        if ( npts == 0 )
+        {
+            continue;
+        }
+
+        // Pair up coincident endpoints of different segments.
+        vector < int > order( npts );
+        for ( int i = 0 ; i < npts ; i++ )
+        {
+            order[i] = i;
+        }
+        std::sort( order.begin(), order.end(), [&]( int a, int b )
+        {
+            if ( pts[a].x != pts[b].x )
+            {
+                return pts[a].x < pts[b].x;
+            }
+            return pts[a].y < pts[b].y;
+        } );
+
+        vector < int > mate( npts, -1 );
+        for ( int i = 0 ; i + 1 < npts ; i++ )
+        {
+            int a = order[i];
+            int b = order[i + 1];
+            if ( pts[a] == pts[b] )
+            {
+                mate[a] = b;
+                mate[b] = a;
+                i++;
+            }
+        }
+
+        // Walk segment to segment.  Chains that do not close are closed implicitly.
+        Paths64 loops;
+        vector < bool > used( npts / 2, false );
+        for ( int s = 0 ; s < npts / 2 ; s++ )
+        {
+            if ( used[s] )
+            {
+                continue;
+            }
+            used[s] = true;
+
+            Path64 loop;
+            loop.push_back( pts[2 * s] );
+            int cur = 2 * s + 1;
+
+            while ( true )
+            {
+                int next = mate[cur];
+                if ( next < 0 || used[ next / 2 ] )
+                {
+                    break;
+                }
+                loop.push_back( pts[cur] );
+                used[ next / 2 ] = true;
+                cur = next ^ 1;
+            }
+
+            if ( loop.size() >= 3 )
+            {
+                loops.push_back( loop );
+            }
+        }
+
+        // Odd crossing count means inside, as in DeterIntExtTri().
+        regions[m] = Union( loops, FillRule::EvenOdd );
+    }
+}
+
+//==== Cut All Meshes With One Plane ====//
+void TMeshSectionEngine::Section( const vec3d &org, const vec3d &norm, int slctype, TMeshSection &sec ) const
+{
+    int nmesh = m_MeshGeomID.size();
+
+    sec.m_Org = org;
+    sec.m_Norm = norm;
+    sec.m_Norm.normalize();
+    sec.m_Area = 0;
+    sec.m_AreaCenter = org;
+    sec.m_MeshArea.assign( nmesh, 0.0 );
+    sec.m_MeshRegion.clear();
+    sec.m_MeshRegion.resize( nmesh );
+    sec.m_MeshTris.clear();
+    sec.m_MeshTris.resize( nmesh );
+
+    vec3d e1, e2;
+    PlaneBasis( sec.m_Norm, e1, e2 );
+
+    vector < int > tris;
+    CollectTris( org, sec.m_Norm, tris );
+
+    vector < Paths64 > regions;
+    BuildMeshRegions( tris, org, sec.m_Norm, e1, e2, regions );
+
+    Paths64 normal, negative;
+    for ( int m = 0 ; m < nmesh ; m++ )
+    {
+        if ( m_MeshCfdType[m] == vsp::CFD_NORMAL )
+        {
+            normal.insert( normal.end(), regions[m].begin(), regions[m].end() );
+        }
+        else if ( m_MeshCfdType[m] == vsp::CFD_NEGATIVE )
+        {
+            negative.insert( negative.end(), regions[m].begin(), regions[m].end() );
+        }
+    }
+
+    // Same keep rules as DecideIgnoreTri() for a structure or measure duct slice.
+    Paths64 kept;
+    if ( slctype == vsp::CFD_MEASURE_DUCT )
+    {
+        kept = Intersect( normal, negative, FillRule::NonZero );
+    }
+    else
+    {
+        kept = Difference( normal, negative, FillRule::NonZero );
+    }
+
+    if ( kept.empty() )
+    {
+        return;
+    }
+
+    // Attribute the kept region to meshes in priority order.
+    Paths64 remaining = kept;
+    for ( int i = 0 ; i < ( int )m_PriorOrder.size() && !remaining.empty() ; i++ )
+    {
+        int m = m_PriorOrder[i];
+        if ( regions[m].empty() )
+        {
+            continue;
+        }
+
+        sec.m_MeshRegion[m] = Intersect( remaining, regions[m], FillRule::NonZero );
+        sec.m_MeshArea[m] = std::abs( Area( sec.m_MeshRegion[m] ) ) / ( m_Scale * m_Scale );
+        remaining = Difference( remaining, regions[m], FillRule::NonZero );
+    }
+
+    // Area and centroid of the whole kept region.
+    double a2 = 0;
+    double cx = 0;
+    double cy = 0;
+    for ( int i = 0 ; i < ( int )kept.size() ; i++ )
+    {
+        const Path64 &pth = kept[i];
+        int n = pth.size();
+        for ( int j = 0 ; j < n ; j++ )
+        {
+            double x0 = ( double )pth[j].x;
+            double y0 = ( double )pth[j].y;
+            double x1 = ( double )pth[( j + 1 ) % n].x;
+            double y1 = ( double )pth[( j + 1 ) % n].y;
+            double c = x0 * y1 - x1 * y0;
+            a2 += c;
+            cx += ( x0 + x1 ) * c;
+            cy += ( y0 + y1 ) * c;
+        }
+    }
+
+    sec.m_Area = std::abs( a2 ) * 0.5 / ( m_Scale * m_Scale );
+    if ( a2 != 0 )
+    {
+        cx = cx / ( 3.0 * a2 * m_Scale );
+        cy = cy / ( 3.0 * a2 * m_Scale );
+        sec.m_AreaCenter = org + e1 * cx + e2 * cy;
+    }
+}
+
+void TMeshSectionEngine::Section( const vector < vec3d > &orgs, const vector < vec3d > &norms, int slctype, vector < TMeshSection > &secs, bool triangulate ) const
+{
+    int n = std::min( orgs.size(), norms.size() );
+    secs.resize( n );
+
+    ParallelFor( n, SECTION_PARALLEL_CHUNK, [&]( int begin, int end )
+    {
+        for ( int i = begin ; i < end ; i++ )
+        {
+            Section( orgs[i], norms[i], slctype, secs[i] );
+
+            if ( triangulate )
+            {
+                Triangulate( secs[i] );
+            }
+        }
+    } );
+}
+
+//==== Triangulate Section Regions In The Cutting Plane ====//
+bool TMeshSectionEngine::Triangulate( TMeshSection &sec ) const
+{
+    vec3d e1, e2;
+    PlaneBasis( sec.m_Norm, e1, e2 );
+
+    sec.m_MeshTris.clear();
+    sec.m_MeshTris.resize( sec.m_MeshRegion.size() );
+    sec.m_TriFailMesh.clear();
+
+    for ( int m = 0 ; m < ( int )sec.m_MeshRegion.size() ; m++ )
+    {
+        if ( sec.m_MeshRegion[m].empty() )
+        {
+            continue;
+        }
+
+        Paths64 tris;
+        if ( Clipper2Lib::Triangulate( sec.m_MeshRegion[m], tris ) != TriangulateResult::success )
+        {
+            sec.m_TriFailMesh.push_back( m );
+            continue;
+        }
+
+        vector < vec3d > &pnts = sec.m_MeshTris[m];
+        pnts.reserve( 3 * tris.size() );
+        for ( int t = 0 ; t < ( int )tris.size() ; t++ )
+        {
+            if ( tris[t].size() != 3 )
+            {
+                continue;
+            }
+
+            vec3d v[3];
+            for ( int k = 0 ; k < 3 ; k++ )
+            {
+                v[k] = sec.m_Org + e1 * ( ( double )tris[t][k].x / m_Scale ) + e2 * ( ( double )tris[t][k].y / m_Scale );
+            }
+
+            // Orient triangles with the plane normal.
+            if ( dot( cross( v[1] - v[0], v[2] - v[0] ), sec.m_Norm ) < 0 )
+            {
+                std::swap( v[1], v[2] );
+            }
+
+            pnts.push_back( v[0] );
+            pnts.push_back( v[1] );
+            pnts.push_back( v[2] );
+        }
+    }
+
+    return sec.m_TriFailMesh.empty();
+}
+
+//==== Slice TMesh From Triangulated Section ====//
+TMesh* TMeshSectionEngine::MakeSliceTMesh( const TMeshSection &sec, int slctype ) const
+{
+    TMesh* tm = new TMesh();
+    tm->m_ThickSurf = false;
+    tm->m_SurfCfdType = slctype;
+    tm->m_WetArea = sec.m_Area;
+    tm->m_AreaCenter = sec.m_AreaCenter;
+
+    int iQuad = 0;
+    for ( int m = 0 ; m < ( int )sec.m_MeshTris.size() ; m++ )
+    {
+        const vector < vec3d > &pnts = sec.m_MeshTris[m];
+        for ( int i = 0 ; i + 2 < ( int )pnts.size() ; i += 3 )
+        {
+            tm->AddTri( pnts[i], pnts[i + 1], pnts[i + 2], sec.m_Norm, iQuad );
+            tm->m_TVec.back()->m_GeomID = m_MeshGeomID[m];
+            tm->m_TVec.back()->m_Density = m_MeshDensity[m];
+            iQuad++;
+        }
+    }
+
+    return tm;
+}
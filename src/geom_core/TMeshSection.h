@@ -0,0 +1,117 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// TMeshSection.h: Direct planar cross sections of closed TMeshes.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(VSPTMESHSECTION__INCLUDED_)
+#define VSPTMESHSECTION__INCLUDED_
+
+#include "clipper2/clipper.h"
+
+#include "Vec3d.h"
+
+#include <vector>
+#include <string>
+
+using std::string;
+using std::vector;
+
+class TMesh;
+
+//==== Result Of Cutting A Set Of TMeshes With One Plane ====//
+class TMeshSection
+{
+public:
+    TMeshSection();
+
+    vec3d m_Org;
+    vec3d m_Norm;
+
+    double m_Area;              // Section area measured in the cutting plane.
+    vec3d m_AreaCenter;
+
+    vector < double > m_MeshArea;                   // Area attributed to each mesh by mass priority.
+    vector < Clipper2Lib::Paths64 > m_MeshRegion;   // Section region attributed to each mesh.
+    vector < vector < vec3d > > m_MeshTris;         // Triangulated m_MeshRegion, three points per triangle.
+    vector < int > m_TriFailMesh;                   // Meshes whose m_MeshRegion could not be triangulated.
+};
+
+//==== Plane Section Engine ====//
+// Cuts closed thick TMeshes with planes without building slice meshes.  Each plane
+// collects the triangles it crosses from a BVH, chains the triangle-plane
+// segments into closed contours per mesh and combines them with polygon
+// booleans following the same CFD type rules as SetIgnoreTriFlag().  Section
+// area is attributed to the containing mesh with the highest m_MassPrior, as
+// DeterIntExtTri() does for slice triangles.
+class TMeshSectionEngine
+{
+public:
+    TMeshSectionEngine( const vector < TMesh* > &tmv );
+
+    void Section( const vec3d &org, const vec3d &norm, int slctype, TMeshSection &sec ) const;
+
+    // Evaluates all planes in parallel, optionally triangulating each section.
+    void Section( const vector < vec3d > &orgs, const vector < vec3d > &norms, int slctype, vector < TMeshSection > &secs, bool triangulate = false ) const;
+
+    // Fills m_MeshTris.  Safe to call from worker threads, so failures are only
+    // recorded in m_TriFailMesh for the caller to report.  Returns false on failure.
+    bool Triangulate( TMeshSection &sec ) const;
+
+    // Slice mesh built from m_MeshTris, triangles carry the GeomID and density of their mesh.
+    TMesh* MakeSliceTMesh( const TMeshSection &sec, int slctype ) const;
+
+    double GetMeshDensity( int m ) const
+    {
+        return m_MeshDensity[m];
+    }
+
+    int GetNumMeshes() const
+    {
+        return ( int )m_MeshGeomID.size();
+    }
+
+    const string & GetMeshGeomID( int m ) const
+    {
+        return m_MeshGeomID[m];
+    }
+
+protected:
+
+    struct BVHNode
+    {
+        double m_Min[3];
+        double m_Max[3];
+        int m_Left;     // Child index, -1 for leaves.
+        int m_Right;
+        int m_Start;    // Range into m_TriOrder for leaves.
+        int m_Count;
+    };
+
+    int BuildNode( int start, int count );
+    void CollectTris( const vec3d &org, const vec3d &norm, vector < int > &tris ) const;
+
+    void PlaneBasis( const vec3d &norm, vec3d &e1, vec3d &e2 ) const;
+    void BuildMeshRegions( const vector < int > &tris, const vec3d &org, const vec3d &norm,
+                           const vec3d &e1, const vec3d &e2, vector < Clipper2Lib::Paths64 > &regions ) const;
+
+    // Triangle vertices, three per triangle, and the mesh each belongs to.
+    vector < vec3d > m_Pnts;
+    vector < int > m_TriMesh;
+
+    vector < int > m_TriOrder;
+    vector < BVHNode > m_Nodes;
+
+    vector < string > m_MeshGeomID;
+    vector < int > m_MeshCfdType;
+    vector < double > m_MeshDensity;
+    vector < int > m_PriorOrder;    // Thick meshes, highest m_MassPrior first.
+
+    double m_Scale;                 // Model units to Clipper integer units.
+    double m_Tol;
+};
+
+#endif
@@ -38,7 +38,11 @@
 #include "delabella.h"
 #include "StlHelper.h"
 #include "DegenGeom.h"
+#include "TMeshSection.h"
+#include "ParallelUtil.h"
 
+#define MASS_SLICE_PARALLEL_CHUNK 4
+#define VISIBILITY_PARALLEL_CHUNK 16
 
 void CreateTMeshVecFromPts( const Geom * geom,
                             vector < TMesh* > & TMeshVec,
@@ -999,27 +1003,37 @@ void DiscreteVisibility( vector < TMesh* > & primary_tmv, const vector < double
         primary_tmv[i]->LoadBndBox();
     }
 
-    vector < vec3d > dir_vec;
-    vector < double > dviz_vec, dmiss_vec;
-    vector < double > dfovviz_vec, dfovmiss_vec;
-    vector < double > badsum_vec;
-    vector < int > viz_vec;
-    vector < vec3d > pts;
-
-    double badsum_total = 0;
     for ( int icen = 0; icen < ( int )cen_vec.size(); icen++ )
     {
-        const vec3d &cen = cen_vec[ icen ];
-
-        TMesh *fov = nullptr;
         if ( fov_vec[ icen ] )
         {
-            fov = fov_vec[ icen ];
-            fov->LoadBndBox();
+            fov_vec[ icen ]->LoadBndBox();
         }
+    }
+
+    //==== Evaluate All Center/Direction Pairs Concurrently ====//
+    // Ray casts only read the meshes and boxes, each pair writes its own slot.
+    int ndir = azvec.size();
+    int ncase = cen_vec.size() * ndir;
 
-        for ( int i = 0; i < azvec.size(); ++i )
+    vector < vec3d > dir_vec( ncase );
+    vector < double > dviz_vec( ncase ), dmiss_vec( ncase );
+    vector < double > dfovviz_vec( ncase ), dfovmiss_vec( ncase );
+    vector < double > badsum_vec( ncase );
+    vector < int > viz_vec( ncase );
+    vector < vector < vec3d > > case_pts( ncase );
+
+    ParallelFor( ncase, VISIBILITY_PARALLEL_CHUNK, [&]( int begin, int end )
+    {
+        for ( int icase = begin; icase < end; icase++ )
         {
+            int icen = icase / ndir;
+            int i = icase % ndir;
+
+            const vec3d &cen = cen_vec[ icen ];
+            TMesh *fov = fov_vec[ icen ];
+            vector < vec3d > &pts = case_pts[ icase ];
+
             vec3d dir = -ToCartesian( vec3d( 1.0, -azvec[i] * M_PI / 180.0, -elvec[i] * M_PI / 180.0 ) );
 
             vector < double > tParmVec;
@@ -1105,16 +1119,23 @@ void DiscreteVisibility( vector < TMesh* > & primary_tmv, const vector < double
                 pts.push_back( closest_distpts[1] );
             }
 
-            dir_vec.push_back( dir );
-            dviz_vec.push_back( dviz );
-            dmiss_vec.push_back( dmiss );
-            dfovviz_vec.push_back( dfovviz );
-            dfovmiss_vec.push_back( dfovmiss );
-            badsum_vec.push_back( badsum );
-            viz_vec.push_back( viz );
-
-            badsum_total += badsum;
+            dir_vec[ icase ] = dir;
+            dviz_vec[ icase ] = dviz;
+            dmiss_vec[ icase ] = dmiss;
+            dfovviz_vec[ icase ] = dfovviz;
+            dfovmiss_vec[ icase ] = dfovmiss;
+            badsum_vec[ icase ] = badsum;
+            viz_vec[ icase ] = viz;
         }
+    } );
+
+    // Gather in center/direction order.
+    vector < vec3d > pts;
+    double badsum_total = 0;
+    for ( int icase = 0; icase < ncase; icase++ )
+    {
+        pts.insert( pts.end(), case_pts[ icase ].begin(), case_pts[ icase ].end() );
+        badsum_total += badsum_vec[ icase ];
     }
 
     //==== Create Results ====//
@@ -1544,137 +1565,234 @@ void CCEInterferenceCheck(  TMesh *primary_tm, TMesh *secondary_tm, const string
 
 }
 
-void SweptVolumeInterferenceCheck(  TMesh *primary_tm, TMesh *secondary_tm, const vector < vec3d > & dispvec, const string & resid, vector< TMesh* > & result_tmv )
+InterferenceData::InterferenceData()
 {
-    TMesh * swept_secondary_tm = CreateTMeshPGMeshSweptVolumeTranslate( secondary_tm, dispvec );
-    delete secondary_tm;
-    swept_secondary_tm->LoadBndBox();
-
-    TMesh * swept_secondary_tm_copy = new TMesh();
-    swept_secondary_tm_copy->CopyFlatten( swept_secondary_tm );
+    m_Interference = false;
+    m_Intersection = false;
+    m_PrimaryInSecondary = false;
+    m_SecondaryInPrimary = true;
+    m_MinDist = 1.0e12;
+    m_MaxMinDist = 0;
+    m_Pts.resize( 2 );
+    m_Vol = 0;
+    m_VolPrimary = 0;
+    m_VolSecondary = 0;
+    m_ConDist = 1.0e12;
+    m_ConVol = -1; // Not the true volume.
+    m_Contained = -1;
+}
 
-    ExteriorInterferenceCheck( primary_tm, swept_secondary_tm, resid, result_tmv );
+void InterferenceData::AddResults( Results *res ) const
+{
+    if( res )
+    {
+        double gcon = m_ConDist * m_ConVol;
+        double gcon2 = m_MaxMinDist + m_MinDist * m_ConVol;
 
-    // Place swept volume copy at start of result_tmv
-    result_tmv.insert( result_tmv.begin(), swept_secondary_tm_copy );
+        // Populate results.
+        res->Add( new NameValData( "Interference", m_Interference, "Flag indicating the primary and secondary interfere." ) );
+        res->Add( new NameValData( "Intersection", m_Intersection, "Flag indicating the primary and secondary intersect." ) );
+        res->Add( new NameValData( "Primary_In_Secondary", m_PrimaryInSecondary, "Flag indicating the primary is contained within the secondary." ) );
+        res->Add( new NameValData( "Secondary_In_Primary", m_SecondaryInPrimary, "Flag indicating the secondary is contained within the primary." ) );
+        res->Add( new NameValData( "Min_Dist", m_MinDist, "Minimum distance between primary and secondary." ) );
+        res->Add( new NameValData( "MaxMin_Dist", m_MaxMinDist, "Maximum minimum distance between overlapping primary and secondary." ) );
+        res->Add( new NameValData( "Pts", m_Pts, "Minimum distance line end points." ) );
+        res->Add( new NameValData( "InterferenceVol", m_Vol, "Volume of interference." ) );
+        res->Add( new NameValData( "Vol_Primary", m_VolPrimary, "Volume of primary." ) );
+        res->Add( new NameValData( "Vol_Secondary", m_VolSecondary, "Volume of secondary." ) );
+        res->Add( new NameValData( "Con_Val", gcon, "Constraint value" ) );
+        res->Add( new NameValData( "Con_Val2", gcon2, "Alternate constraint value" ) );
+        res->Add( new NameValData( "Result", gcon, "Interference result" ) );
+    }
 }
 
-void ExteriorInterferenceCheck( TMesh *primary_tm, TMesh *secondary_tm, const string & resid, vector< TMesh* > & result_tmv )
+// Same test as DeterIntExtTri( tri, mesh ), but leaves tri untouched so the
+// meshes can be shared between threads.
+static bool TriInsideTMesh( TTri* tri, TMesh* mesh, const vec3d &dir = vec3d( 1.0, 0.000001, 0.000001 ) )
 {
-    bool intersect_flag = false;
-    bool interference_flag = false;
+    if ( !tri || mesh == tri->GetTMeshPtr() || !mesh->m_ThickSurf )
+    {
+        return false;
+    }
 
-    double vol_primary = primary_tm->ComputeTheoVol();
-    double vol_secondary = secondary_tm->ComputeTheoVol();
+    vec3d orig = ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt + tri->m_N2->m_Pnt ) / 3.0;
 
-    double maximin = 0;
-    double min_dist = 1.0e12;
-    double con_dist = 1.0e12;
-    double con_vol = -1; // Not the true volume.
-    double vol = 0;
+    vector < double > tParmVec;
+    vector < TTri* > triVec;
+    mesh->m_TBox.RayCast( orig, dir, tParmVec, triVec );
 
-    bool primary_in_secondary = false;
-    bool secondary_in_primary = true;
-    vector < vec3d > pts( 2 );
+    return ( tParmVec.size() % 2 ) != 0;
+}
 
-    double vref = min( vol_primary, vol_secondary );
+static TMesh* CopyFlattenTMesh( TMesh* tm )
+{
+    TMesh *copy = new TMesh();
+    copy->CopyFlatten( tm );
+    return copy;
+}
 
+void InterferenceMeasure( TMesh *primary_tm, TMesh *secondary_tm, bool packaging, InterferenceData & data )
+{
     if ( primary_tm->CheckIntersect( secondary_tm ) )
     {
-        intersect_flag = true;
-        interference_flag = true;
+        data.m_Intersection = true;
+        data.m_Interference = true;
+        return;
+    }
 
-        result_tmv.push_back( primary_tm );
-        result_tmv.push_back( secondary_tm );
-        MeshIntersect( result_tmv );
-        FlattenTMeshVec( result_tmv ); // Not required for volume calculations, do it for visualization and later use.
+    data.m_MinDist = primary_tm->MinDistance( secondary_tm, data.m_MinDist, data.m_Pts[0], data.m_Pts[1] );
+    data.m_ConDist = data.m_MinDist;
 
-        int ifewer = 0;
-        if ( result_tmv[ 0 ]->m_TVec.size() > result_tmv[ 1 ]->m_TVec.size() )
+    if ( primary_tm->m_TVec.empty() || secondary_tm->m_TVec.empty() )
+    {
+        return;
+    }
+
+    TTri *trip = primary_tm->m_TVec[0];
+    TTri *tris = secondary_tm->m_TVec[0];
+
+    if ( packaging )
+    {
+        if ( !TriInsideTMesh( tris, primary_tm ) ) // b not inside a
         {
-            ifewer = 1;
+            data.m_SecondaryInPrimary = true;
+            data.m_Contained = 1;
         }
-        result_tmv[ 0 ]->LoadBndBox();
-        result_tmv[ 1 ]->LoadBndBox();
+    }
+    else if ( TriInsideTMesh( trip, secondary_tm ) ) // a inside b
+    {
+        data.m_PrimaryInSecondary = true;
+        data.m_Contained = 0;
+    }
+    else if ( TriInsideTMesh( tris, primary_tm ) ) // b inside a
+    {
+        data.m_SecondaryInPrimary = true;
+        data.m_Contained = 1;
+    }
 
-        maximin = result_tmv[ ifewer ]->MaxMinDistancePt( result_tmv[ !ifewer ], maximin, pts[0], pts[1] );
+    if ( data.m_Contained >= 0 )
+    {
+        data.m_Interference = true;
+        data.m_ConVol = 1;
+        data.m_ConDist += 1.0;
+    }
+}
 
-        TMesh *result_tm = MergeTMeshVec( result_tmv );
-        DeleteTMeshVec( result_tmv );
-        result_tmv.push_back( result_tm );
+void InterferenceResolve( TMesh *primary_tm, TMesh *secondary_tm, bool packaging, InterferenceData & data, vector< TMesh* > & result_tmv )
+{
+    if ( data.m_Contained == 0 )
+    {
+        result_tmv.push_back( CopyFlattenTMesh( primary_tm ) );
+        return;
+    }
+    else if ( data.m_Contained == 1 )
+    {
+        result_tmv.push_back( CopyFlattenTMesh( secondary_tm ) );
+        return;
+    }
+    else if ( !data.m_Intersection )
+    {
+        return;
+    }
 
-        min_dist = 0.0;
-        con_dist = 1.0;
+    vector < TMesh* > tmv;
+    if ( packaging )
+    {
+        // Notice secondary first.
+        tmv.push_back( CopyFlattenTMesh( secondary_tm ) );
+        tmv.push_back( CopyFlattenTMesh( primary_tm ) );
 
-        for ( int i = 0; i < result_tmv.size(); i++ )
-        {
-            vol += result_tmv[i]->ComputeTrimVol();
-        }
-        con_vol = vol / vref;
+        MeshSubtract( tmv ); // Secondary - Primary
     }
     else
     {
-        min_dist = primary_tm->MinDistance( secondary_tm, min_dist, pts[0], pts[1] );
-        con_dist = min_dist;
+        tmv.push_back( CopyFlattenTMesh( primary_tm ) );
+        tmv.push_back( CopyFlattenTMesh( secondary_tm ) );
 
-        if ( !primary_tm->m_TVec.empty() && !secondary_tm->m_TVec.empty() )
-        {
-            TTri *trip = primary_tm->m_TVec[0];
-            TTri *tris = secondary_tm->m_TVec[0];
+        MeshIntersect( tmv );
+    }
+    FlattenTMeshVec( tmv ); // Not required for volume calculations, do it for visualization and later use.
 
+    int ifewer = 0;
+    if ( tmv[ 0 ]->m_TVec.size() > tmv[ 1 ]->m_TVec.size() )
+    {
+        ifewer = 1;
+    }
+    tmv[ 0 ]->LoadBndBox();
+    tmv[ 1 ]->LoadBndBox();
 
-            if ( DeterIntExtTri( trip, secondary_tm ) ) // a inside b
-            {
-                primary_in_secondary = true;
-                interference_flag = true;
-                result_tmv.push_back( primary_tm );
-                con_vol = 1;
-                con_dist += 1.0;
-                delete secondary_tm;
-            }
-            else if ( DeterIntExtTri( tris, primary_tm ) ) // b inside a
-            {
-                secondary_in_primary = true;
-                interference_flag = true;
-                result_tmv.push_back( secondary_tm );
-                con_vol = 1;
-                con_dist += 1.0;
-                delete primary_tm;
-            }
-            else
-            {
-                delete primary_tm;
-                delete secondary_tm;
-            }
-        }
-        else
+    data.m_MaxMinDist = tmv[ ifewer ]->MaxMinDistancePt( tmv[ !ifewer ], data.m_MaxMinDist, data.m_Pts[0], data.m_Pts[1] );
+
+    data.m_MinDist = 0.0;
+    data.m_ConDist = 1.0;
+
+    double vref = data.m_VolSecondary;
+
+    if ( packaging )
+    {
+        for ( int i = 0; i < tmv.size(); i++ )
         {
-            delete primary_tm;
-            delete secondary_tm;
+            data.m_Vol += tmv[i]->ComputeTheoVol();
         }
     }
+    else
+    {
+        vref = min( data.m_VolPrimary, data.m_VolSecondary );
 
-    double gcon = con_dist * con_vol;
-    double gcon2 = maximin + min_dist * con_vol;
+        TMesh *result_tm = MergeTMeshVec( tmv );
+        DeleteTMeshVec( tmv );
+        tmv.push_back( result_tm );
 
-    Results *res = ResultsMgr.FindResultsPtr( resid );
-    if( res )
-    {
-        // Populate results.
-        res->Add( new NameValData( "Interference", interference_flag, "Flag indicating the primary and secondary interfere." ) );
-        res->Add( new NameValData( "Intersection", intersect_flag, "Flag indicating the primary and secondary intersect." ) );
-        res->Add( new NameValData( "Primary_In_Secondary", primary_in_secondary, "Flag indicating the primary is contained within the secondary." ) );
-        res->Add( new NameValData( "Secondary_In_Primary", secondary_in_primary, "Flag indicating the secondary is contained within the primary." ) );
-        res->Add( new NameValData( "Min_Dist", min_dist, "Minimum distance between primary and secondary." ) );
-        res->Add( new NameValData( "MaxMin_Dist", maximin, "Maximum minimum distance between overlapping primary and secondary." ) );
-        res->Add( new NameValData( "Pts", pts, "Minimum distance line end points." ) );
-        res->Add( new NameValData( "InterferenceVol", vol, "Volume of interference." ) );
-        res->Add( new NameValData( "Vol_Primary", vol_primary, "Volume of primary." ) );
-        res->Add( new NameValData( "Vol_Secondary", vol_secondary, "Volume of secondary." ) );
-        res->Add( new NameValData( "Con_Val", gcon, "Constraint value" ) );
-        res->Add( new NameValData( "Con_Val2", gcon2, "Alternate constraint value" ) );
-        res->Add( new NameValData( "Result", gcon, "Interference result" ) );
+        data.m_Vol += result_tm->ComputeTrimVol();
     }
+    data.m_ConVol = data.m_Vol / vref;
+
+    result_tmv.insert( result_tmv.end(), tmv.begin(), tmv.end() );
+}
+
+TMesh* SweptVolumeMesh( TMesh *secondary_tm, const vec3d &dstart, const vector < vec3d > & dispvec )
+{
+    vector < TMesh* > tmv( 1, CopyFlattenTMesh( secondary_tm ) );
+
+    Matrix4d T;
+    T.translatev( dstart );
+    TransformMeshVec( tmv, T );
+
+    TMesh * swept_secondary_tm = CreateTMeshPGMeshSweptVolumeTranslate( tmv[0], dispvec );
+    DeleteTMeshVec( tmv );
+    swept_secondary_tm->LoadBndBox();
+
+    return swept_secondary_tm;
+}
+
+void SweptVolumeInterferenceCheck(  TMesh *primary_tm, TMesh *secondary_tm, const vector < vec3d > & dispvec, const string & resid, vector< TMesh* > & result_tmv )
+{
+    TMesh * swept_secondary_tm = CreateTMeshPGMeshSweptVolumeTranslate( secondary_tm, dispvec );
+    delete secondary_tm;
+    swept_secondary_tm->LoadBndBox();
+
+    TMesh * swept_secondary_tm_copy = new TMesh();
+    swept_secondary_tm_copy->CopyFlatten( swept_secondary_tm );
+
+    ExteriorInterferenceCheck( primary_tm, swept_secondary_tm, resid, result_tmv );
+
+    // Place swept volume copy at start of result_tmv
+    result_tmv.insert( result_tmv.begin(), swept_secondary_tm_copy );
+}
+
+void ExteriorInterferenceCheck( TMesh *primary_tm, TMesh *secondary_tm, const string & resid, vector< TMesh* > & result_tmv )
+{
+    InterferenceData data;
+    data.m_VolPrimary = primary_tm->ComputeTheoVol();
+    data.m_VolSecondary = secondary_tm->ComputeTheoVol();
+
+    InterferenceMeasure( primary_tm, secondary_tm, false, data );
+    InterferenceResolve( primary_tm, secondary_tm, false, data, result_tmv );
+
+    delete primary_tm;
+    delete secondary_tm;
+
+    data.AddResults( ResultsMgr.FindResultsPtr( resid ) );
 }
 
 void ExteriorInterferenceCheck( vector< TMesh* > & primary_tmv, vector< TMesh* > & secondary_tmv, const string & resid, vector< TMesh* > & result_tmv )
@@ -1694,118 +1812,28 @@ void ExteriorInterferenceCheck( vector< TMesh* > & primary_tmv, vector< TMesh* >
 
 string PackagingInterferenceCheck( vector< TMesh* > & primary_tmv, vector< TMesh* > & secondary_tmv, vector< TMesh* > & result_tmv )
 {
-    bool intersect_flag = false;
-    bool interference_flag = false;
-
     CSGMesh( primary_tmv );
     FlattenTMeshVec( primary_tmv );
     TMesh *primary_tm = MergeTMeshVec( primary_tmv );
     primary_tm->LoadBndBox();
-    double vol_primary = primary_tm->ComputeTheoVol();
 
     CSGMesh( secondary_tmv );
     FlattenTMeshVec( secondary_tmv );
     TMesh *secondary_tm = MergeTMeshVec( secondary_tmv );
     secondary_tm->LoadBndBox();
-    double vol_secondary = secondary_tm->ComputeTheoVol();
-
-
-    double maximin = 0;
-    double min_dist = 1.0e12;
-    double con_dist = 1.0e12;
-    double con_vol = -1; // Not the true volume.
-    double vol = 0;
-
-    bool primary_in_secondary = false;
-    bool secondary_in_primary = true;
-    vector < vec3d > pts( 2 );
-
-
-    double vref = vol_secondary; // min( vol_primary, vol_secondary );
 
-    if ( primary_tm->CheckIntersect( secondary_tm ) )
-    {
-        intersect_flag = true;
-        interference_flag = true;
-
-        // Notice secondary first.
-        result_tmv.push_back( secondary_tm );
-        result_tmv.push_back( primary_tm );
+    InterferenceData data;
+    data.m_VolPrimary = primary_tm->ComputeTheoVol();
+    data.m_VolSecondary = secondary_tm->ComputeTheoVol();
 
-        MeshSubtract( result_tmv ); // Secondary - Primary
-        FlattenTMeshVec( result_tmv ); // Not required for volume calculations, do it for visualization and later use.
+    InterferenceMeasure( primary_tm, secondary_tm, true, data );
+    InterferenceResolve( primary_tm, secondary_tm, true, data, result_tmv );
 
-        int ifewer = 0;
-        if ( result_tmv[ 0 ]->m_TVec.size() > result_tmv[ 1 ]->m_TVec.size() )
-        {
-            ifewer = 1;
-        }
-        result_tmv[ 0 ]->LoadBndBox();
-        result_tmv[ 1 ]->LoadBndBox();
-
-        maximin = result_tmv[ ifewer ]->MaxMinDistancePt( result_tmv[ !ifewer ], maximin, pts[0], pts[1] );
-
-        min_dist = 0.0;
-        con_dist = 1.0;
-
-        for ( int i = 0; i < result_tmv.size(); i++ )
-        {
-            // vol += result_tmv[i]->ComputeTrimVol();
-            vol += result_tmv[i]->ComputeTheoVol();
-        }
-        con_vol = vol / vref;
-    }
-    else
-    {
-        min_dist = primary_tm->MinDistance( secondary_tm, min_dist, pts[0], pts[1] );
-        con_dist = min_dist;
-
-        if ( !primary_tm->m_TVec.empty() && !secondary_tm->m_TVec.empty() )
-        {
-            TTri *tri = secondary_tm->m_TVec[0];
-            if ( !DeterIntExtTri( tri, primary_tm ) ) // b not inside a
-            {
-                secondary_in_primary = true;
-                interference_flag = true;
-                result_tmv.push_back( secondary_tm );
-                con_vol = 1;
-                con_dist += 1.0;
-                delete primary_tm;
-            }
-            else
-            {
-                delete primary_tm;
-                delete secondary_tm;
-            }
-        }
-        else
-        {
-            delete primary_tm;
-            delete secondary_tm;
-        }
-    }
-
-    double gcon = con_dist * con_vol;
-    double gcon2 = maximin + min_dist * con_vol;
+    delete primary_tm;
+    delete secondary_tm;
 
     Results *res = ResultsMgr.CreateResults( "Packaging_Interference", "Packaging interference check." );
-    if( res )
-    {
-        // Populate results.
-        res->Add( new NameValData( "Interference", interference_flag, "Flag indicating the primary and secondary interfere." ) );
-        res->Add( new NameValData( "Intersection", intersect_flag, "Flag indicating the primary and secondary intersect." ) );
-        res->Add( new NameValData( "Primary_In_Secondary", primary_in_secondary, "Flag indicating the primary is contained within the secondary." ) );
-        res->Add( new NameValData( "Secondary_In_Primary", secondary_in_primary, "Flag indicating the secondary is contained within the primary." ) );
-        res->Add( new NameValData( "Min_Dist", min_dist, "Minimum distance between primary and secondary." ) );
-        res->Add( new NameValData( "MaxMin_Dist", maximin, "Maximum minimum distance between overlapping primary and secondary." ) );
-        res->Add( new NameValData( "Pts", pts, "Minimum distance line end points." ) );
-        res->Add( new NameValData( "InterferenceVol", vol, "Volume of interference." ) );
-        res->Add( new NameValData( "Vol_Primary", vol_primary, "Volume of primary." ) );
-        res->Add( new NameValData( "Vol_Secondary", vol_secondary, "Volume of secondary." ) );
-        res->Add( new NameValData( "Con_Val", gcon, "Constraint value" ) );
-        res->Add( new NameValData( "Con_Val2", gcon2, "Alternate constraint value" ) );
-        res->Add( new NameValData( "Result", gcon, "Interference result" ) );
-    }
+    data.AddResults( res );
 
     return res->GetID();
 }
@@ -2619,28 +2647,10 @@ TMesh* MakeSlice( const int &swdir, const double & len )
     return tm;
 }
 
-double MakeSlices( vector<TMesh*> &tmv, const BndBox & bbox, int numSlices, int swdir, vector < double > &slicevec, bool mpslice, bool tesselate, bool autoBounds, double start, double end, int slctype )
+double MakeSliceLocations( const BndBox & bbox, int numSlices, int swdir, vector < double > &slicevec, bool mpslice, bool autoBounds, double start, double end )
 {
-    int s, i, j;
     double offset = 0.0001; // Amount to extend slicing bounds.
 
-    int dir1, dir2;
-    if ( swdir == vsp::X_DIR )
-    {
-        dir1 = vsp::Y_DIR;
-        dir2 = vsp::Z_DIR;
-    }
-    else if ( swdir == vsp::Y_DIR )
-    {
-        dir1 = vsp::Z_DIR;
-        dir2 = vsp::X_DIR;
-    }
-    else
-    {
-        dir1 = vsp::X_DIR;
-        dir2 = vsp::Y_DIR;
-    }
-
     double swMin;
     double swMax;
     if ( autoBounds )
@@ -2679,6 +2689,44 @@ double MakeSlices( vector<TMesh*> &tmv, const BndBox & bbox, int numSlices, int
     }
     slicevec.resize( numSlices );
 
+    for ( int s = 0 ; s < numSlices ; s++ )
+    {
+        if ( mpslice )
+        {
+            slicevec[s] = swMin + ( double )s * sliceW + 0.5 * sliceW;
+        }
+        else
+        {
+            slicevec[s] = swMin + ( double )s * sliceW;
+        }
+    }
+
+    return sliceW;
+}
+
+double MakeSlices( vector<TMesh*> &tmv, const BndBox & bbox, int numSlices, int swdir, vector < double > &slicevec, bool mpslice, bool tesselate, bool autoBounds, double start, double end, int slctype )
+{
+    int s, i, j;
+
+    int dir1, dir2;
+    if ( swdir == vsp::X_DIR )
+    {
+        dir1 = vsp::Y_DIR;
+        dir2 = vsp::Z_DIR;
+    }
+    else if ( swdir == vsp::Y_DIR )
+    {
+        dir1 = vsp::Z_DIR;
+        dir2 = vsp::X_DIR;
+    }
+    else
+    {
+        dir1 = vsp::X_DIR;
+        dir2 = vsp::Y_DIR;
+    }
+
+    double sliceW = MakeSliceLocations( bbox, numSlices, swdir, slicevec, mpslice, autoBounds, start, end );
+
     double del1 = 1.02 * ( bbox.GetMax( dir1 ) - bbox.GetMin( dir1 ) );
     double s1   = bbox.GetMin( dir1 ) - 0.01 * del1;
     double del2 = 1.02 * ( bbox.GetMax( dir2 ) - bbox.GetMin( dir2 ) );
@@ -2696,16 +2744,7 @@ double MakeSlices( vector<TMesh*> &tmv, const BndBox & bbox, int numSlices, int
 
         tmv.push_back( tm );
 
-        double sw;
-        if ( mpslice )
-        {
-            sw = swMin + ( double )s * sliceW + 0.5 * sliceW;
-        }
-        else
-        {
-            sw = swMin + ( double )s * sliceW;
-        }
-        slicevec[s] = sw;
+        double sw = slicevec[s];
 
         if ( tesselate )
         {
@@ -3893,12 +3932,6 @@ void AreaSlice( vector<TMesh*> &tmv, vector<TMesh*> &slicevec, const BndBox &bbo
     res->Add( new NameValData( "Num_Tris", numTris, "Number of starting tris.") );
     res->Add( new NameValData( "Axis_Vector", norm_axis, "Normal vector for slice generation." ) );
 
-    //==== Create Bnd Box for  Mesh Geoms ====//
-    for ( i = 0 ; i < ( int )tmv.size() ; i++ )
-    {
-        tmv[i]->LoadBndBox();
-    }
-
     int slctype = vsp::CFD_STRUCTURE;
     if ( measureduct )
     {
@@ -3907,52 +3940,34 @@ void AreaSlice( vector<TMesh*> &tmv, vector<TMesh*> &slicevec, const BndBox &bbo
 
     vector< double > loc_vec;
     bool mpslice = false; // Do counting for mass properties slicing.
-    bool tesselate = false; // Sub-tessellate slice into smaller triangles.
-    MakeSlices( slicevec, tbbox, numSlices, vsp::X_DIR, loc_vec, mpslice, tesselate, autoBounds, start, end, slctype );
+    MakeSliceLocations( tbbox, numSlices, vsp::X_DIR, loc_vec, mpslice, autoBounds, start, end );
 
-    // Fill vector of cfdtypes so we don't have to pass TMeshVec all the way down.
-    vector < int > bTypes( tmv.size() );
-    vector < bool > thicksurf( tmv.size() );
-    for ( i = 0 ; i < ( int )tmv.size() ; i++ )
+    //==== Cut Sections Directly From The Meshes ====//
+    vector < vec3d > orgs( loc_vec.size() );
+    vector < vec3d > norms( loc_vec.size(), vec3d( 1, 0, 0 ) );
+    vec3d tcen = tbbox.GetCenter();
+    for ( s = 0 ; s < ( int )loc_vec.size() ; s++ )
     {
-        bTypes[i] = tmv[i]->m_SurfCfdType;
-        thicksurf[i] = tmv[i]->m_ThickSurf;
+        orgs[s] = vec3d( loc_vec[s], tcen.y(), tcen.z() );
     }
 
-    //==== Load Bnding Box ====//
-    for ( s = 0 ; s < ( int )slicevec.size() ; s++ )
-    {
-        TMesh* tm = slicevec[s];
-        tm->LoadBndBox();
-
-        //==== Intersect All Mesh Geoms ====//
-        for ( i = 0 ; i < ( int )tmv.size() ; i++ )
-        {
-            tm->Intersect( tmv[i] );
-
-            tmv[i]->RemoveIsectEdges();
-        }
-
-        //==== Split Intersected Tri in Mesh ====//
-        tm->Split();
-
-        //==== Determine Which Triangle Are Interior/Exterior ====//
-        tm->DeterIntExt( tmv );
-
-        //==== Mark which triangles to ignore ====//
-        tm->SetIgnoreTriFlag( bTypes, thicksurf );
+    TMeshSectionEngine engine( tmv );
+    vector < TMeshSection > secs;
+    engine.Section( orgs, norms, slctype, secs, true );
 
+    for ( s = 0 ; s < ( int )secs.size() ; s++ )
+    {
+        slicevec.push_back( engine.MakeSliceTMesh( secs[s], slctype ) );
     }
 
     TransMat.affineInverse();
 
     vector< double > area_vec;
     vector < vec3d > AreaCenter;
-    for ( s = 0 ; s < ( int )slicevec.size() ; s++ )
+    for ( s = 0 ; s < ( int )secs.size() ; s++ )
     {
-        slicevec[s]->ComputeWetArea();
-        area_vec.push_back( slicevec[s]->m_WetArea );
-        AreaCenter.push_back( TransMat.xform( slicevec[s]->m_AreaCenter ) );
+        area_vec.push_back( secs[s].m_Area );
+        AreaCenter.push_back( TransMat.xform( secs[s].m_AreaCenter ) );
     }
     res->Add( new NameValData( "Slice_Area_Center", AreaCenter, "Slice center of area." ) );
     res->Add( new NameValData( "Num_Slices", ( int )slicevec.size(), "Number of slices." ) );
@@ -4035,7 +4050,7 @@ void MassSlice( vector<TMesh*> &tmv, vector<TMesh*> &slicevec, BndBox &bbox,
 
     vector < double > slice_fill_vec;
 
-    double sliceW = MakeSlices( slicevec, bbox, numSlices, idir, slice_fill_vec );
+    double sliceW = MakeSliceLocations( bbox, numSlices, idir, slice_fill_vec );
 
     // Fill vector of cfdtypes so we don't have to pass TMeshVec all the way down.
     vector < int > bTypes( tmv.size());
@@ -4046,33 +4061,24 @@ void MassSlice( vector<TMesh*> &tmv, vector<TMesh*> &slicevec, BndBox &bbox,
         thicksurf[ i ] = tmv[ i ]->m_ThickSurf;
     }
 
-    //==== Load Bounding Box ====//
-    for ( s = 0; s < ( int ) slicevec.size(); s++ )
+    //==== Cut Slice Stations Directly From The Meshes ====//
+    // The engine is a read-only BVH of the thick meshes shared by all stations.
+    vec3d sliceNorm;
+    sliceNorm[ idir ] = 1;
+    vector < vec3d > orgs( slice_fill_vec.size(), bbox.GetCenter() );
+    vector < vec3d > norms( slice_fill_vec.size(), sliceNorm );
+    for ( s = 0; s < ( int ) slice_fill_vec.size(); s++ )
     {
-        TMesh *tm = slicevec[ s ];
-        tm->LoadBndBox();
-
-        //==== Intersect All Mesh Geoms ====//
-        for ( i = 0; i < ( int ) tmv.size(); i++ )
-        {
-            // Only intersect mass slice with thick surfaces.
-            if ( tmv[ i ]->m_ThickSurf )
-            {
-                tm->Intersect( tmv[ i ] );
-
-                tmv[ i ]->RemoveIsectEdges();
-            }
-        }
-
-        //==== Split Intersected Tri in Mesh ====//
-        tm->Split();
-
-        //==== Determine Which Triangle Are Interior/Exterior ====//
-        tm->DeterIntExt( tmv );
+        orgs[ s ][ idir ] = slice_fill_vec[ s ];
+    }
 
-        //==== Mark which triangles to ignore ====//
-        tm->SetIgnoreTriFlag( bTypes, thicksurf );
+    TMeshSectionEngine engine( tmv );
+    vector < TMeshSection > secs;
+    engine.Section( orgs, norms, vsp::CFD_STRUCTURE, secs, true );
 
+    for ( s = 0; s < ( int ) secs.size(); s++ )
+    {
+        slicevec.push_back( engine.MakeSliceTMesh( secs[ s ], vsp::CFD_STRUCTURE ) );
     }
 
     //==== Intersect All Mesh Geoms ====//
@@ -4142,40 +4148,27 @@ void MassSlice( vector<TMesh*> &tmv, vector<TMesh*> &slicevec, BndBox &bbox,
     }
 
     //==== Build Tetrahedrons ====//
+    // Each station fills its own vector, the sums below run in station order so
+    // results do not depend on thread count.
     double prismLength = sliceW;
-    vector < vector < TetraMassProp * > > tetraVecVec( slicevec.size());
+    vector < vector < TetraMassProp * > > tetraVecVec( secs.size());
 
-    for ( s = 0; s < ( int ) slicevec.size(); s++ )
+    ParallelFor( secs.size(), MASS_SLICE_PARALLEL_CHUNK, [&]( int begin, int end )
     {
-        TMesh *tm = slicevec[ s ];
-        for ( i = 0; i < ( int ) tm->m_TVec.size(); i++ )
+        for ( int is = begin; is < end; is++ )
         {
-            TTri *tri = tm->m_TVec[ i ];
-
-            if ( tri->m_SplitVec.size())
+            const TMeshSection &sec = secs[ is ];
+            for ( int m = 0; m < ( int ) sec.m_MeshTris.size(); m++ )
             {
-                for ( j = 0; j < ( int ) tri->m_SplitVec.size(); j++ )
+                double density = degen ? 1.0 : engine.GetMeshDensity( m );
+                const vector < vec3d > &pnts = sec.m_MeshTris[ m ];
+                for ( int k = 0; k + 2 < ( int ) pnts.size(); k += 3 )
                 {
-                    if ( !tri->m_SplitVec[ j ]->m_IgnoreTriFlag )
-                    {
-                        if ( degen )
-                        {
-                            tri->m_SplitVec[ j ]->m_Density = 1.0;
-                        }
-                        CreatePrism( tetraVecVec[ s ], tri->m_SplitVec[ j ], prismLength, idir );
-                    }
+                    CreatePrism( tetraVecVec[ is ], engine.GetMeshGeomID( m ), density, pnts[ k ], pnts[ k + 1 ], pnts[ k + 2 ], prismLength, idir );
                 }
             }
-            else if ( !tri->m_IgnoreTriFlag )
-            {
-                if ( degen )
-                {
-                    tri->m_Density = 1.0;
-                }
-                CreatePrism( tetraVecVec[ s ], tri, prismLength, idir );
-            }
         }
-    }
+    } );
 
     double totalVol = 0.0;
 
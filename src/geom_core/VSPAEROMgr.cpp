@@ -780,10 +780,12 @@ void VSPAEROMgrSingleton::UpdateFilenames()    //A.K.A. SetupDegenFile()
     m_SetupFile         = string();
     m_AdbFile           = string();
     m_AdbCasesFile      = string();
+    m_AdbIndexFile      = string();
     m_HistoryFile       = string();
     m_PolarFile         = string();
     m_LoadFile          = string();
     m_StabFile          = string();
+    m_TimingFile        = string();
     m_CutsFile          = string();
     m_SliceFile         = string();
     m_GroupsFile        = string();
@@ -815,10 +817,12 @@ void VSPAEROMgrSingleton::UpdateFilenames()    //A.K.A. SetupDegenFile()
         m_SetupFile         = m_ModelNameBase + string( ".vspaero" );
         m_AdbFile           = m_ModelNameBase + string( ".adb" );
         m_AdbCasesFile      = m_ModelNameBase + string( ".adb.cases" );
+        m_AdbIndexFile      = m_ModelNameBase + string( ".adb.index" );
         m_QuadCasesFile     = m_ModelNameBase + string( ".quad.cases" );
         m_HistoryFile       = m_ModelNameBase + string( ".history" );
         m_PolarFile         = m_ModelNameBase + string( ".polar" );
         m_LoadFile          = m_ModelNameBase + string( ".lod" );
+        m_TimingFile        = m_ModelNameBase + string( ".timing" );
 
         if ( m_StabilityType() == vsp::STABILITY_P_ANALYSIS )
         {
@@ -1752,6 +1756,12 @@ string VSPAEROMgrSingleton::LoadExistingVSPAEROResults()
         no_errors = false;
     }
 
+    // Timing report is optional, older solutions do not have one
+    if ( FileExist( m_TimingFile ) )
+    {
+        ReadTimingFile( m_TimingFile, res_id_vec );
+    }
+
     if ( m_PreviousStabilityType > vsp::VSPAERO_STABILITY_TYPE::STABILITY_OFF )
     {
         string stab_file;
@@ -1856,6 +1866,10 @@ void VSPAEROMgrSingleton::ClearAllPreviousResults()
     {
         ResultsMgr.DeleteResult( ResultsMgr.FindResultsID( "VSPAERO_Stab",  0 ) );
     }
+    while ( ResultsMgr.GetNumResults( "VSPAERO_Timing" ) > 0 )
+    {
+        ResultsMgr.DeleteResult( ResultsMgr.FindResultsID( "VSPAERO_Timing",  0 ) );
+    }
     while ( ResultsMgr.GetNumResults( "VSPAERO_Group" ) > 0 )
     {
         ResultsMgr.DeleteResult( ResultsMgr.FindResultsID( "VSPAERO_Group", 0 ) );
@@ -1961,11 +1975,13 @@ string VSPAEROMgrSingleton::ComputeSolver( FILE * logFile )
 
         string adbFileName = m_AdbFile;
         string adbCasesFileName = m_AdbCasesFile;
+        string adbIndexFileName = m_AdbIndexFile;
         string quadCasesFileName = m_QuadCasesFile;
         string historyFileName = m_HistoryFile;
         string polarFileName = m_PolarFile;
         string loadFileName = m_LoadFile;
         string stabFileName = m_StabFile;
+        string timingFileName = m_TimingFile;
         string modelNameBase = m_ModelNameBase;
 
         vector < string > group_res_vec = m_GroupResFiles;
@@ -2022,6 +2038,10 @@ string VSPAEROMgrSingleton::ComputeSolver( FILE * logFile )
         {
             remove( adbCasesFileName.c_str() );
         }
+        if ( FileExist( adbIndexFileName ) )
+        {
+            remove( adbIndexFileName.c_str() );
+        }
         if ( FileExist( quadCasesFileName ) )
         {
             remove( quadCasesFileName.c_str() );
@@ -2042,6 +2062,10 @@ string VSPAEROMgrSingleton::ComputeSolver( FILE * logFile )
         {
             remove( stabFileName.c_str() );
         }
+        if ( FileExist( timingFileName ) )
+        {
+            remove( timingFileName.c_str() );
+        }
 
         string groupresfile_wildcard = m_ModelNameBase + ".group.*";
         std::vector < std::filesystem::path > groupresfiles;
@@ -2190,6 +2214,11 @@ string VSPAEROMgrSingleton::ComputeSolver( FILE * logFile )
             ReadStabFile( stabFileName, res_id_vector, stabilityType );      //*.STAB stability coeff file
         }
 
+        if ( FileExist( timingFileName ) )
+        {
+            ReadTimingFile( timingFileName, res_id_vector );      //*.timing solver phase timing report
+        }
+
         // CpSlice *.adb File and slices are defined
         if ( m_CpSliceFlag() && !m_CpSliceVec.empty() )
         {
@@ -3160,102 +3189,102 @@ void VSPAEROMgrSingleton::ReadLoadFile( const string &filename, vector <string>
             // Finish up by adding the data to the result res
             if ( unsteady_flag )
             {
-                res->Add( new NameValData( "Time", Time, "Unsteady simulation time." ) );
+                res->Add( new NameValData( "Time", std::move( Time ), "Unsteady simulation time." ) );
             }
             else
             {
-                res->Add( new NameValData( "Iter", Iter, "Wake iteration." ) );
+                res->Add( new NameValData( "Iter", std::move( Iter ), "Wake iteration." ) );
             }
-            res->Add( new NameValData( "VortexSheet", VortexSheet, "Span load distribution set." ) );
-            res->Add( new NameValData( "TrailVort", TrailVort, "Surface for span load set." ) );
-            res->Add( new NameValData( "Xavg", Xavg, "Section X coordinate." ) );
-            res->Add( new NameValData( "Yavg", Yavg, "Section Y coordinate." ) );
-            res->Add( new NameValData( "Zavg", Zavg, "Section Z coordinate." ) );
-            res->Add( new NameValData( "dSpan", dSpan, "Section span increment." ) );
-            res->Add( new NameValData( "SoverB", SoverB, "Fraction of wing span." ) );
-            res->Add( new NameValData( "Chord", Chord, "Section chord." ) );
-            res->Add( new NameValData( "dArea", dArea, "Section area increment." ) );
-            res->Add( new NameValData( "V/Vref", VoVref, "Local velocity ratio." ) );
-            res->Add( new NameValData( "cl", Cl, "Section lift coefficient." ) );
-            res->Add( new NameValData( "cd", Cd, "Section drag coefficient." ) );
-            res->Add( new NameValData( "cs", Cs, "Section side force coefficient." ) );
-            res->Add( new NameValData( "clo", Clo, "Section lift coefficient.  Parasite part." ) );
-            res->Add( new NameValData( "cdo", Cdo, "Section drag coefficient.  Parasite part." ) );
-            res->Add( new NameValData( "cso", Cso, "Section side force coefficient.  Parasite part." ) );
-            res->Add( new NameValData( "cli", Cli, "Section lift coefficient.  Induced part." ) );
-            res->Add( new NameValData( "cdi", Cdi, "Section drag coefficient.  Induced part." ) );
-            res->Add( new NameValData( "csi", Csi, "Section side force coefficient.  Induced part." ) );
-            res->Add( new NameValData( "cx", Cx, "Section X force coefficient." ) );
-            res->Add( new NameValData( "cy", Cy, "Section Y force coefficient." ) );
-            res->Add( new NameValData( "cz", Cz, "Section Z force coefficient." ) );
-            res->Add( new NameValData( "cxo", Cxo, "Section X force coefficient.  Parasite part." ) );
-            res->Add( new NameValData( "cyo", Cyo, "Section Y force coefficient.  Parasite part." ) );
-            res->Add( new NameValData( "czo", Czo, "Section Z force coefficient.  Parasite part." ) );
-            res->Add( new NameValData( "cxi", Cxi, "Section X force coefficient.  Induced part." ) );
-            res->Add( new NameValData( "cyi", Cyi, "Section Y force coefficient.  Induced part." ) );
-            res->Add( new NameValData( "czi", Czi, "Section Z force coefficient.  Induced part." ) );
-            res->Add( new NameValData( "cmx", Cmx, "Section X moment coefficient." ) );
-            res->Add( new NameValData( "cmy", Cmy, "Section Y moment coefficient." ) );
-            res->Add( new NameValData( "cmz", Cmz, "Section Z moment coefficient." ) );
-            res->Add( new NameValData( "cmxo", Cmxo, "Section X moment coefficient.  Parasite part." ) );
-            res->Add( new NameValData( "cmyo", Cmyo, "Section Y moment coefficient.  Parasite part." ) );
-            res->Add( new NameValData( "cmzo", Cmzo, "Section Z moment coefficient.  Parasite part." ) );
-            res->Add( new NameValData( "cmxi", Cmxi, "Section X moment coefficient.  Induced part." ) );
-            res->Add( new NameValData( "cmyi", Cmyi, "Section Y moment coefficient.  Induced part." ) );
-            res->Add( new NameValData( "cmzi", Cmzi, "Section Z moment coefficient.  Induced part." ) );
-            res->Add( new NameValData( "StallFact", StallFact, "Stall factor." ) );
-
-            res->Add( new NameValData( "IsARotor", IsARotor, "Flag indicating whether this vortex sheet is a rotor / prop." ) );
-            res->Add( new NameValData( "Diameter", Diameter, "Diameter of the rotor." ) );
-            res->Add( new NameValData( "roverR", roverR, "Fraction of rotor radius." ) );
-            res->Add( new NameValData( "RPM", RPM, "RPM of this rotor." ) );
-            res->Add( new NameValData( "Thrust", Thrust, "Thrust distribution." ) );
-            res->Add( new NameValData( "Thrusto", Thrusto, "Thrust distribution.  Parasite part." ) );
-            res->Add( new NameValData( "Thrusti", Thrusti, "Thrust distribution.  Induced part." ) );
-            res->Add( new NameValData( "Power", Power, "Power distribution." ) );
-            res->Add( new NameValData( "Powero", Powero, "Power distribution.  Parasite part." ) );
-            res->Add( new NameValData( "Poweri", Poweri, "Power distribution.  Induced part." ) );
-            res->Add( new NameValData( "Moment", Moment, "Moment distribution." ) );
-            res->Add( new NameValData( "Momento", Momento, "Moment distribution.  Parasite part." ) );
-            res->Add( new NameValData( "Momenti", Momenti, "Moment distribution.  Induced part." ) );
-            res->Add( new NameValData( "J", J, "Advance ratio." ) );
-            res->Add( new NameValData( "CT", CT, "(Propeller) Thrust coefficient distribution." ) );
-            res->Add( new NameValData( "CQ", CQ, "(Propeller) Torque coefficient distribution." ) );
-            res->Add( new NameValData( "CP", CP, "(Propeller) Power coefficient distribution." ) );
-            res->Add( new NameValData( "ETAP", ETAP, "Propeller efficiency distribution." ) );
-            res->Add( new NameValData( "CT_h", CT_h, "(Helicopter) Thrust coefficient distribution." ) );
-            res->Add( new NameValData( "CQ_h", CQ_h, "(Helicopter) Torque coefficient distribution." ) );
-            res->Add( new NameValData( "CP_h", CP_h, "(Helicopter) Power coefficient distribution." ) );
-            res->Add( new NameValData( "FOM", FOM, "Figure of merit distribution." ) );
-            res->Add( new NameValData( "Angle ", Angle , "Propeller rotation angle." ) );
-
-            res->Add( new NameValData( "cl*c/cref", Clc_cref, "Section lift scaled load." ) );
-            res->Add( new NameValData( "cd*c/cref", Cdc_cref, "Section drag scaled load." ) );
-            res->Add( new NameValData( "cs*c/cref", Csc_cref, "Section side scaled load." ) );
-            res->Add( new NameValData( "clo*c/cref", Cloc_cref, "Section lift scaled load.  Parasite part." ) );
-            res->Add( new NameValData( "cdo*c/cref", Cdoc_cref, "Section drag scaled load.  Parasite part." ) );
-            res->Add( new NameValData( "cso*c/cref", Csoc_cref, "Section side scaled load.  Parasite part." ) );
-            res->Add( new NameValData( "cli*c/cref", Clic_cref, "Section lift scaled load.  Induced part." ) );
-            res->Add( new NameValData( "cdi*c/cref", Cdic_cref, "Section drag scaled load.  Induced part." ) );
-            res->Add( new NameValData( "csi*c/cref", Csic_cref, "Section side scaled load.  Induced part." ) );
-            res->Add( new NameValData( "cx*c/cref", Cxc_cref, "Section X scaled load." ) );
-            res->Add( new NameValData( "cy*c/cref", Cyc_cref, "Section Y scaled load." ) );
-            res->Add( new NameValData( "cz*c/cref", Czc_cref, "Section Z scaled load." ) );
-            res->Add( new NameValData( "cxo*c/cref", Cxoc_cref, "Section X scaled load.  Parasite part." ) );
-            res->Add( new NameValData( "cyo*c/cref", Cyoc_cref, "Section Y scaled load.  Parasite part." ) );
-            res->Add( new NameValData( "czo*c/cref", Czoc_cref, "Section Z scaled load.  Parasite part." ) );
-            res->Add( new NameValData( "cxi*c/cref", Cxic_cref, "Section X scaled load.  Induced part." ) );
-            res->Add( new NameValData( "cyi*c/cref", Cyic_cref, "Section Y scaled load.  Induced part." ) );
-            res->Add( new NameValData( "czi*c/cref", Czic_cref, "Section Z scaled load.  Induced part." ) );
-            res->Add( new NameValData( "cmx*c/cref", Cmxc_cref, "Section X scaled moment." ) );
-            res->Add( new NameValData( "cmy*c/cref", Cmyc_cref, "Section Y scaled moment." ) );
-            res->Add( new NameValData( "cmz*c/cref", Cmzc_cref, "Section Z scaled moment." ) );
-            res->Add( new NameValData( "cmxo*c/cref", Cmxoc_cref, "Section X scaled moment.  Parasite part." ) );
-            res->Add( new NameValData( "cmyo*c/cref", Cmyoc_cref, "Section Y scaled moment.  Parasite part." ) );
-            res->Add( new NameValData( "cmzo*c/cref", Cmzoc_cref, "Section Z scaled moment.  Parasite part." ) );
-            res->Add( new NameValData( "cmxi*c/cref", Cmxic_cref, "Section X scaled moment.  Induced part." ) );
-            res->Add( new NameValData( "cmyi*c/cref", Cmyic_cref, "Section Y scaled moment.  Induced part." ) );
-            res->Add( new NameValData( "cmzi*c/cref", Cmzic_cref, "Section Z scaled moment.  Induced part." ) );
+            res->Add( new NameValData( "VortexSheet", std::move( VortexSheet ), "Span load distribution set." ) );
+            res->Add( new NameValData( "TrailVort", std::move( TrailVort ), "Surface for span load set." ) );
+            res->Add( new NameValData( "Xavg", std::move( Xavg ), "Section X coordinate." ) );
+            res->Add( new NameValData( "Yavg", std::move( Yavg ), "Section Y coordinate." ) );
+            res->Add( new NameValData( "Zavg", std::move( Zavg ), "Section Z coordinate." ) );
+            res->Add( new NameValData( "dSpan", std::move( dSpan ), "Section span increment." ) );
+            res->Add( new NameValData( "SoverB", std::move( SoverB ), "Fraction of wing span." ) );
+            res->Add( new NameValData( "Chord", std::move( Chord ), "Section chord." ) );
+            res->Add( new NameValData( "dArea", std::move( dArea ), "Section area increment." ) );
+            res->Add( new NameValData( "V/Vref", std::move( VoVref ), "Local velocity ratio." ) );
+            res->Add( new NameValData( "cl", std::move( Cl ), "Section lift coefficient." ) );
+            res->Add( new NameValData( "cd", std::move( Cd ), "Section drag coefficient." ) );
+            res->Add( new NameValData( "cs", std::move( Cs ), "Section side force coefficient." ) );
+            res->Add( new NameValData( "clo", std::move( Clo ), "Section lift coefficient.  Parasite part." ) );
+            res->Add( new NameValData( "cdo", std::move( Cdo ), "Section drag coefficient.  Parasite part." ) );
+            res->Add( new NameValData( "cso", std::move( Cso ), "Section side force coefficient.  Parasite part." ) );
+            res->Add( new NameValData( "cli", std::move( Cli ), "Section lift coefficient.  Induced part." ) );
+            res->Add( new NameValData( "cdi", std::move( Cdi ), "Section drag coefficient.  Induced part." ) );
+            res->Add( new NameValData( "csi", std::move( Csi ), "Section side force coefficient.  Induced part." ) );
+            res->Add( new NameValData( "cx", std::move( Cx ), "Section X force coefficient." ) );
+            res->Add( new NameValData( "cy", std::move( Cy ), "Section Y force coefficient." ) );
+            res->Add( new NameValData( "cz", std::move( Cz ), "Section Z force coefficient." ) );
+            res->Add( new NameValData( "cxo", std::move( Cxo ), "Section X force coefficient.  Parasite part." ) );
+            res->Add( new NameValData( "cyo", std::move( Cyo ), "Section Y force coefficient.  Parasite part." ) );
+            res->Add( new NameValData( "czo", std::move( Czo ), "Section Z force coefficient.  Parasite part." ) );
+            res->Add( new NameValData( "cxi", std::move( Cxi ), "Section X force coefficient.  Induced part." ) );
+            res->Add( new NameValData( "cyi", std::move( Cyi ), "Section Y force coefficient.  Induced part." ) );
+            res->Add( new NameValData( "czi", std::move( Czi ), "Section Z force coefficient.  Induced part." ) );
+            res->Add( new NameValData( "cmx", std::move( Cmx ), "Section X moment coefficient." ) );
+            res->Add( new NameValData( "cmy", std::move( Cmy ), "Section Y moment coefficient." ) );
+            res->Add( new NameValData( "cmz", std::move( Cmz ), "Section Z moment coefficient." ) );
+            res->Add( new NameValData( "cmxo", std::move( Cmxo ), "Section X moment coefficient.  Parasite part." ) );
+            res->Add( new NameValData( "cmyo", std::move( Cmyo ), "Section Y moment coefficient.  Parasite part." ) );
+            res->Add( new NameValData( "cmzo", std::move( Cmzo ), "Section Z moment coefficient.  Parasite part." ) );
+            res->Add( new NameValData( "cmxi", std::move( Cmxi ), "Section X moment coefficient.  Induced part." ) );
+            res->Add( new NameValData( "cmyi", std::move( Cmyi ), "Section Y moment coefficient.  Induced part." ) );
+            res->Add( new NameValData( "cmzi", std::move( Cmzi ), "Section Z moment coefficient.  Induced part." ) );
+            res->Add( new NameValData( "StallFact", std::move( StallFact ), "Stall factor." ) );
+
+            res->Add( new NameValData( "IsARotor", std::move( IsARotor ), "Flag indicating whether this vortex sheet is a rotor / prop." ) );
+            res->Add( new NameValData( "Diameter", std::move( Diameter ), "Diameter of the rotor." ) );
+            res->Add( new NameValData( "roverR", std::move( roverR ), "Fraction of rotor radius." ) );
+            res->Add( new NameValData( "RPM", std::move( RPM ), "RPM of this rotor." ) );
+            res->Add( new NameValData( "Thrust", std::move( Thrust ), "Thrust distribution." ) );
+            res->Add( new NameValData( "Thrusto", std::move( Thrusto ), "Thrust distribution.  Parasite part." ) );
+            res->Add( new NameValData( "Thrusti", std::move( Thrusti ), "Thrust distribution.  Induced part." ) );
+            res->Add( new NameValData( "Power", std::move( Power ), "Power distribution." ) );
+            res->Add( new NameValData( "Powero", std::move( Powero ), "Power distribution.  Parasite part." ) );
+            res->Add( new NameValData( "Poweri", std::move( Poweri ), "Power distribution.  Induced part." ) );
+            res->Add( new NameValData( "Moment", std::move( Moment ), "Moment distribution." ) );
+            res->Add( new NameValData( "Momento", std::move( Momento ), "Moment distribution.  Parasite part." ) );
+            res->Add( new NameValData( "Momenti", std::move( Momenti ), "Moment distribution.  Induced part." ) );
+            res->Add( new NameValData( "J", std::move( J ), "Advance ratio." ) );
+            res->Add( new NameValData( "CT", std::move( CT ), "(Propeller) Thrust coefficient distribution." ) );
+            res->Add( new NameValData( "CQ", std::move( CQ ), "(Propeller) Torque coefficient distribution." ) );
+            res->Add( new NameValData( "CP", std::move( CP ), "(Propeller) Power coefficient distribution." ) );
+            res->Add( new NameValData( "ETAP", std::move( ETAP ), "Propeller efficiency distribution." ) );
+            res->Add( new NameValData( "CT_h", std::move( CT_h ), "(Helicopter) Thrust coefficient distribution." ) );
+            res->Add( new NameValData( "CQ_h", std::move( CQ_h ), "(Helicopter) Torque coefficient distribution." ) );
+            res->Add( new NameValData( "CP_h", std::move( CP_h ), "(Helicopter) Power coefficient distribution." ) );
+            res->Add( new NameValData( "FOM", std::move( FOM ), "Figure of merit distribution." ) );
+            res->Add( new NameValData( "Angle ", std::move( Angle ), "Propeller rotation angle." ) );
+
+            res->Add( new NameValData( "cl*c/cref", std::move( Clc_cref ), "Section lift scaled load." ) );
+            res->Add( new NameValData( "cd*c/cref", std::move( Cdc_cref ), "Section drag scaled load." ) );
+            res->Add( new NameValData( "cs*c/cref", std::move( Csc_cref ), "Section side scaled load." ) );
+            res->Add( new NameValData( "clo*c/cref", std::move( Cloc_cref ), "Section lift scaled load.  Parasite part." ) );
+            res->Add( new NameValData( "cdo*c/cref", std::move( Cdoc_cref ), "Section drag scaled load.  Parasite part." ) );
+            res->Add( new NameValData( "cso*c/cref", std::move( Csoc_cref ), "Section side scaled load.  Parasite part." ) );
+            res->Add( new NameValData( "cli*c/cref", std::move( Clic_cref ), "Section lift scaled load.  Induced part." ) );
+            res->Add( new NameValData( "cdi*c/cref", std::move( Cdic_cref ), "Section drag scaled load.  Induced part." ) );
+            res->Add( new NameValData( "csi*c/cref", std::move( Csic_cref ), "Section side scaled load.  Induced part." ) );
+            res->Add( new NameValData( "cx*c/cref", std::move( Cxc_cref ), "Section X scaled load." ) );
+            res->Add( new NameValData( "cy*c/cref", std::move( Cyc_cref ), "Section Y scaled load." ) );
+            res->Add( new NameValData( "cz*c/cref", std::move( Czc_cref ), "Section Z scaled load." ) );
+            res->Add( new NameValData( "cxo*c/cref", std::move( Cxoc_cref ), "Section X scaled load.  Parasite part." ) );
+            res->Add( new NameValData( "cyo*c/cref", std::move( Cyoc_cref ), "Section Y scaled load.  Parasite part." ) );
+            res->Add( new NameValData( "czo*c/cref", std::move( Czoc_cref ), "Section Z scaled load.  Parasite part." ) );
+            res->Add( new NameValData( "cxi*c/cref", std::move( Cxic_cref ), "Section X scaled load.  Induced part." ) );
+            res->Add( new NameValData( "cyi*c/cref", std::move( Cyic_cref ), "Section Y scaled load.  Induced part." ) );
+            res->Add( new NameValData( "czi*c/cref", std::move( Czic_cref ), "Section Z scaled load.  Induced part." ) );
+            res->Add( new NameValData( "cmx*c/cref", std::move( Cmxc_cref ), "Section X scaled moment." ) );
+            res->Add( new NameValData( "cmy*c/cref", std::move( Cmyc_cref ), "Section Y scaled moment." ) );
+            res->Add( new NameValData( "cmz*c/cref", std::move( Cmzc_cref ), "Section Z scaled moment." ) );
+            res->Add( new NameValData( "cmxo*c/cref", std::move( Cmxoc_cref ), "Section X scaled moment.  Parasite part." ) );
+            res->Add( new NameValData( "cmyo*c/cref", std::move( Cmyoc_cref ), "Section Y scaled moment.  Parasite part." ) );
+            res->Add( new NameValData( "cmzo*c/cref", std::move( Cmzoc_cref ), "Section Z scaled moment.  Parasite part." ) );
+            res->Add( new NameValData( "cmxi*c/cref", std::move( Cmxic_cref ), "Section X scaled moment.  Induced part." ) );
+            res->Add( new NameValData( "cmyi*c/cref", std::move( Cmyic_cref ), "Section Y scaled moment.  Induced part." ) );
+            res->Add( new NameValData( "cmzi*c/cref", std::move( Cmzic_cref ), "Section Z scaled moment.  Induced part." ) );
 
         } // end sectional and remnant table read
 
@@ -3466,6 +3495,142 @@ void VSPAEROMgrSingleton::ReadStabFile( const string &filename, vector <string>
     std::fclose ( fp );
 }
 
+/*******************************************************
+Read *.timing file output from VSPAERO.  Phase times are
+inclusive, ForwardSolve contains the MatrixMultiply,
+Precondition, and WakeUpdate phases.
+*******************************************************/
+void VSPAEROMgrSingleton::ReadTimingFile( const string &filename, vector <string> &res_id_vector )
+{
+    FILE *fp = nullptr;
+    WaitForFile( filename );
+    fp = fopen( filename.c_str(), "r" );
+    if ( fp == nullptr )
+    {
+        fprintf( stderr, "ERROR %d: Could not open Timing file: %s\n\tFile: %s \tLine:%d\n", vsp::VSP_FILE_DOES_NOT_EXIST, filename.c_str(), __FILE__, __LINE__ );
+        return;
+    }
+
+    int num_threads = 0;
+    int hw_counters = 0;
+    double total_wall_time = 0;
+    double total_cpu_time = 0;
+
+    vector < string > Phase;
+    vector < int > Calls;
+    vector < double > WallTime, CPUTime, MinWork, MaxWork, Imbalance;
+
+    vector < string > CounterPhase;
+    vector < double > Cycles, Instructions, CacheMisses, BranchMisses, IPC;
+
+    int num_phase_col = 8;
+    int num_counter_col = 6;
+
+    std::vector<string> data_string_array;
+
+    char seps[] = " :,\t\n";
+    while ( !feof( fp ) )
+    {
+        data_string_array = ReadDelimLine( fp, seps );
+        if ( data_string_array.empty() )
+        {
+            continue;
+        }
+
+        if ( data_string_array.size() == 2 )
+        {
+            if ( strcmp( data_string_array[0].c_str(), "NumberOfThreads" ) == 0 )
+            {
+                num_threads = std::stoi( data_string_array[1] );
+            }
+            else if ( strcmp( data_string_array[0].c_str(), "TotalWallTime" ) == 0 )
+            {
+                total_wall_time = std::stod( data_string_array[1] );
+            }
+            else if ( strcmp( data_string_array[0].c_str(), "TotalCPUTime" ) == 0 )
+            {
+                total_cpu_time = std::stod( data_string_array[1] );
+            }
+            else if ( strcmp( data_string_array[0].c_str(), "HardwareCounters" ) == 0 )
+            {
+                hw_counters = std::stoi( data_string_array[1] );
+            }
+        }
+        else if ( strcmp( data_string_array[0].c_str(), "Phase" ) == 0 )
+        {
+            data_string_array = ReadDelimLine( fp, seps );
+
+            while ( ( int )data_string_array.size() == num_phase_col )
+            {
+                int icol = 0;
+                Phase.push_back( data_string_array[icol] ); icol++;
+                Calls.push_back( std::stoi( data_string_array[icol] ) ); icol++;
+                WallTime.push_back( std::stod( data_string_array[icol] ) ); icol++;
+                CPUTime.push_back( std::stod( data_string_array[icol] ) ); icol++;
+                icol++; // Skip CPU/Wall, it is CPUTime / WallTime
+                MinWork.push_back( std::stod( data_string_array[icol] ) ); icol++;
+                MaxWork.push_back( std::stod( data_string_array[icol] ) ); icol++;
+                Imbalance.push_back( std::stod( data_string_array[icol] ) ); icol++;
+
+                data_string_array = ReadDelimLine( fp, seps );
+            }
+        }
+        else if ( strcmp( data_string_array[0].c_str(), "Counters" ) == 0 )
+        {
+            data_string_array = ReadDelimLine( fp, seps );
+
+            while ( ( int )data_string_array.size() == num_counter_col )
+            {
+                int icol = 0;
+                CounterPhase.push_back( data_string_array[icol] ); icol++;
+                Cycles.push_back( std::stod( data_string_array[icol] ) ); icol++;
+                Instructions.push_back( std::stod( data_string_array[icol] ) ); icol++;
+                CacheMisses.push_back( std::stod( data_string_array[icol] ) ); icol++;
+                BranchMisses.push_back( std::stod( data_string_array[icol] ) ); icol++;
+                IPC.push_back( std::stod( data_string_array[icol] ) ); icol++;
+
+                data_string_array = ReadDelimLine( fp, seps );
+            }
+        }
+    }
+
+    fclose( fp );
+
+    if ( Phase.empty() )
+    {
+        fprintf( stderr, "WARNING: Timing file %s contained no phase data\n", filename.c_str() );
+        return;
+    }
+
+    Results* res = ResultsMgr.CreateResults( "VSPAERO_Timing", "VSPAERO solver phase timing results." );
+    if ( !res )
+    {
+        return;
+    }
+
+    res->Add( new NameValData( "NumberOfThreads", num_threads, "Number of OpenMP threads used by the solver." ) );
+    res->Add( new NameValData( "TotalWallTime", total_wall_time, "Total solver wall time (s)." ) );
+    res->Add( new NameValData( "TotalCPUTime", total_cpu_time, "Total solver CPU time summed over threads (s)." ) );
+    res->Add( new NameValData( "Phase", Phase, "Solver phase name." ) );
+    res->Add( new NameValData( "Calls", Calls, "Number of times the phase was entered." ) );
+    res->Add( new NameValData( "WallTime", WallTime, "Phase wall time (s)." ) );
+    res->Add( new NameValData( "CPUTime", CPUTime, "Phase CPU time summed over threads (s)." ) );
+    res->Add( new NameValData( "MinWork", MinWork, "Fewest vortex interactions evaluated by any one thread in the phase." ) );
+    res->Add( new NameValData( "MaxWork", MaxWork, "Most vortex interactions evaluated by any one thread in the phase." ) );
+    res->Add( new NameValData( "Imbalance", Imbalance, "Thread load imbalance, max over average work, 1 is perfect, 0 if not threaded." ) );
+
+    if ( hw_counters && !CounterPhase.empty() )
+    {
+        res->Add( new NameValData( "Cycles", Cycles, "Phase CPU cycles summed over threads." ) );
+        res->Add( new NameValData( "Instructions", Instructions, "Phase instructions retired summed over threads." ) );
+        res->Add( new NameValData( "CacheMisses", CacheMisses, "Phase cache misses summed over threads." ) );
+        res->Add( new NameValData( "BranchMisses", BranchMisses, "Phase branch mispredictions summed over threads." ) );
+        res->Add( new NameValData( "IPC", IPC, "Phase instructions per cycle." ) );
+    }
+
+    res_id_vector.push_back( res->GetID() );
+}
+
 vector <string> VSPAEROMgrSingleton::ReadDelimLine( FILE * fp, char * delimiters )
 {
 
@@ -4051,6 +4216,10 @@ string VSPAEROMgrSingleton::ExecuteCpSlicer( FILE * logFile )
     //====== Send command to be executed by the system at the command prompt ======//
     vector<string> args;
 
+    // Set number of openmp threads
+    args.emplace_back( "-omp" );
+    args.push_back( StringUtil::int_to_string( m_NCPU.Get(), "%d" ) );
+
     // Add model file name
     args.emplace_back( "-slice" );
     args.push_back( m_ModelNameBase );
@@ -4395,11 +4564,11 @@ void VSPAEROMgrSingleton::ReadSliceFile( const string &filename, vector <string>
                 skip = true;
 
                 //Add to the results manager
-                res->Add( new NameValData( "X_Loc", x_data_vec, "Slice data X vector." ) );
-                res->Add( new NameValData( "Y_Loc", y_data_vec, "Slice data Y vector." ) );
-                res->Add( new NameValData( "Z_Loc", z_data_vec, "Slice data Z vector." ) );
+                res->Add( new NameValData( "X_Loc", std::move( x_data_vec ), "Slice data X vector." ) );
+                res->Add( new NameValData( "Y_Loc", std::move( y_data_vec ), "Slice data Y vector." ) );
+                res->Add( new NameValData( "Z_Loc", std::move( z_data_vec ), "Slice data Z vector." ) );
 
-                res->Add( new NameValData( "Cp", Cp_data_vec, "Slice Cp or delta Cp." ) );
+                res->Add( new NameValData( "Cp", std::move( Cp_data_vec ), "Slice Cp or delta Cp." ) );
             } // end of cut data
         }
     }
@@ -367,10 +367,12 @@ public:
     string m_SetupFile;
     string m_AdbFile;
     string m_AdbCasesFile;
+    string m_AdbIndexFile;
     string m_HistoryFile;
     string m_PolarFile;
     string m_LoadFile;
     string m_StabFile;
+    string m_TimingFile;
     string m_CutsFile;
     string m_SliceFile;
     string m_QuadCasesFile;
@@ -566,6 +568,7 @@ protected:
     void ReadPolarFile( const string &filename, vector <string> &res_id_vector ) const;
     void ReadLoadFile( const string &filename, vector <string> &res_id_vector ) const;
     void ReadStabFile( const string &filename, vector <string> &res_id_vector, vsp::VSPAERO_STABILITY_TYPE stabilityType );
+    static void ReadTimingFile( const string &filename, vector <string> &res_id_vector );
     static vector <string> ReadDelimLine( FILE * fp, char * delimiters );
     static bool CheckForCaseHeader( const std::vector<string> &headerStr );
     static bool CheckForResultHeader( const std::vector < string > &headerstr );
@@ -20,6 +20,7 @@
 #include "AdvLinkMgr.h"
 #include "AeroStructMgr.h"
 #include "AnalysisMgr.h"
+#include "APIErrorMgr.h"
 #include "AttributeManager.h"
 #include "AuxiliaryGeom.h"
 #include "Background3DMgr.h"
@@ -61,6 +62,11 @@
 #include "VSPAEROMgr.h"
 #include "WingGeom.h"
 #include "WireGeom.h"
+#include "ParallelUtil.h"
+
+#include <libxml/xmlreader.h>
+
+#define DEGEN_GEOM_PARALLEL_CHUNK 1
 
 using namespace vsp;
 
@@ -70,6 +76,7 @@ Vehicle::Vehicle()
     m_Name = "Vehicle_Constructor";
 
     m_ExperimentalFlag = false;
+    m_StreamReadEnabled = true;
 
     SetParmContainerType( vsp::ATTROBJ_VEH );
     AttachAttrCollection();
@@ -220,6 +227,8 @@ Vehicle::Vehicle()
     m_XRotationValue.Init( "RotationX", "AdjustView", this, 0.0, -1.0e12, 1.0e12 );
     m_YRotationValue.Init( "RotationY", "AdjustView", this, 0.0, -1.0e12, 1.0e12 );
     m_ZRotationValue.Init( "RotationZ", "AdjustView", this, 0.0, -1.0e12, 1.0e12 );
+    m_CPUPickingFlag.Init( "CPUPicking", "AdjustView", this, false, 0, 1 );
+    m_CPUPickingFlag.SetDescript( "Resolve picking and box selection by CPU ray queries instead of a color pass" );
 
     m_NewRatioValue.Init( "Ratio", "Screenshot", this, 1.0, 0.0, 1.0e12 );
     m_NewWidthValue.Init( "Width", "Screenshot", this, 1.0, 0.0, 1.0e12 );
@@ -282,10 +291,14 @@ Vehicle::Vehicle()
     m_UseModeExportFlag.Init( "UseModeExportFlag", "ExportFlag", this, false, 0, 1 );
     m_UseModeDegenGeomFlag.Init( "UseModeDegenGeomFlag", "DegenGeom", this, false, 0, 1 );
 
+    m_VSP3ArrayEncoding.Init( "ArrayEncoding", "VSP3Settings", this, vsp::VSP3_ARRAY_TEXT, vsp::VSP3_ARRAY_TEXT, vsp::VSP3_ARRAY_SIDECAR );
+    m_VSP3ArrayEncoding.SetDescript( "Storage of large numeric arrays (meshes, point clouds) in *.vsp3 files" );
+
     m_exportCompGeomTxtFile.Init( "CompGeom_TXT_Export", "ExportFlag", this, true, 0, 1 );
     m_exportCompGeomCsvFile.Init( "CompGeom_CSV_Export", "ExportFlag", this, true, 0, 1 );
     m_exportDegenGeomCsvFile.Init( "DegenGeom_CSV_Export", "ExportFlag", this, true, 0, 1 );
     m_exportDegenGeomMFile.Init( "DegenGeom_M_Export", "ExportFlag", this, true, 0, 1 );
+    m_exportDegenGeomBinFile.Init( "DegenGeom_BIN_Export", "ExportFlag", this, false, 0, 1 );
 
     m_DegenGeomMeshType.Init( "DegenGeomMeshType", "DegenGeom", this, vsp::TRI_MESH_TYPE, vsp::TRI_MESH_TYPE, vsp::NUM_MESH_TYPE - 1 );
 
@@ -532,6 +545,8 @@ void Vehicle::Init()
     m_STLMultiSolid.Set( false );
     m_STLExportPropMainSurf.Set( false );
 
+    m_VSP3ArrayEncoding.Set( vsp::VSP3_ARRAY_TEXT );
+
     m_BEMPropID = string();
 
     m_AFExportType.Set( vsp::BEZIER_AF_EXPORT );
@@ -558,6 +573,7 @@ void Vehicle::Init()
     m_exportCompGeomCsvFile.Set( true );
     m_exportDegenGeomCsvFile.Set( true );
     m_exportDegenGeomMFile.Set( true );
+    m_exportDegenGeomBinFile.Set( false );
 
     m_ViewDirty = true;
 
@@ -730,6 +746,7 @@ void Vehicle::Wype()
     m_ActiveGeom.clear();
     m_TopGeom.clear();
     m_ClipBoard.clear();
+    m_SnapshotMap.clear();
     m_SetNameVec.clear();
 
     for ( int i = 0; i < m_SetAttrCollVec.size(); i++ )
@@ -762,6 +779,7 @@ void Vehicle::Wype()
     Background3DMgr.Renew();
     StructureMgr.Renew();
     GeometryAnalysisMgr.Renew();
+    MaterialMgr.Renew();
 
     ResultsMgr.DeleteAllResults();
 
@@ -2107,6 +2125,47 @@ bool Vehicle::IDinClipboard( const string & id )
     return false;
 }
 
+//==== Record Parm Values, Links And Geom Tree In Memory ====//
+string Vehicle::SaveSnapshot()
+{
+    VehicleSnapshot snap;
+    snap.Capture( this );
+
+    string id = snap.GetID();
+    m_SnapshotMap[ id ] = snap;
+    return id;
+}
+
+//==== Restore Snapshot - Only Parms That Differ Are Set ====//
+int Vehicle::RestoreSnapshot( const string & snapshot_id, int & num_changed, string & err_msg )
+{
+    num_changed = 0;
+
+    auto it = m_SnapshotMap.find( snapshot_id );
+    if ( it == m_SnapshotMap.end() )
+    {
+        err_msg = "Can't find snapshot " + snapshot_id;
+        return vsp::VSP_INVALID_ID;
+    }
+
+    return it->second.Restore( this, num_changed, err_msg );
+}
+
+void Vehicle::DeleteSnapshot( const string & snapshot_id )
+{
+    m_SnapshotMap.erase( snapshot_id );
+}
+
+vector< string > Vehicle::GetSnapshotIDs()
+{
+    vector< string > id_vec;
+    for ( auto it = m_SnapshotMap.begin(); it != m_SnapshotMap.end(); ++it )
+    {
+        id_vec.push_back( it->first );
+    }
+    return id_vec;
+}
+
 //==== Copy Geoms In Vec - Create New IDs But Keep Parent/Child ====//
 vector< string > Vehicle::CopyGeomVec( const vector< string > & geom_vec )
 {
@@ -2563,6 +2622,20 @@ xmlNodePtr Vehicle::EncodeXml( xmlNodePtr & node, int set )
 }
 
 xmlNodePtr Vehicle::DecodeXml( xmlNodePtr & node )
+{
+    xmlNodePtr vehicle_node = DecodeXmlVehicle( node );
+
+    // 'GeomsOnly' is a euphamism for those entities we want to read when 'inserting' a file.
+    // It is mostly the Geoms, but also materials, presets, links, and advanced links.
+    DecodeXmlGeomsOnly( node );
+
+    DecodeXmlSettings( node );
+
+    return vehicle_node;
+}
+
+//==== Decode Vehicle Parms And Lights, Reset View ====//
+xmlNodePtr Vehicle::DecodeXmlVehicle( xmlNodePtr & node )
 {
     // Preserve viewport size.
     double viewX = m_ViewportSizeXValue();
@@ -2584,10 +2657,12 @@ xmlNodePtr Vehicle::DecodeXml( xmlNodePtr & node )
     m_ZoomValue = 0.018;
     m_XRotationValue = 0;    m_YRotationValue = 0;    m_ZRotationValue = 0;
 
-    // 'GeomsOnly' is a euphamism for those entities we want to read when 'inserting' a file.
-    // It is mostly the Geoms, but also materials, presets, links, and advanced links.
-    DecodeXmlGeomsOnly( node );
+    return vehicle_node;
+}
 
+//==== Decode Analysis Settings, Set Names And Set Attributes ====//
+void Vehicle::DecodeXmlSettings( xmlNodePtr & node )
+{
     VSPAEROMgr.DecodeXml( node );
     m_CfdSettings.DecodeXml( node );
     m_ISectSettings.DecodeXml( node );
@@ -2644,8 +2719,6 @@ xmlNodePtr Vehicle::DecodeXml( xmlNodePtr & node )
             }
         }
     }
-
-    return vehicle_node;
 }
 
 // DecodeXmlGeomsOnly is a stripped down version of DecodeXml.
@@ -2666,35 +2739,50 @@ xmlNodePtr Vehicle::DecodeXmlGeomsOnly( xmlNodePtr & node )
         // Decode label information.
         MeasureMgr.DecodeXml( vehicle_node );
 
-        int num = XmlUtil::GetNumNames( vehicle_node, "Geom" );
-        for ( int i = 0 ; i < num ; i++ )
+        // Walk siblings rather than GetNode( vehicle_node, "Geom", i ), which is O(n^2) in the number of Geoms
+        for ( xmlNodePtr geom_node = vehicle_node->xmlChildrenNode ; geom_node != nullptr ; geom_node = geom_node->next )
         {
-            xmlNodePtr geom_node = XmlUtil::GetNode( vehicle_node, "Geom", i );
-            if ( geom_node )
+            if ( !xmlStrcmp( geom_node->name, ( const xmlChar * )"Geom" ) )
             {
-                xmlNodePtr base_node = XmlUtil::GetNode( geom_node, "GeomBase", 0 );
+                DecodeXmlGeom( geom_node );
+            }
+        }
+    }
 
-                GeomType type;
-                type.m_Name   = XmlUtil::FindString( base_node, "TypeName", type.m_Name );
-                type.m_Type   = XmlUtil::FindInt( base_node, "TypeID", type.m_Type );
-                type.m_FixedFlag = !!XmlUtil::FindInt( base_node, "TypeFixed", type.m_FixedFlag );
+    DecodeXmlLinks( node );
 
-                string id = CreateGeom( type );
-                Geom* geom = FindGeom( id );
+    return vehicle_node;
+}
 
-                if ( geom )
-                {
-                    geom->DecodeXml( geom_node );
+//==== Create And Decode One Geom ====//
+string Vehicle::DecodeXmlGeom( xmlNodePtr & geom_node )
+{
+    xmlNodePtr base_node = XmlUtil::GetNode( geom_node, "GeomBase", 0 );
 
-                    if ( geom->GetParentID().compare( "NONE" ) == 0 )
-                    {
-                        AddGeom( geom );
-                    }
-                }
-            }
+    GeomType type;
+    type.m_Name   = XmlUtil::FindString( base_node, "TypeName", type.m_Name );
+    type.m_Type   = XmlUtil::FindInt( base_node, "TypeID", type.m_Type );
+    type.m_FixedFlag = !!XmlUtil::FindInt( base_node, "TypeFixed", type.m_FixedFlag );
+
+    string id = CreateGeom( type );
+    Geom* geom = FindGeom( id );
+
+    if ( geom )
+    {
+        geom->DecodeXml( geom_node );
+
+        if ( geom->GetParentID().compare( "NONE" ) == 0 )
+        {
+            AddGeom( geom );
         }
     }
 
+    return id;
+}
+
+//==== Decode Links, Presets, Modes, Structures And Analyses - After Geoms ====//
+void Vehicle::DecodeXmlLinks( xmlNodePtr & node )
+{
     LinkMgr.DecodeXml( node );
     AdvLinkMgr.DecodeXml( node );
     VarPresetMgr.DecodeXml( node );
@@ -2703,8 +2791,6 @@ xmlNodePtr Vehicle::DecodeXmlGeomsOnly( xmlNodePtr & node )
     ModeMgr.DecodeXml( node );
     StructureMgr.DecodeXml( node );
     GeometryAnalysisMgr.DecodeXml( node );
-
-    return vehicle_node;
 }
 
 //==== Write File ====//
@@ -2716,20 +2802,107 @@ bool Vehicle::WriteXMLFile( const string & file_name, int set )
     xmlDocSetRootElement( doc, root );
     XmlUtil::AddIntNode( root, "Version", CURRENT_FILE_VER );
 
+    //==== Large Arrays As Binary Blocks - Parm Is Saved Too, So Read It Before Encoding ====//
+    int encoding = m_VSP3ArrayEncoding();
+    XmlUtil::ClearSidecar();
+    XmlUtil::SetBinaryArrayMode( encoding );
+
     EncodeXml( root, set );
 
+    XmlUtil::SetBinaryArrayMode( XmlUtil::BINARY_ARRAY_NONE );
+
+    bool sidecar_ok = true;
+    if ( encoding == vsp::VSP3_ARRAY_SIDECAR && !XmlUtil::GetSidecarBuffer().empty() )
+    {
+        sidecar_ok = WriteSidecarFile( file_name, root );
+    }
+    XmlUtil::ClearSidecar();
+
     //===== Save XML Tree and Free Doc =====//
     int err = xmlSaveFormatFile( file_name.c_str(), doc, 1 );
     xmlFreeDoc( doc );
 
-    if( err == -1 )  // Failure occurred
+    if( err == -1 || !sidecar_ok )  // Failure occurred
+    {
+        return false;
+    }
+
+    return true;
+}
+
+//==== Write Binary Arrays Next To *.vsp3 File, Reference It From Root ====//
+bool Vehicle::WriteSidecarFile( const string & file_name, xmlNodePtr root )
+{
+    const vector< unsigned char > & buff = XmlUtil::GetSidecarBuffer();
+
+    string bin_file = file_name + ".bin";
+    FILE* fp = fopen( bin_file.c_str(), "wb" );
+    if ( !fp )
+    {
+        fprintf( stderr, "could not write binary sidecar file %s\n", bin_file.c_str() );
+        return false;
+    }
+
+    size_t nwrite = fwrite( buff.data(), 1, buff.size(), fp );
+    fclose( fp );
+
+    if ( nwrite != buff.size() )
     {
+        fprintf( stderr, "could not write binary sidecar file %s\n", bin_file.c_str() );
         return false;
     }
 
+    // Path relative to the *.vsp3 file so the pair can be moved together.
+    XmlUtil::SetStringProp( root, "BinaryFile", GetFilename( bin_file ) );
+    XmlUtil::SetStringProp( root, "BinarySize", to_string( ( unsigned long long )buff.size() ) );
+
     return true;
 }
 
+//==== Map Binary Sidecar Named On Root Node, If Any ====//
+// A missing or mismatched sidecar does not stop the read.  It is recorded as a
+// binary array error and each array that refers to it falls back or is left empty.
+void Vehicle::OpenSidecarFile( const string & file_name, const string & bin_name, const string & bin_size, MappedFile & mapped )
+{
+    if ( bin_name.empty() )
+    {
+        return;
+    }
+
+    string path, file;
+    GetPathFile( file_name, path, file );
+    string bin_file = path + "/" + bin_name;
+
+    if ( !mapped.Open( bin_file ) )
+    {
+        XmlUtil::AddBinaryArrayError( "Could not open binary sidecar file " + bin_file );
+        return;
+    }
+
+    if ( mapped.GetSize() != ( size_t )strtoull( bin_size.c_str(), nullptr, 10 ) )
+    {
+        XmlUtil::AddBinaryArrayError( "Binary sidecar file " + bin_file + " does not match document" );
+        mapped.Close();
+        return;
+    }
+
+    XmlUtil::SetSidecarData( mapped.GetData(), mapped.GetSize() );
+}
+
+//==== Report Binary Arrays That Could Not Be Read - The Model Is Kept ====//
+void Vehicle::ReportBinaryArrayErrors( const string & file_name )
+{
+    int num_err = XmlUtil::GetNumBinaryArrayErrors();
+    if ( num_err > 0 )
+    {
+        char buff[64];
+        snprintf( buff, sizeof( buff ), " (%d arrays affected)", num_err );
+        vsp::ErrorMgr.AddError( vsp::VSP_FILE_READ_FAILURE, "ReadXMLFile::" + file_name + ": " +
+                                XmlUtil::GetBinaryArrayErrorMsg() + buff );
+    }
+    XmlUtil::ClearBinaryArrayErrors();
+}
+
 //==== Read File ====//
 int Vehicle::ReadXMLFile( const string & file_name )
 {
@@ -2738,12 +2911,59 @@ int Vehicle::ReadXMLFile( const string & file_name )
     // Disable link updates when until all geoms are loaded
     LinkMgr.SetFreezeUpdateFlag( true );
 
-    //==== Read Xml File ====//
-    xmlDocPtr doc;
-
     LIBXML_TEST_VERSION
     xmlKeepBlanksDefault( 0 );
 
+    //==== Stream The File - Fall Back To Whole Document Parse If Nothing Could Be Read ====//
+    XmlUtil::ClearBinaryArrayErrors();
+    int err = m_StreamReadEnabled ? ReadXMLStream( file_name ) : 1;
+    if ( err == 1 )
+    {
+        XmlUtil::ClearBinaryArrayErrors();
+        err = ReadXMLDoc( file_name );
+    }
+
+    if ( err != 0 )
+    {
+        XmlUtil::ClearBinaryArrayErrors();
+        ParmMgr.ResetRemapID( lastreset );
+        LinkMgr.SetFreezeUpdateFlag( false );
+        return err;
+    }
+
+    ReportBinaryArrayErrors( file_name );
+
+    ParmMgr.ResetRemapID( lastreset );
+
+    Update();
+    AdvLinkMgr.ForceUpdate();
+
+    LinkMgr.SetFreezeUpdateFlag( false );
+
+    m_FileOpenVersion = -1;
+    return 0;
+}
+
+//==== Check File Version Before Anything Is Decoded ====//
+bool Vehicle::CheckFileVersion( xmlNodePtr root )
+{
+    m_FileOpenVersion = XmlUtil::FindInt( root, "Version", 0 );
+
+    if ( m_FileOpenVersion < MIN_FILE_VER )
+    {
+        fprintf( stderr, "document version not supported \n");
+        m_FileOpenVersion = -1;
+        return false;
+    }
+    return true;
+}
+
+//==== Read Whole Document Into Memory, Then Decode ====//
+int Vehicle::ReadXMLDoc( const string & file_name )
+{
+    //==== Read Xml File ====//
+    xmlDocPtr doc;
+
     //==== Build an XML tree from a the file ====//
     doc = xmlReadFile( file_name.c_str(), nullptr, XML_PARSE_HUGE );
     if ( doc == nullptr )
@@ -2775,33 +2995,215 @@ int Vehicle::ReadXMLFile( const string & file_name )
     }
 
     //==== Find Version Number ====//
-    m_FileOpenVersion = XmlUtil::FindInt( root, "Version", 0 );
-
-    if ( m_FileOpenVersion < MIN_FILE_VER )
+    if ( !CheckFileVersion( root ) )
     {
-        fprintf( stderr, "document version not supported \n");
         xmlFreeDoc( doc );
-        m_FileOpenVersion = -1;
         return 4;
     }
 
+    MappedFile sidecar;
+    OpenSidecarFile( file_name, XmlUtil::FindStringProp( root, "BinaryFile", string() ),
+                     XmlUtil::FindStringProp( root, "BinarySize", string() ), sidecar );
+
     //==== Decode Vehicle from document ====//
     DecodeXml( root );
 
+    XmlUtil::ClearSidecar();
+
     //===== Free Doc =====//
     xmlFreeDoc( doc );
 
-    ParmMgr.ResetRemapID( lastreset );
+    return 0;
+}
 
-    Update();
-    AdvLinkMgr.ForceUpdate();
+//==== Attribute Of Current Reader Node, Empty If Missing ====//
+static string GetReaderAttribute( xmlTextReaderPtr reader, const char * name )
+{
+    string ret;
+    xmlChar* str = xmlTextReaderGetAttribute( reader, ( const xmlChar * )name );
+    if ( str )
+    {
+        ret = string( ( const char * )str );
+        xmlFree( str );
+    }
+    return ret;
+}
 
-    LinkMgr.SetFreezeUpdateFlag( false );
+//==== Stream File - Each Geom Is Decoded As Soon As It Is Read, Then Freed ====//
+// Everything outside the Geoms is small, so it is copied into a skeleton document
+// and decoded at the end in the same order as DecodeXml.  Memory is bounded by the
+// largest single Geom rather than by the whole file.
+int Vehicle::ReadXMLStream( const string & file_name )
+{
+    xmlTextReaderPtr reader = xmlReaderForFile( file_name.c_str(), nullptr, XML_PARSE_HUGE | XML_PARSE_NOBLANKS );
+    if ( reader == nullptr )
+    {
+        return 1;
+    }
+
+    //==== Find Root Element ====//
+    int ret = xmlTextReaderRead( reader );
+    while ( ret == 1 && xmlTextReaderNodeType( reader ) != XML_READER_TYPE_ELEMENT )
+    {
+        ret = xmlTextReaderRead( reader );
+    }
+
+    if ( ret != 1 )
+    {
+        xmlFreeTextReader( reader );
+        return 1;
+    }
+
+    if ( xmlStrcmp( xmlTextReaderConstName( reader ), ( const xmlChar * )"Vsp_Geometry" ) )
+    {
+        fprintf( stderr, "document of the wrong type, Vsp Geometry not found\n" );
+        xmlFreeTextReader( reader );
+        return 3;
+    }
+
+    //==== Sidecar Must Be Mapped Before Any Geom Is Decoded ====//
+    MappedFile sidecar;
+    OpenSidecarFile( file_name, GetReaderAttribute( reader, "BinaryFile" ), GetReaderAttribute( reader, "BinarySize" ), sidecar );
+
+    //==== Skeleton Document For Everything But The Geoms ====//
+    xmlDocPtr doc = xmlNewDoc( ( const xmlChar * )"1.0" );
+    xmlNodePtr root = xmlNewNode( nullptr, ( const xmlChar * )"Vsp_Geometry" );
+    xmlDocSetRootElement( doc, root );
+
+    xmlNodePtr vehicle_node = nullptr;
+    bool in_vehicle = false;
+    bool vehicle_decoded = false;
+
+    // User materials are written after the Vehicle, so Geoms using one are decoded
+    // before it is known.  Their names are kept and resolved once it has been read.
+    vector< std::pair< string, string > > geom_material_vec;
+
+    ret = xmlTextReaderRead( reader );
+    while ( ret == 1 )
+    {
+        int depth = xmlTextReaderDepth( reader );
+
+        if ( xmlTextReaderNodeType( reader ) != XML_READER_TYPE_ELEMENT || depth < 1 || depth > 2 )
+        {
+            ret = xmlTextReaderRead( reader );
+            continue;
+        }
+
+        const xmlChar* name = xmlTextReaderConstName( reader );
+
+        if ( depth == 1 )
+        {
+            in_vehicle = !xmlStrcmp( name, ( const xmlChar * )"Vehicle" );
+        }
+
+        if ( depth == 1 && in_vehicle )
+        {
+            //==== Descend Into Vehicle - Its Geoms Are Streamed ====//
+            vehicle_node = xmlNewChild( root, nullptr, ( const xmlChar * )"Vehicle", nullptr );
+            ret = xmlTextReaderRead( reader );
+        }
+        else if ( depth == 2 && in_vehicle && !xmlStrcmp( name, ( const xmlChar * )"Geom" ) )
+        {
+            //==== Vehicle Parms, Lights And Measures Precede The Geoms In The File ====//
+            if ( !vehicle_decoded )
+            {
+                if ( !CheckFileVersion( root ) )
+                {
+                    XmlUtil::ClearSidecar();
+                    xmlFreeDoc( doc );
+                    xmlFreeTextReader( reader );
+                    return 4;
+                }
+
+                DecodeXmlVehicle( root );
+                MeasureMgr.DecodeXml( vehicle_node );
+                vehicle_decoded = true;
+            }
+
+            xmlNodePtr geom_node = xmlTextReaderExpand( reader );
+            if ( geom_node )
+            {
+                string mat_name = XmlUtil::FindString( XmlUtil::GetNode( geom_node, "Material", 0 ), "Name", string() );
+                string geom_id = DecodeXmlGeom( geom_node );
+                if ( !mat_name.empty() )
+                {
+                    geom_material_vec.push_back( std::make_pair( geom_id, mat_name ) );
+                }
+            }
+            ret = xmlTextReaderNext( reader );
+        }
+        else
+        {
+            //==== Copy Small Nodes Into Skeleton ====//
+            xmlNodePtr n = xmlTextReaderExpand( reader );
+            if ( n )
+            {
+                xmlAddChild( ( depth == 1 ) ? root : vehicle_node, xmlDocCopyNode( n, doc, 1 ) );
+            }
+            ret = xmlTextReaderNext( reader );
+        }
+    }
+
+    xmlFreeTextReader( reader );
+
+    if ( ret != 0 )
+    {
+        if ( !vehicle_decoded )
+        {
+            fprintf( stderr, "could not parse XML document, trying again with more permissive parser\n" );
+            XmlUtil::ClearSidecar();
+            xmlFreeDoc( doc );
+            return 1;
+        }
+
+        // Geoms already decoded can not be taken back, keep what was read like the permissive parser would.
+        fprintf( stderr, "XML parse error, loading the part of the document read before the error\n" );
+    }
+
+    if ( !vehicle_decoded )
+    {
+        if ( !CheckFileVersion( root ) )
+        {
+            XmlUtil::ClearSidecar();
+            xmlFreeDoc( doc );
+            return 4;
+        }
+
+        DecodeXmlVehicle( root );
+        if ( vehicle_node )
+        {
+            MeasureMgr.DecodeXml( vehicle_node );
+        }
+    }
+
+    //==== Remainder In DecodeXml Order ====//
+    MaterialMgr.DecodeXml( root );
+    ResolveGeomMaterials( geom_material_vec );
+    DecodeXmlLinks( root );
+    DecodeXmlSettings( root );
+
+    XmlUtil::ClearSidecar();
+    xmlFreeDoc( doc );
 
-    m_FileOpenVersion = -1;
     return 0;
 }
 
+//==== Apply Material Names That Were Unknown When The Geoms Were Decoded ====//
+void Vehicle::ResolveGeomMaterials( const vector< std::pair< string, string > > & geom_material_vec )
+{
+    Material mat;
+    for ( int i = 0 ; i < ( int )geom_material_vec.size() ; i++ )
+    {
+        Geom* geom_ptr = FindGeom( geom_material_vec[i].first );
+        const string & name = geom_material_vec[i].second;
+
+        if ( geom_ptr && geom_ptr->GetMaterial()->m_Name != name && MaterialMgr.FindMaterial( name, mat ) )
+        {
+            geom_ptr->SetMaterial( mat.m_Name, mat.m_Ambi, mat.m_Diff, mat.m_Spec, mat.m_Emis, mat.m_Shininess );
+        }
+    }
+}
+
 //==== Read File ====//
 int Vehicle::ReadXMLFileGeomsOnly( const string & file_name )
 {
@@ -2854,10 +3256,19 @@ int Vehicle::ReadXMLFileGeomsOnly( const string & file_name )
         return 4;
     }
 
+    XmlUtil::ClearBinaryArrayErrors();
+
+    MappedFile sidecar;
+    OpenSidecarFile( file_name, XmlUtil::FindStringProp( root, "BinaryFile", string() ),
+                     XmlUtil::FindStringProp( root, "BinarySize", string() ), sidecar );
+
     //==== Decode Vehicle from document ====//
 
     DecodeXmlGeomsOnly( root );
 
+    XmlUtil::ClearSidecar();
+    ReportBinaryArrayErrors( file_name );
+
     //===== Free Doc =====//
     xmlFreeDoc( doc );
 
@@ -5945,6 +6356,10 @@ string Vehicle::getExportFileName( int type )
     {
         doreturn = true;
     }
+    else if ( type == DEGEN_GEOM_BIN_TYPE )
+    {
+        doreturn = true;
+    }
     else if ( type == PROJ_AREA_CSV_TYPE )
     {
         doreturn = true;
@@ -6009,6 +6424,10 @@ void Vehicle::setExportFileName( int type, const string &f_name )
     {
         doset = true;
     }
+    else if ( type == DEGEN_GEOM_BIN_TYPE )
+    {
+        doset = true;
+    }
     else if ( type == PROJ_AREA_CSV_TYPE )
     {
         doset = true;
@@ -6038,8 +6457,8 @@ void Vehicle::setExportFileName( int type, const string &f_name )
 
 void Vehicle::resetExportFileNames()
 {
-    const char *suffix[] = {"_CompGeom.txt", "_CompGeom.csv", "_Slice.txt", "_MassProps.txt", "_DegenGeom.csv", "_DegenGeom.m", "_ProjArea.csv", "_WaveDrag.txt", ".tri", "_ParasiteBuildUp.csv", ".vspgeom" };
-    const int types[] = { COMP_GEOM_TXT_TYPE, COMP_GEOM_CSV_TYPE, SLICE_TXT_TYPE, MASS_PROP_TXT_TYPE, DEGEN_GEOM_CSV_TYPE, DEGEN_GEOM_M_TYPE, PROJ_AREA_CSV_TYPE, WAVE_DRAG_TXT_TYPE, VSPAERO_PANEL_TRI_TYPE, DRAG_BUILD_CSV_TYPE, VSPAERO_VSPGEOM_TYPE };
+    const char *suffix[] = {"_CompGeom.txt", "_CompGeom.csv", "_Slice.txt", "_MassProps.txt", "_DegenGeom.csv", "_DegenGeom.m", "_ProjArea.csv", "_WaveDrag.txt", ".tri", "_ParasiteBuildUp.csv", ".vspgeom", "_DegenGeom.bin" };
+    const int types[] = { COMP_GEOM_TXT_TYPE, COMP_GEOM_CSV_TYPE, SLICE_TXT_TYPE, MASS_PROP_TXT_TYPE, DEGEN_GEOM_CSV_TYPE, DEGEN_GEOM_M_TYPE, PROJ_AREA_CSV_TYPE, WAVE_DRAG_TXT_TYPE, VSPAERO_PANEL_TRI_TYPE, DRAG_BUILD_CSV_TYPE, VSPAERO_VSPGEOM_TYPE, DEGEN_GEOM_BIN_TYPE };
     const int ntype = ( sizeof(types) / sizeof(types[0]) );
 
     string fname = m_VSP3FileName;
@@ -6820,6 +7239,8 @@ void Vehicle::CreateDegenGeom( int set, bool useMode, const string &modeID )
     m_DegenGeomVec.clear();
     m_DegenPtMassVec.clear();
 
+    vector< Geom* > degen_geom_vec;
+
     vector< Geom* > geom_vec = FindGeomVec( GetGeomVec() );
     for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
     {
@@ -6840,14 +7261,27 @@ void Vehicle::CreateDegenGeom( int set, bool useMode, const string &modeID )
             }
             else
             {
-                vector < DegenGeom > dgs;
-                geom_vec[i]->CreateDegenGeom( dgs );
-                // m_DegenGeomVec accumulates here.
-                m_DegenGeomVec.insert( m_DegenGeomVec.end(), dgs.begin(), dgs.end() );
+                degen_geom_vec.push_back( geom_vec[i] );
             }
         }
     }
 
+    // Each Geom tessellates and degenerates only its own surfaces and sub-surfaces,
+    // so Geoms are built concurrently and gathered in Geom order.
+    vector< vector < DegenGeom > > dgs_vec( degen_geom_vec.size() );
+    ParallelFor( ( int )degen_geom_vec.size(), DEGEN_GEOM_PARALLEL_CHUNK, [&]( int begin, int end )
+    {
+        for ( int i = begin; i < end; i++ )
+        {
+            degen_geom_vec[i]->CreateDegenGeom( dgs_vec[i] );
+        }
+    } );
+
+    for ( int i = 0 ; i < ( int )dgs_vec.size() ; i++ )
+    {
+        m_DegenGeomVec.insert( m_DegenGeomVec.end(), dgs_vec[i].begin(), dgs_vec[i].end() );
+    }
+
     vector< string > active_vec_store = GetActiveGeomVec();
 
     string id = AddMeshGeom( set );
@@ -6989,6 +7423,38 @@ string Vehicle::WriteDegenGeomFile()
         }
     }
 
+    if ( getExportDegenGeomBinFile() )
+    {
+        string file_name = getExportFileName( DEGEN_GEOM_BIN_TYPE );
+        FILE* file_id = fopen( file_name.c_str(), "wb" );
+        if ( !file_id )
+        {
+            outStr += "\tFAILED TO OPEN: ";
+            outStr += file_name;
+            outStr += "\n";
+        }
+        else
+        {
+            DegenGeom::write_degenGeomBin_header( file_id );
+
+            for ( int i = 0; i < (int)m_DegenPtMassVec.size(); i++ )
+            {
+                DegenGeom::write_degenPtMassBin_file( file_id, m_DegenPtMassVec[i] );
+            }
+
+            for ( int i = 0; i < (int)m_DegenGeomVec.size(); i++ )
+            {
+                m_DegenGeomVec[i].write_degenGeomBin_file( file_id );
+            }
+
+            fclose( file_id );
+
+            outStr += "\t";
+            outStr += file_name;
+            outStr += "\n";
+        }
+    }
+
     // Create results object to contain the ids of all of the results associated
     // with degen geoms
     Results *res = ResultsMgr.CreateResults( "DegenGeom", "Vehicle level degen geom results." );
@@ -41,6 +41,7 @@
 #include "WaveDragMgr.h"
 #include "GroupTransformations.h"
 #include "ResultsMgr.h"
+#include "VehicleSnapshot.h"
 
 #include <cassert>
 
@@ -52,7 +53,7 @@
 
 // File versions must be integers.
 #define MIN_FILE_VER 4 // Lowest file version number for 3.X vsp file
-#define CURRENT_FILE_VER 5 // File version number for 3.X files that this executable writes
+#define CURRENT_FILE_VER 6 // File version number for 3.X files that this executable writes
 
 // We have not made substantial use of this flag to determine file compatibility issues.  However,
 // its use will likely increase going forward.  Most parameters additions and file format changes
@@ -64,6 +65,8 @@
 
 #define DEFAULT_SET vsp::SET_TYPE::SET_SHOWN // Default set index
 
+class MappedFile;
+
 //==== Vehicle ====//
 class Vehicle : public ParmContainer
 {
@@ -143,6 +146,8 @@ public:
     void DeleteGeom( const string & geom_id );
     void AddTopGeomID( const string & geom_id, const string &insert_after_id = string() );
     void RemoveTopGeomID( const string & geom_id );
+    vector< string > GetTopGeomVec()                                 { return m_TopGeom; }
+    void SetTopGeomVec( const vector< string > & top_vec )           { m_TopGeom = top_vec; }
     void CutGeomVec( const vector<string> & cut_vec );
     void RemoveGeomVecFromHierarchy( const vector<string> & cut_vec );
     void DeleteClipBoard();
@@ -150,6 +155,13 @@ public:
     bool IDinClipboard( const string & id );
     vector< string > CopyGeomVec( const vector<string> & geom_vec );
 
+    //==== In-Memory Snapshots Of Parm Values, Links And Geom Tree ====//
+    string SaveSnapshot();
+    int RestoreSnapshot( const string & snapshot_id, int & num_changed, string & err_msg );
+    void DeleteSnapshot( const string & snapshot_id );
+    void DeleteAllSnapshots()                                        { m_SnapshotMap.clear(); }
+    vector< string > GetSnapshotIDs();
+
     void LoadDrawObjs( vector< DrawObj* > & draw_obj_vec );
 
     //==== Geom Sets ====//
@@ -192,6 +204,10 @@ public:
     xmlNodePtr DecodeXml( xmlNodePtr & node );
 
     xmlNodePtr DecodeXmlGeomsOnly( xmlNodePtr & node );
+    xmlNodePtr DecodeXmlVehicle( xmlNodePtr & node );
+    string DecodeXmlGeom( xmlNodePtr & geom_node );
+    void DecodeXmlLinks( xmlNodePtr & node );
+    void DecodeXmlSettings( xmlNodePtr & node );
 
     bool ExistMesh( int set );
     bool ExistType( int set, int geomtype );
@@ -200,10 +216,19 @@ public:
 
     int ReadXMLFile( const string & file_name );
     int ReadXMLFileGeomsOnly( const string & file_name );
+    int ReadXMLDoc( const string & file_name );
+    int ReadXMLStream( const string & file_name );
+    void ResolveGeomMaterials( const vector< std::pair< string, string > > & geom_material_vec );
+    bool CheckFileVersion( xmlNodePtr root );
+    bool WriteSidecarFile( const string & file_name, xmlNodePtr root );
+    void OpenSidecarFile( const string & file_name, const string & bin_name, const string & bin_size, MappedFile & mapped );
+    void ReportBinaryArrayErrors( const string & file_name );
 
     void SetVSP3FileName( const string & f_name );
     string GetVSP3FileName()                                { return m_VSP3FileName; }
     int GetFileVersion() const                                    { return m_FileOpenVersion; }
+    bool GetStreamReadEnabled() const                       { return m_StreamReadEnabled; }
+    void SetStreamReadEnabled( bool flag )                  { m_StreamReadEnabled = flag; }
     void MakeRelativePath( string & fname );
     void MakeAbsolutePath( string & fname );
 
@@ -304,6 +329,8 @@ public:
     bool getExportDegenGeomMFile( ) const                    { return m_exportDegenGeomMFile(); }
     void setExportDegenGeomCsvFile( bool b )           { m_exportDegenGeomCsvFile.Set( b ); }
     void setExportDegenGeomMFile( bool b )             { m_exportDegenGeomMFile.Set( b ); }
+    bool getExportDegenGeomBinFile( ) const                  { return m_exportDegenGeomBinFile(); }
+    void setExportDegenGeomBinFile( bool b )           { m_exportDegenGeomBinFile.Set( b ); }
 
     //==== Import Files ====//
     string ImportFile( const string & file_name, int file_type );
@@ -543,6 +570,7 @@ public:
     Parm m_XRotationValue;
     Parm m_YRotationValue;
     Parm m_ZRotationValue;
+    BoolParm m_CPUPickingFlag;
 
     bool m_ViewDirty;
 
@@ -585,10 +613,13 @@ public:
     BoolParm m_UseModeExportFlag;
     BoolParm m_UseModeDegenGeomFlag;
 
+    IntParm m_VSP3ArrayEncoding;
+
     BoolParm m_exportCompGeomTxtFile;
     BoolParm m_exportCompGeomCsvFile;
     BoolParm m_exportDegenGeomCsvFile;
     BoolParm m_exportDegenGeomMFile;
+    BoolParm m_exportDegenGeomBinFile;
 
     IntParm m_DegenGeomMeshType;
 
@@ -629,6 +660,8 @@ protected:
     vector< string > m_TopGeom;                 // Top (no Parent) Geom IDs
     vector< string > m_ClipBoard;               // Clipboard IDs
 
+    unordered_map < string, VehicleSnapshot > m_SnapshotMap;     // Snapshot ID -> Snapshot
+
     XSec * m_SavedXSec;
     XSecCurve * m_SavedXSecCurve;
 
@@ -655,6 +688,9 @@ protected:
     // File Version Number
     int m_FileOpenVersion;
 
+    // ReadXMLFile streams the file, else parses the whole document
+    bool m_StreamReadEnabled;
+
     string m_ExePath;
     string m_HomePath;
     string m_HelpPath;
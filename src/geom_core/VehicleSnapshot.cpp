@@ -0,0 +1,382 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// VehicleSnapshot.cpp: implementation of the VehicleSnapshot class.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "VehicleSnapshot.h"
+#include "Vehicle.h"
+#include "ParmMgr.h"
+#include "LinkMgr.h"
+#include "AdvLinkMgr.h"
+#include "VspUtil.h"
+
+#include <set>
+
+//==== Constructor ====//
+VehicleSnapshot::VehicleSnapshot()
+{
+    m_ID = GenerateRandomID( vsp::ID_LENGTH_PARMCONTAINER );
+}
+
+//==== Record Parm Values, Links And Geom Tree ====//
+void VehicleSnapshot::Capture( Vehicle* veh )
+{
+    if ( !veh )
+    {
+        return;
+    }
+
+    ParmMgr.GetAllParmVals( m_ParmIDVec, m_ParmValVec );
+
+    //==== Geom Tree ====//
+    m_TopGeomVec = veh->GetTopGeomVec();
+
+    vector< string > geom_vec = veh->GetGeomVec();
+    m_GeomVec.clear();
+    m_GeomVec.reserve( geom_vec.size() );
+
+    vector< string > parm_vec;
+    for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
+    {
+        Geom* geom_ptr = veh->FindGeom( geom_vec[i] );
+        if ( geom_ptr )
+        {
+            parm_vec.clear();
+            geom_ptr->AddLinkableParms( parm_vec );
+
+            SnapshotGeom sg;
+            sg.m_ID = geom_ptr->GetID();
+            sg.m_ParentID = geom_ptr->GetParentID();
+            sg.m_ChildIDVec = geom_ptr->GetChildIDVec();
+            sg.m_NumParms = ( int )parm_vec.size();
+            m_GeomVec.push_back( sg );
+        }
+    }
+
+    //==== Parm Links ====//
+    m_LinkVec.clear();
+    for ( int i = 0 ; i < LinkMgr.GetNumLinks() ; i++ )
+    {
+        Link* link = LinkMgr.GetLink( i );
+        if ( link )
+        {
+            SnapshotLink sl;
+            sl.m_ID = link->GetID();
+            sl.m_ParmA = link->GetParmA();
+            sl.m_ParmB = link->GetParmB();
+            sl.m_OffsetFlag = link->GetOffsetFlag();
+            sl.m_ScaleFlag = link->GetScaleFlag();
+            sl.m_LowerLimitFlag = link->GetLowerLimitFlag();
+            sl.m_UpperLimitFlag = link->GetUpperLimitFlag();
+            m_LinkVec.push_back( sl );
+        }
+    }
+
+    //==== Advanced Links ====//
+    m_AdvLinkVec.clear();
+    vector< AdvLink* > adv_vec = AdvLinkMgr.GetLinks();
+    for ( int i = 0 ; i < ( int )adv_vec.size() ; i++ )
+    {
+        SnapshotAdvLink sal;
+        sal.m_Name = adv_vec[i]->GetName();
+        sal.m_ScriptCode = adv_vec[i]->GetScriptCode();
+        sal.m_InputVars = adv_vec[i]->GetInputVars();
+        sal.m_OutputVars = adv_vec[i]->GetOutputVars();
+        m_AdvLinkVec.push_back( sal );
+    }
+}
+
+//==== Write Snapshot Back Into Vehicle ====//
+int VehicleSnapshot::Restore( Vehicle* veh, int & num_changed, string & err_msg )
+{
+    num_changed = 0;
+
+    if ( !veh )
+    {
+        err_msg = "Invalid Vehicle";
+        return vsp::VSP_INVALID_PTR;
+    }
+
+    //==== Nothing Is Changed Unless Everything Can Be Restored ====//
+    int err = Check( veh, err_msg );
+    if ( err != vsp::VSP_OK )
+    {
+        return err;
+    }
+
+    RestoreGeomTree( veh );
+    RestoreLinks();
+    RestoreAdvLinks();
+
+    return RestoreParms( num_changed, err_msg );
+}
+
+//==== Check Everything In The Snapshot Still Exists ====//
+int VehicleSnapshot::Check( Vehicle* veh, string & err_msg )
+{
+    vector< string > parm_vec;
+    for ( int i = 0 ; i < ( int )m_GeomVec.size() ; i++ )
+    {
+        Geom* geom_ptr = veh->FindGeom( m_GeomVec[i].m_ID );
+        if ( !geom_ptr )
+        {
+            err_msg = "Geom " + m_GeomVec[i].m_ID + " deleted since snapshot";
+            return vsp::VSP_INVALID_GEOM_ID;
+        }
+
+        parm_vec.clear();
+        geom_ptr->AddLinkableParms( parm_vec );
+        if ( ( int )parm_vec.size() != m_GeomVec[i].m_NumParms )
+        {
+            err_msg = "Geom " + m_GeomVec[i].m_ID + " structure changed since snapshot";
+            return vsp::VSP_INVALID_GEOM_ID;
+        }
+    }
+
+    for ( int i = 0 ; i < ( int )m_LinkVec.size() ; i++ )
+    {
+        if ( !LinkMgr.GetLink( m_LinkVec[i].m_ID ) )
+        {
+            err_msg = "Link " + m_LinkVec[i].m_ID + " deleted since snapshot";
+            return vsp::VSP_INVALID_ID;
+        }
+    }
+
+    for ( int i = 0 ; i < ( int )m_AdvLinkVec.size() ; i++ )
+    {
+        if ( AdvLinkMgr.GetLinkIndex( m_AdvLinkVec[i].m_Name ) < 0 )
+        {
+            err_msg = "Advanced link " + m_AdvLinkVec[i].m_Name + " deleted since snapshot";
+            return vsp::VSP_CANT_FIND_NAME;
+        }
+    }
+
+    //==== Geom Parm Counts Miss Vehicle, Measure And Other Containers ====//
+    for ( int i = 0 ; i < ( int )m_ParmIDVec.size() ; i++ )
+    {
+        if ( !ParmMgr.FindParm( m_ParmIDVec[i] ) )
+        {
+            err_msg = "Parm " + m_ParmIDVec[i] + " deleted since snapshot";
+            return vsp::VSP_INVALID_ID;
+        }
+    }
+
+    return vsp::VSP_OK;
+}
+
+//==== Remove New Geoms And Restore Parent/Child Relations ====//
+void VehicleSnapshot::RestoreGeomTree( Vehicle* veh )
+{
+    std::set< string > snap_ids;
+    for ( int i = 0 ; i < ( int )m_GeomVec.size() ; i++ )
+    {
+        snap_ids.insert( m_GeomVec[i].m_ID );
+    }
+
+    vector< string > del_vec;
+    vector< string > geom_vec = veh->GetGeomVec();
+    for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
+    {
+        if ( snap_ids.count( geom_vec[i] ) == 0 )
+        {
+            del_vec.push_back( geom_vec[i] );
+        }
+    }
+
+    if ( !del_vec.empty() )
+    {
+        veh->DeleteGeomVec( del_vec );
+    }
+
+    for ( int i = 0 ; i < ( int )m_GeomVec.size() ; i++ )
+    {
+        const SnapshotGeom & sg = m_GeomVec[i];
+        Geom* geom_ptr = veh->FindGeom( sg.m_ID );
+        if ( !geom_ptr )
+        {
+            continue;
+        }
+
+        if ( geom_ptr->GetParentID() != sg.m_ParentID )
+        {
+            geom_ptr->SetParentID( sg.m_ParentID );
+            geom_ptr->SetDirtyFlag( GeomBase::XFORM );
+            geom_ptr->SetLateUpdateFlag( true );
+            veh->SetGeomMapDirtyFlag( true );
+        }
+
+        if ( geom_ptr->GetChildIDVec() != sg.m_ChildIDVec )
+        {
+            vector< string > child_vec = sg.m_ChildIDVec;
+            geom_ptr->SetChildIDVec( child_vec );
+            veh->SetGeomMapDirtyFlag( true );
+        }
+    }
+
+    if ( veh->GetTopGeomVec() != m_TopGeomVec )
+    {
+        veh->SetTopGeomVec( m_TopGeomVec );
+        veh->SetGeomMapDirtyFlag( true );
+    }
+}
+
+//==== Remove New Links And Restore Link Targets ====//
+void VehicleSnapshot::RestoreLinks()
+{
+    std::set< string > snap_ids;
+    for ( int i = 0 ; i < ( int )m_LinkVec.size() ; i++ )
+    {
+        snap_ids.insert( m_LinkVec[i].m_ID );
+    }
+
+    std::set< int > del_set;
+    for ( int i = 0 ; i < LinkMgr.GetNumLinks() ; i++ )
+    {
+        Link* link = LinkMgr.GetLink( i );
+        if ( link && snap_ids.count( link->GetID() ) == 0 )
+        {
+            del_set.insert( i );
+        }
+    }
+
+    if ( !del_set.empty() )
+    {
+        LinkMgr.DelLinks( del_set );
+    }
+
+    for ( int i = 0 ; i < ( int )m_LinkVec.size() ; i++ )
+    {
+        const SnapshotLink & sl = m_LinkVec[i];
+        Link* link = LinkMgr.GetLink( sl.m_ID );
+        if ( !link )
+        {
+            continue;
+        }
+
+        if ( link->GetParmA() != sl.m_ParmA || link->GetParmB() != sl.m_ParmB )
+        {
+            link->SetParmA( sl.m_ParmA );
+            link->SetParmB( sl.m_ParmB );
+            LinkMgr.InvalidateLinkGraph();
+        }
+
+        link->SetOffsetFlag( sl.m_OffsetFlag );
+        link->SetScaleFlag( sl.m_ScaleFlag );
+        link->SetLowerLimitFlag( sl.m_LowerLimitFlag );
+        link->SetUpperLimitFlag( sl.m_UpperLimitFlag );
+    }
+}
+
+//==== Compare Var Names And Parms ====//
+static bool SameVarDefs( const vector< VarDef > & a, const vector< VarDef > & b )
+{
+    if ( a.size() != b.size() )
+    {
+        return false;
+    }
+
+    for ( int i = 0 ; i < ( int )a.size() ; i++ )
+    {
+        if ( a[i].m_VarName != b[i].m_VarName || a[i].m_ParmID != b[i].m_ParmID )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//==== Remove New Advanced Links And Restore Code And Vars ====//
+void VehicleSnapshot::RestoreAdvLinks()
+{
+    std::set< string > snap_names;
+    for ( int i = 0 ; i < ( int )m_AdvLinkVec.size() ; i++ )
+    {
+        snap_names.insert( m_AdvLinkVec[i].m_Name );
+    }
+
+    vector< AdvLink* > adv_vec = AdvLinkMgr.GetLinks();
+    for ( int i = 0 ; i < ( int )adv_vec.size() ; i++ )
+    {
+        if ( snap_names.count( adv_vec[i]->GetName() ) == 0 )
+        {
+            AdvLinkMgr.DelLink( adv_vec[i] );
+        }
+    }
+
+    for ( int i = 0 ; i < ( int )m_AdvLinkVec.size() ; i++ )
+    {
+        const SnapshotAdvLink & sal = m_AdvLinkVec[i];
+        AdvLink* adv_link = AdvLinkMgr.GetLink( AdvLinkMgr.GetLinkIndex( sal.m_Name ) );
+        if ( !adv_link )
+        {
+            continue;
+        }
+
+        bool rebuild = false;
+
+        if ( !SameVarDefs( adv_link->GetInputVars(), sal.m_InputVars ) )
+        {
+            adv_link->DeleteAllVars( true );
+            for ( int j = 0 ; j < ( int )sal.m_InputVars.size() ; j++ )
+            {
+                adv_link->AddVar( sal.m_InputVars[j], true );
+            }
+            rebuild = true;
+        }
+
+        if ( !SameVarDefs( adv_link->GetOutputVars(), sal.m_OutputVars ) )
+        {
+            adv_link->DeleteAllVars( false );
+            for ( int j = 0 ; j < ( int )sal.m_OutputVars.size() ; j++ )
+            {
+                adv_link->AddVar( sal.m_OutputVars[j], false );
+            }
+            rebuild = true;
+        }
+
+        if ( adv_link->GetScriptCode() != sal.m_ScriptCode )
+        {
+            adv_link->SetScriptCode( sal.m_ScriptCode );
+            rebuild = true;
+        }
+
+        if ( rebuild )
+        {
+            adv_link->BuildScript();
+        }
+    }
+}
+
+//==== Write Back Only Parms That Differ - Links Resolved Once ====//
+int VehicleSnapshot::RestoreParms( int & num_changed, string & err_msg )
+{
+    num_changed = 0;
+    int err = vsp::VSP_OK;
+
+    LinkMgr.StartBatch();
+    for ( int i = 0 ; i < ( int )m_ParmIDVec.size() ; i++ )
+    {
+        Parm* p = ParmMgr.FindParm( m_ParmIDVec[i] );
+        if ( !p )
+        {
+            // Check() found every parm, so only a Geom or link removed above can get here.
+            if ( err == vsp::VSP_OK )
+            {
+                err_msg = "Parm " + m_ParmIDVec[i] + " removed during restore";
+                err = vsp::VSP_INVALID_ID;
+            }
+        }
+        else if ( p->Get() != m_ParmValVec[i] )
+        {
+            p->Set( m_ParmValVec[i] );
+            num_changed++;
+        }
+    }
+    LinkMgr.EndBatch();
+
+    return err;
+}
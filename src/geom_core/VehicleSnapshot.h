@@ -0,0 +1,97 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// VehicleSnapshot.h: In-memory record of parm values, links and the Geom tree
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(VEHICLESNAPSHOT__INCLUDED_)
+#define VEHICLESNAPSHOT__INCLUDED_
+
+#include "AdvLink.h"
+
+#include <string>
+#include <vector>
+
+using std::string;
+using std::vector;
+
+class Vehicle;
+
+//==== Geom Tree Node ====//
+class SnapshotGeom
+{
+public:
+
+    string m_ID;
+    string m_ParentID;
+    vector< string > m_ChildIDVec;
+    int m_NumParms;                             // Linkable parm count, detects added/removed xsecs etc.
+};
+
+//==== Parm Link ====//
+class SnapshotLink
+{
+public:
+
+    string m_ID;
+    string m_ParmA;
+    string m_ParmB;
+    bool m_OffsetFlag;
+    bool m_ScaleFlag;
+    bool m_LowerLimitFlag;
+    bool m_UpperLimitFlag;
+};
+
+//==== Advanced Link ====//
+class SnapshotAdvLink
+{
+public:
+
+    string m_Name;
+    string m_ScriptCode;
+    vector< VarDef > m_InputVars;
+    vector< VarDef > m_OutputVars;
+};
+
+//==== Vehicle Snapshot ====//
+// Restore only writes parms that differ, so only the Geoms they belong to are
+// marked dirty.  Geoms, links and advanced links created after the snapshot are
+// removed.  Anything that was deleted or restructured since can not be rebuilt
+// from the snapshot and must be reloaded from file instead; every stored Geom,
+// link and parm ID is checked first and Restore fails without changing anything.
+class VehicleSnapshot
+{
+public:
+
+    VehicleSnapshot();
+
+    void Capture( Vehicle* veh );
+    int Restore( Vehicle* veh, int & num_changed, string & err_msg );
+
+    string GetID() const                        { return m_ID; }
+    int GetNumParms() const                     { return ( int )m_ParmIDVec.size(); }
+
+protected:
+
+    int Check( Vehicle* veh, string & err_msg );
+    void RestoreGeomTree( Vehicle* veh );
+    void RestoreLinks();
+    void RestoreAdvLinks();
+    int RestoreParms( int & num_changed, string & err_msg );
+
+    string m_ID;
+
+    vector< string > m_ParmIDVec;
+    vector< double > m_ParmValVec;
+
+    vector< string > m_TopGeomVec;
+    vector< SnapshotGeom > m_GeomVec;
+
+    vector< SnapshotLink > m_LinkVec;
+    vector< SnapshotAdvLink > m_AdvLinkVec;
+};
+
+#endif // !defined(VEHICLESNAPSHOT__INCLUDED_)
@@ -11,7 +11,7 @@
 #include "MeshGeom.h"
 #include "ModeMgr.h"
 
-DegenGeomScreen::DegenGeomScreen( ScreenMgr* mgr ) : BasicScreen( mgr, 375, 405 + 60, "Degen Geom - Compute Models, File IO" )
+DegenGeomScreen::DegenGeomScreen( ScreenMgr* mgr ) : BasicScreen( mgr, 375, 405 + 60 + 25, "Degen Geom - Compute Models, File IO" )
 {
     m_FLTK_Window->callback( staticCloseCB, this );
     m_MainLayout.SetGroupAndScreen( m_FLTK_Window, this );
@@ -44,6 +44,12 @@ DegenGeomScreen::DegenGeomScreen( ScreenMgr* mgr ) : BasicScreen( mgr, 375, 405
     m_BorderLayout.ForceNewLine();
     m_BorderLayout.AddYGap();
 
+    m_BorderLayout.AddButton(m_BinToggle, ".bin");
+    m_BorderLayout.AddOutput(m_BinOutput);
+    m_BorderLayout.AddButton(m_BinSelect, "...");
+    m_BorderLayout.ForceNewLine();
+    m_BorderLayout.AddYGap();
+
     m_BorderLayout.SetFitWidthFlag( true );
     m_BorderLayout.SetSameLineFlag( false );
 
@@ -174,12 +180,15 @@ bool DegenGeomScreen::Update()
     //===== Update File Toggle Buttons =====//
     m_CsvToggle.Update( vehiclePtr->m_exportDegenGeomCsvFile.GetID() );
     m_MToggle.Update( vehiclePtr->m_exportDegenGeomMFile.GetID() );
+    m_BinToggle.Update( vehiclePtr->m_exportDegenGeomBinFile.GetID() );
 
     //===== Update File Output Text =====//
     string csvName = vehiclePtr->getExportFileName( vsp::DEGEN_GEOM_CSV_TYPE );
     string mName = vehiclePtr->getExportFileName( vsp::DEGEN_GEOM_M_TYPE );
     m_CsvOutput.Update( StringUtil::truncateFileName( csvName, 40 ).c_str() );
     m_MOutput.Update( StringUtil::truncateFileName( mName, 40 ).c_str() );
+    string binName = vehiclePtr->getExportFileName( vsp::DEGEN_GEOM_BIN_TYPE );
+    m_BinOutput.Update( StringUtil::truncateFileName( binName, 40 ).c_str() );
 
     m_MeshTypeChoice.Update( vehiclePtr->m_DegenGeomMeshType.GetID() );
 
@@ -215,6 +224,10 @@ void DegenGeomScreen::GuiDeviceCallBack( GuiDevice* device )
     {
         vehiclePtr->setExportFileName( vsp::DEGEN_GEOM_M_TYPE, m_ScreenMgr->FileChooser( "Select degen geom Matlab output file.", "*.m", vsp::SAVE ) );
     }
+    else if ( device == &m_BinSelect )
+    {
+        vehiclePtr->setExportFileName( vsp::DEGEN_GEOM_BIN_TYPE, m_ScreenMgr->FileChooser( "Select degen geom binary output file.", "*.bin", vsp::SAVE ) );
+    }
     else if ( device == &m_UseSet )
     {
         m_SelectedSetIndex = m_UseSet.GetVal();
@@ -240,7 +253,7 @@ void DegenGeomScreen::GuiDeviceCallBack( GuiDevice* device )
         vehiclePtr->CreateDegenGeom( m_SelectedSetIndex, useMode, modeID );
         m_TextDisplay->buffer()->append("Done!\n");
 
-        if ( vehiclePtr->getExportDegenGeomCsvFile() || vehiclePtr->getExportDegenGeomMFile() )
+        if ( vehiclePtr->getExportDegenGeomCsvFile() || vehiclePtr->getExportDegenGeomMFile() || vehiclePtr->getExportDegenGeomBinFile() )
         {
             m_TextDisplay->buffer()->append("--------------------------------\n");
             m_TextDisplay->buffer()->append("\nWriting output...\n");
@@ -21,6 +21,7 @@
 #include "ClippingScreen.h"
 #include "CurveEditScreen.h"
 #include "Display.h"
+#include "ElementBuffer.h"
 #include "Entity.h"
 #include "FitModelScreen.h"
 #include "GeometryAnalysisScreen.h"
@@ -63,12 +64,15 @@
 
 #pragma warning(disable:4244)
 
+// Pixel radius around the mouse for CPU vertex picking.
+#define CPU_PICK_RADIUS 10.0f
+
 using namespace VSPGraphic;
 
 namespace VSPGUI
 {
 VspGlWindow::VspGlWindow( int x, int y, int w, int h, ScreenMgr * mgr, DrawObj::ScreenEnum drawObjScreen )
-    : Fl_Gl_Window( x, y, w, h, "VSP GL Window" )
+    : Fl_Gl_Window( x, y, w, h, "VSP GL Window" ), m_GeomPicker( PickBVH::PICK_SURF ), m_PntPicker( PickBVH::PICK_PNTS )
 {
     mode( FL_RGB | FL_ALPHA | FL_DEPTH | FL_DOUBLE | FL_MULTISAMPLE );
     m_GEngine = new VSPGraphic::GraphicEngine();
@@ -181,6 +185,11 @@ void VspGlWindow::draw()
         m_ScreenMgr->GetScreen( vsp::VSP_SCREENSHOT_SCREEN )->Update();
     }
 
+    if ( m_GEngine->getScene()->getCPUPicking() && m_GEngine->getScene()->isPickingEnabled() )
+    {
+        _cpuPick();
+    }
+
     m_GEngine->draw( m_mouse_x, m_mouse_y );
 }
 
@@ -356,11 +365,18 @@ void VspGlWindow::update()
         // Load Objects to Renderer.
         _update( drawObjs );
 
+        m_GEngine->getScene()->setCPUPicking( vPtr->m_CPUPickingFlag() );
+        if ( vPtr->m_CPUPickingFlag() )
+        {
+            _updatePicking( drawObjs );
+        }
+
         for( int i = 0; i < (int)drawObjs.size(); i++ )
         {
             if( drawObjs[i]->m_Screen == m_LinkedScreen )
             {
                 drawObjs[i]->m_GeomChanged = false;
+                drawObjs[i]->m_ElemChanged = false;
             }
         }
     }
@@ -519,6 +535,7 @@ void VspGlWindow::ResetDrawObjsGeomChangedFlags( vector< DrawObj* > & drawObjs,
     for( int i = 0; i < (int)drawObjs.size(); i++ )
     {
         drawObjs[i]->m_GeomChanged = flag;
+        drawObjs[i]->m_ElemChanged = flag;
     }
 }
 
@@ -1959,6 +1976,147 @@ void VspGlWindow::_updateBuffer( const std::vector<DrawObj *> &objects )
     }
 }
 
+void VspGlWindow::_updatePicking( const std::vector<DrawObj *> &objects )
+{
+    std::unordered_map< std::string, DrawObj * > objects_map;
+    for( int j = 0; j < ( int )objects.size(); j++ )
+    {
+        objects_map[ objects[j]->m_GeomID ] = objects[j];
+    }
+
+    std::vector< DrawObj * > geomSrc, pntSrc;
+    std::vector< unsigned int > geomIDs, pntIDs;
+    bool changed = false;
+
+    for( int i = 0; i < ( int )objects.size(); i++ )
+    {
+        DrawObj * pick = objects[i];
+
+        if( pick->m_Screen != m_LinkedScreen || !pick->m_Visible ||
+            ( pick->m_Type != DrawObj::VSP_PICK_GEOM && pick->m_Type != DrawObj::VSP_PICK_VERTEX ) )
+        {
+            continue;
+        }
+
+        ID * pickID = _findID( pick->m_GeomID );
+        auto it = objects_map.find( pick->m_PickSourceID );
+        if( !pickID || it == objects_map.end() )
+        {
+            continue;
+        }
+
+        changed = changed || it->second->m_GeomChanged;
+
+        if( pick->m_Type == DrawObj::VSP_PICK_GEOM )
+        {
+            geomSrc.push_back( it->second );
+            geomIDs.push_back( pickID->bufferID );
+        }
+        else
+        {
+            pntSrc.push_back( it->second );
+            pntIDs.push_back( pickID->bufferID );
+        }
+    }
+
+    // Trees copy the vertices, so only reload them when something moved.
+    if( changed || geomIDs != m_GeomPickIDs || pntIDs != m_PntPickIDs )
+    {
+        m_GeomPicker.Update( geomSrc );
+        m_PntPicker.Update( pntSrc );
+        m_GeomPickIDs.swap( geomIDs );
+        m_PntPickIDs.swap( pntIDs );
+    }
+}
+
+void VspGlWindow::_cpuPick()
+{
+    Scene * scene = m_GEngine->getScene();
+    Viewport * vp = m_GEngine->getDisplay()->getViewport();
+    if( !vp )
+    {
+        return;
+    }
+
+    glm::vec2 mouse( m_mouse_x, m_mouse_y );
+
+    glm::vec3 o, d;
+    vp->screenToRay( mouse, o, d );
+    vec3d org( o.x, o.y, o.z );
+    vec3d dir( d.x, d.y, d.z );
+
+    // Pick radius in model units at the mouse, half the color picking point size.
+    glm::vec3 w0 = vp->screenToWorld( mouse );
+    glm::vec3 w1 = vp->screenToWorld( mouse + glm::vec2( CPU_PICK_RADIUS, 0 ) );
+    double tol = glm::length( w1 - w0 );
+
+    PickHit pntHit, geomHit;
+    bool pntFound = m_PntPicker.RayPick( org, dir, tol, pntHit );
+    bool geomFound = m_GeomPicker.RayPick( org, dir, tol, geomHit );
+
+    // Vertices on or in front of the first surface win, as they do in the color pass.
+    if( pntFound && ( !geomFound || pntHit.m_T <= geomHit.m_T + tol ) )
+    {
+        scene->activatePicking( m_PntPickIDs[ pntHit.m_Obj ], pntHit.m_Index );
+    }
+    else if( geomFound )
+    {
+        scene->activatePicking( m_GeomPickIDs[ geomHit.m_Obj ], geomHit.m_Index );
+    }
+    else
+    {
+        scene->activatePicking( 0xFFFFFFFF, 0 );
+    }
+
+    // Box selection, vertices inside the four planes through the box edges.
+    if( glm::any( glm::isnan( m_startShiftLB ) ) )
+    {
+        return;
+    }
+
+    if( m_startShiftLB.x == mouse.x || m_startShiftLB.y == mouse.y )
+    {
+        scene->preSelect( std::vector< unsigned int >(), std::vector< int >() );
+        return;
+    }
+
+    glm::vec2 corner[4] = { m_startShiftLB, glm::vec2( mouse.x, m_startShiftLB.y ), mouse, glm::vec2( m_startShiftLB.x, mouse.y ) };
+    vec3d corg[4], cdir[4];
+    vec3d cen;
+    for( int i = 0; i < 4; i++ )
+    {
+        vp->screenToRay( corner[i], o, d );
+        corg[i] = vec3d( o.x, o.y, o.z );
+        cdir[i] = vec3d( d.x, d.y, d.z );
+        cen = cen + corg[i] * 0.25;
+    }
+
+    std::vector< vec3d > plane_org( 4 ), plane_norm( 4 );
+    for( int i = 0; i < 4; i++ )
+    {
+        int j = ( i + 1 ) % 4;
+        vec3d n = cross( cdir[i], corg[j] - corg[i] );
+        if( dot( cen - corg[i], n ) < 0 )
+        {
+            n = n * -1.0;
+        }
+        plane_org[i] = corg[i];
+        plane_norm[i] = n;
+    }
+
+    std::vector< PickHit > hits;
+    m_PntPicker.FrustumSelect( plane_org, plane_norm, hits );
+
+    std::vector< unsigned int > ids( hits.size() );
+    std::vector< int > indices( hits.size() );
+    for( int i = 0; i < ( int )hits.size(); i++ )
+    {
+        ids[i] = m_PntPickIDs[ hits[i].m_Obj ];
+        indices[i] = hits[i].m_Index;
+    }
+    scene->preSelect( ids, indices );
+}
+
 void VspGlWindow::_updateTextures( DrawObj * drawObj )
 {
     VspGlWindow::ID * id = _findID( drawObj->m_GeomID );
@@ -2063,6 +2221,30 @@ void VspGlWindow::_updateTextures( DrawObj * drawObj )
 
 void VspGlWindow::_loadXSecData( Renderable * destObj, DrawObj * drawObj )
 {
+    // Packed meshes upload as is.  The element buffer is only sent when it changed.
+    if ( drawObj->m_MeshPacked )
+    {
+        destObj->setFacingCW( drawObj->m_FlipNormals );
+
+        destObj->updateVBuffer( drawObj->m_VertBuf.data(), sizeof( float ) * drawObj->m_VertBuf.size() );
+
+        if ( drawObj->m_ElemChanged || destObj->getEBuffer()->getElemSize() != drawObj->m_ElemBuf.size() )
+        {
+            destObj->updateEBuffer( drawObj->m_ElemBuf.data(), sizeof( unsigned int ) * drawObj->m_ElemBuf.size() );
+
+            for ( int lod = 0; lod < ( int )drawObj->m_LODElemBuf.size(); lod++ )
+            {
+                const std::vector< unsigned int > &elems = drawObj->m_LODElemBuf[lod];
+                destObj->updateLODEBuffer( lod + 1, ( void * )elems.data(), sizeof( unsigned int ) * elems.size() );
+            }
+        }
+        destObj->enableEBuffer( true );
+
+        const vec3d &c = drawObj->m_BndCenter;
+        destObj->setBounds( glm::vec3( c.x(), c.y(), c.z() ), drawObj->m_BndRadius );
+        return;
+    }
+
     std::vector<float> vdata;
     std::vector<unsigned int> edata;
 
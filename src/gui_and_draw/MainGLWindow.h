@@ -14,6 +14,7 @@
 #include "Common.h"
 
 #include "DrawObj.h"
+#include "PickBVH.h"
 
 namespace VSPGraphic
 {
@@ -169,6 +170,9 @@ private:
 
     void _updateBuffer( const std::vector<DrawObj *> &objects );
 
+    void _updatePicking( const std::vector<DrawObj *> &objects );
+    void _cpuPick();
+
     void _sendFeedback( VSPGraphic::Selectable * selected );
     void _sendFeedback( const std::vector<VSPGraphic::Selectable *> &listOfSelected );
 
@@ -229,6 +233,12 @@ private:
 
     unsigned m_prevKey;
 
+    // CPU picking trees over pick sources, and the scene id of each source's Pickable.
+    PickBVH m_GeomPicker;
+    PickBVH m_PntPicker;
+    std::vector< unsigned int > m_GeomPickIDs;
+    std::vector< unsigned int > m_PntPickIDs;
+
 protected:
 
     void _update( const std::vector<DrawObj*> & objects );
@@ -723,6 +723,63 @@ void MainVSPScreen::ScreenGrab( const string & fname, int w, int h, bool transpa
     }
 }
 
+// Scene buffers are loaded once, only the camera changes between images.  Draws through
+// the main window's OpenGL context, so the window must be shown.
+bool MainVSPScreen::ScreenGrabViews( const vector < string > & fnames, const vector < vec3d > & rots, const vector < double > & zooms,
+                                     const vector < vec3d > & pans, const vector < vec3d > & cors, int w, int h, bool transparentBG, bool autocrop )
+{
+    if ( !m_GlWin || !m_GlWin->shown() )
+    {
+        return false;
+    }
+
+    bool framebufferSupported = true;
+    if ( !glewIsSupported( "GL_ARB_framebuffer_object" ) )
+    {
+        framebufferSupported = false;
+    }
+
+    VSPGraphic::Display * display = m_GlWin->getGraphicEngine()->getDisplay();
+
+    glm::vec3 oldCOR = display->getCOR();
+    glm::vec2 oldPan = display->getPanValues();
+    float oldZoom = display->getRelativeZoomValue();
+    glm::vec3 oldRot = display->getRotationEulerAngles();
+
+    // Same order as the Adjust View screen: center of rotation, pan, zoom, rotation.
+    m_GlWin->getGraphicEngine()->dumpScreenImages( fnames, w, h, transparentBG, autocrop, framebufferSupported, VSPGraphic::GraphicEngine::PNG, [&]( int i )
+    {
+        if ( i < ( int )cors.size() )
+        {
+            display->setCOR( -cors[i].x(), -cors[i].y(), -cors[i].z() );
+            display->center();
+        }
+
+        if ( i < ( int )pans.size() )
+        {
+            display->relativePan( pans[i].x(), pans[i].y() );
+        }
+        else
+        {
+            display->relativePan( oldPan.x, oldPan.y );
+        }
+
+        display->relativeZoom( i < ( int )zooms.size() ? zooms[i] : oldZoom );
+
+        display->rotateSphere( rots[i].x() * ( M_PI / 180.0 ),
+                               rots[i].y() * ( M_PI / 180.0 ),
+                               rots[i].z() * ( M_PI / 180.0 ) );
+    } );
+
+    display->setCOR( oldCOR.x, oldCOR.y, oldCOR.z );
+    display->center();
+    display->relativePan( oldPan.x, oldPan.y );
+    display->relativeZoom( oldZoom );
+    display->rotateSphere( oldRot.x, oldRot.y, oldRot.z );
+
+    return true;
+}
+
 void MainVSPScreen::SetViewAxis( bool vaxis )
 {
     if ( m_GlWin )
@@ -64,6 +64,8 @@ public:
     void HideExitImplementation();
 
     void ScreenGrab( const string & fname, int w, int h, bool transparentBG, bool autocrop );
+    bool ScreenGrabViews( const vector < string > & fnames, const vector < vec3d > & rots, const vector < double > & zooms,
+                          const vector < vec3d > & pans, const vector < vec3d > & cors, int w, int h, bool transparentBG, bool autocrop );
     void SetViewAxis( bool vaxis );
     void SetShowBorders( bool brdr );
     void SetBackground( double r, double g, double b );
@@ -108,6 +108,7 @@ ScreenMgr::ScreenMgr( Vehicle* vPtr )
     m_RunGUI = true;
 
     m_ShowPlotScreenOnce = false;
+    m_ScreenGrabViewsOK = false;
     m_UpdateCount = 0;
 
     m_DisabledGUIElements.resize( vsp::NUM_GDEV_TYPES, false );
@@ -710,6 +711,95 @@ void ScreenMgr::APIScreenGrab( const string & fname, int w, int h, bool transpar
     }
 }
 
+void ScreenMgr::APIScreenGrabViewsImplementation( const vector < string > & fnames, const vector < vec3d > & rots, const vector < double > & zooms,
+                                                  const vector < vec3d > & pans, const vector < vec3d > & cors, int w, int h, bool transparentBG, bool autocrop )
+{
+    // Collect OpenGL data and redraw once for the whole batch.
+    ( ( MainVSPScreen* ) m_ScreenVec[vsp::VSP_MAIN_SCREEN] )->Update();
+
+    m_ScreenGrabViewsOK = ( ( MainVSPScreen* ) m_ScreenVec[vsp::VSP_MAIN_SCREEN] )->ScreenGrabViews( fnames, rots, zooms, pans, cors, w, h, transparentBG, autocrop );
+
+    // Set flag that task has been completed.
+    m_TaskComplete = true;
+}
+
+struct ScreenGrabViewsStruct {
+    vector < string > m_fnames;
+    vector < vec3d > m_rots;
+    vector < double > m_zooms;
+    vector < vec3d > m_pans;
+    vector < vec3d > m_cors;
+    int m_w;
+    int m_h;
+    bool m_TransparentBG;
+    bool m_AutoCrop;
+    ScreenMgr * m_ScrMgr;
+};
+
+void APIScreenGrabViewsHandler( void * data )
+{
+    ScreenGrabViewsStruct * sg = ( ScreenGrabViewsStruct * ) data;
+
+    std::unique_lock lk( sg->m_ScrMgr->m_TaskMutex );
+
+    sg->m_ScrMgr->APIScreenGrabViewsImplementation( sg->m_fnames, sg->m_rots, sg->m_zooms, sg->m_pans, sg->m_cors, sg->m_w, sg->m_h, sg->m_TransparentBG, sg->m_AutoCrop );
+
+    lk.unlock();
+
+    sg->m_ScrMgr->m_TaskCV.notify_one();
+
+    delete sg;
+}
+
+bool ScreenMgr::APIScreenGrabViews( const vector < string > & fnames, const vector < vec3d > & rots, const vector < double > & zooms,
+                                    const vector < vec3d > & pans, const vector < vec3d > & cors, int w, int h, bool transparentBG, bool autocrop )
+{
+    // Mark that task has not been completed.
+    m_TaskComplete = false;
+    m_ScreenGrabViewsOK = false;
+
+    if ( MainThreadIDMgr.IsCurrentThreadMain() )
+    {
+        // Simple main thread code path.
+        APIScreenGrabViewsImplementation( fnames, rots, zooms, pans, cors, w, h, transparentBG, autocrop );
+    }
+    else
+    {
+        // Works for Python under Facde.
+        ScreenGrabViewsStruct *sg = new ScreenGrabViewsStruct;
+        sg->m_fnames = fnames;
+        sg->m_rots = rots;
+        sg->m_zooms = zooms;
+        sg->m_pans = pans;
+        sg->m_cors = cors;
+        sg->m_w = w;
+        sg->m_h = h;
+        sg->m_TransparentBG = transparentBG;
+        sg->m_AutoCrop = autocrop;
+        sg->m_ScrMgr = this;
+
+        // Queue task to main thread.
+        Fl::awake( APIScreenGrabViewsHandler, sg );
+
+        // Release lock to allow main thread to process queue.
+        Fl::unlock();
+
+        // Set up lock and mutex.
+        std::unique_lock lk( m_TaskMutex );
+
+        // Wait for change in task flag.
+        m_TaskCV.wait(lk, [this]
+            {
+                return m_TaskComplete;
+            });
+
+        // Re-acquire lock from main thread.
+        Fl::lock();
+    }
+
+    return m_ScreenGrabViewsOK;
+}
+
 bool ScreenMgr::IsGUIElementDisabled( int e ) const
 {
     if ( e >= 0 && e < m_DisabledGUIElements.size() )
@@ -87,6 +87,12 @@ public:
     void APIScreenGrabImplementation( const string & fname, int w, int h, bool transparentBG, bool autocrop );
     void APIScreenGrab( const string & fname, int w, int h, bool transparentBG, bool autocrop );
 
+    void APIScreenGrabViewsImplementation( const vector < string > & fnames, const vector < vec3d > & rots, const vector < double > & zooms,
+                                           const vector < vec3d > & pans, const vector < vec3d > & cors, int w, int h, bool transparentBG, bool autocrop );
+    // Returns false if no OpenGL context was available to draw in.
+    bool APIScreenGrabViews( const vector < string > & fnames, const vector < vec3d > & rots, const vector < double > & zooms,
+                             const vector < vec3d > & pans, const vector < vec3d > & cors, int w, int h, bool transparentBG, bool autocrop );
+
     bool IsGUIElementDisabled( int e ) const;
     void SetGUIElementDisable( int e, bool state );
     bool IsGUIScreenDisabled( int s ) const;
@@ -99,6 +105,7 @@ public:
     mutex m_TaskMutex;
     condition_variable m_TaskCV;
     bool m_TaskComplete;
+    bool m_ScreenGrabViewsOK;
 
     mutex m_ScreenGrabMutex;
     condition_variable m_ScreenGrabCV;
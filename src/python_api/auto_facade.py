@@ -24,8 +24,31 @@ IS_GUI_RUNNING_DOC = """
     \"\"\"
 """
 
+BATCH_CALL_DOC = """
+    \"\"\"
+    Runs a list of API calls and returns the list of their results. Each call is a tuple of the
+    function name, an optional tuple of arguments and an optional dict of keyword arguments.
+    With the facade, the whole list is sent to the server in a single round trip.
+
+
+    .. code-block:: python
+
+        results = BatchCall( [ ( 'GetParmVal', ( pid_a, ) ), ( 'GetParmVal', ( pid_b, ) ) ] )
+
+    \"\"\"
+"""
+
 PLACEHOLDER_FUNCS = "# **Placeholder start**\n" + "def IsFacade():" + IS_FACADE_DOC + "\n    return False\n"
 PLACEHOLDER_FUNCS += "def IsGUIRunning():" + IS_GUI_RUNNING_DOC + "\n    return False\n"
+PLACEHOLDER_FUNCS += "def BatchCall(calls):" + BATCH_CALL_DOC + """
+    results = []
+    for call in calls:
+        func = globals()[call[0]] if isinstance(call[0], str) else call[0]
+        args = tuple(call[1]) if len(call) > 1 else ()
+        kwargs = dict(call[2]) if len(call) > 2 else {}
+        results.append(func(*args, **kwargs))
+    return results
+"""
 
 CLIENT_HEAD = r"""
 # Facade Code
@@ -36,7 +59,7 @@ import socket
 from time import sleep, time
 import subprocess
 import pickle
-from openvsp.facade_server import pack_data, unpack_data
+from openvsp.facade_server import pack_data, unpack_data, recv_data, SharedArena
 from traceback import format_exception
 import openvsp_config
 # Import the low-level C/C++ module
@@ -116,6 +139,7 @@ class _vsp_server():
                     pass
         if self._proc is None:
             raise RuntimeError("Facade failed to start the server")
+        self._arena = SharedArena()
         self._sock = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
         self._sock.connect((HOST, self.port))
 
@@ -127,20 +151,13 @@ class _vsp_server():
 CLIENT_END = """
     # function to send and receive data from the facade server
     def _send_receive(self, func_name, args, kwargs):
-        b_data = pack_data([func_name, args, kwargs], True)
+        b_data = pack_data([func_name, args, kwargs], True, arena=self._arena)
         self._sock.sendall(b_data)
         result = None
-        b_result = []
-        while True:
-            packet = self._sock.recv(202400)
-            if not packet: break
-            b_result.append(packet)
-            try:
-                result = unpack_data(b_result)
-                break
-            except:
-                pass
-        if isinstance(result, list) and result[0] == "error":
+        b_result = recv_data(self._sock)
+        if b_result:
+            result = unpack_data(b_result, arena=self._arena)
+        if isinstance(result, list) and len(result) > 0 and isinstance(result[0], str) and result[0] == "error":
             sys.excepthook = _exception_hook
             raise Exception(result[1])
         return result
@@ -169,6 +186,27 @@ CLIENT_END = """
         \"\"\"
 
         return self._send_receive('IsGUIRunning', [], {})
+    def BatchCall(self, calls):
+        \"\"\"
+        Runs a list of API calls and returns the list of their results. Each call is a tuple of the
+        function name, an optional tuple of arguments and an optional dict of keyword arguments.
+        The whole list is sent to the server in a single round trip and run while holding the
+        GUI lock once. If a call raises, the calls after it are not run.
+
+
+        .. code-block:: python
+
+            results = BatchCall( [ ( 'GetParmVal', ( pid_a, ) ), ( 'GetParmVal', ( pid_b, ) ) ] )
+
+        \"\"\"
+
+        cmd_list = []
+        for call in calls:
+            func_name = call[0] if isinstance(call[0], str) else call[0].__name__
+            args = tuple(call[1]) if len(call) > 1 else ()
+            kwargs = dict(call[2]) if len(call) > 2 else {}
+            cmd_list.append([func_name, args, kwargs])
+        return self._send_receive('BatchCall', [cmd_list], {})
 
     def _run_func(self, func, *args, **kwargs):
         try:
@@ -195,6 +233,10 @@ CLIENT_END = """
             del self.t
         except:
             pass
+        try:
+            self._arena.close()
+        except:
+            pass
     def __del__(self):
         try:
             self._proc.terminate()
@@ -212,6 +254,10 @@ CLIENT_END = """
             del self.t
         except:
             pass
+        try:
+            self._arena.close()
+        except:
+            pass
 
 
 class _server_controller():
@@ -329,9 +375,13 @@ def make_server():
     server_string = r"""
 from threading import Thread, Event
 import pickle
+import struct
 import traceback
+import os
 import sys
 from time import sleep
+from multiprocessing import shared_memory
+import numpy as np
 
 #special code that is not generalizable
 import openvsp_config
@@ -357,74 +407,257 @@ gui_wait = True
 global gui_active
 gui_active = False
 
-def pack_data(data, is_command_list=False):
-    def sub_pack(sub_data):
-        new_data = sub_data
-        if isinstance(sub_data, module.vec3d):
-            new_data = {"name":'vec3d',
-                "x":sub_data.x(),
-                "y":sub_data.y(),
-                "z":sub_data.z(),
-            }
-        elif isinstance(sub_data, list) or isinstance(sub_data, tuple):
-            if len(sub_data) > 0:
-                if isinstance(sub_data[0], module.vec3d):
-                    new_data = {
-                        "name": "vec3d_list",
-                        "list": []
-                    }
-                    for p in sub_data:
-                        thing = {
-                            "x":p.x(),
-                            "y":p.y(),
-                            "z":p.z(),
-                        }
-                        new_data['list'].append(thing)
-                elif sub_data[0] == "error":
-                    pass
+# Arrays at least this large go through shared memory instead of the socket, negative disables
+try:
+    SHM_MIN_BYTES = openvsp_config.FACADE_SHM_MIN_BYTES
+except AttributeError:
+    SHM_MIN_BYTES = 65536
+_SHM_MIN_ITEMS = SHM_MIN_BYTES // 8 if SHM_MIN_BYTES >= 0 else -1
+
+# Every message is a length header followed by the pickled payload
+_HEADER = struct.Struct("!Q")
+_ALIGN = 64
+
+def _aligned(nbytes):
+    return (nbytes + _ALIGN - 1) // _ALIGN * _ALIGN
+
+def _attach_shm(name):
+    # Attaching must not register the segment with this process's resource tracker,
+    # or it gets unlinked out from under the owner when this process exits.
+    try:
+        return shared_memory.SharedMemory(name=name, track=False)
+    except TypeError:
+        shm = shared_memory.SharedMemory(name=name)
+        if os.name == "posix":
+            try:
+                from multiprocessing import resource_tracker
+                resource_tracker.unregister(shm._name, "shared_memory")
+            except Exception:
+                pass
+        return shm
+
+class SharedArena():
+    # One growable shared memory segment per sending end of a connection.  Arrays put in
+    # it are only valid until that end sends its next message.  That is safe because each
+    # side copies a message out while unpacking it, before it replies.
+    def __init__(self):
+        self.shm = None
+        self.attached = {}
+
+    def put(self, arrays):
+        total = sum(_aligned(arr.nbytes) for arr in arrays)
+        if self.shm is None or self.shm.size < total:
+            size = total if self.shm is None else max(total, 2 * self.shm.size)
+            self._release()
+            self.shm = shared_memory.SharedMemory(create=True, size=size)
+        refs = []
+        offset = 0
+        for arr in arrays:
+            if arr.nbytes > 0:
+                np.ndarray(arr.shape, dtype=arr.dtype, buffer=self.shm.buf, offset=offset)[...] = arr
+            refs.append((self.shm.name, offset))
+            offset += _aligned(arr.nbytes)
+        return refs
+
+    def get(self, name, offset, dtype, shape):
+        shm = self.attached.get(name)
+        if shm is None:
+            # The other end replaced its segment, the old one is no longer needed
+            for old in self.attached.values():
+                old.close()
+            shm = _attach_shm(name)
+            self.attached = {name: shm}
+        return np.ndarray(shape, dtype=dtype, buffer=shm.buf, offset=offset).copy()
+
+    def _release(self):
+        if self.shm is not None:
+            try:
+                self.shm.close()
+                self.shm.unlink()
+            except Exception:
+                pass
+            self.shm = None
 
-        return new_data
+    def close(self):
+        self._release()
+        for shm in self.attached.values():
+            try:
+                shm.close()
+            except Exception:
+                pass
+        self.attached = {}
 
-    if is_command_list:
+_default_arena = SharedArena()
 
-        #commands look like this: [func_name (str), args (list [arg1, arg2, argn]), kwargs (dict keyword1: arg1, kw2: arg2)  ]
-        # example
-        #                               [comp_name,     args,       dict]
-        # vsp.compvecpnt01(uv_array) -> ["compvepnt01", [uv_array], {}  ]
-        #
-        new_data = [data[0], [], {}]
-        for value in data[1]:
-            new_data[1].append(sub_pack(value))
-        for key, value in data[2].items():
-            new_data[2][key] = sub_pack(value)
-        new_data[1] = tuple(new_data[1])
+def _is_number(value):
+    return isinstance(value, (float, int)) and not isinstance(value, bool)
+
+def _pack_array(arr, kind, pending, inner=None):
+    arr = np.ascontiguousarray(arr)
+    new_data = {"name": "array", "kind": kind, "inner": inner, "dtype": arr.dtype.str, "shape": arr.shape}
+    if SHM_MIN_BYTES >= 0 and arr.nbytes >= SHM_MIN_BYTES and not arr.dtype.hasobject:
+        # Filled in with the segment name and offset once the whole message is known
+        pending.append((new_data, arr))
     else:
-       new_data = sub_pack(data)
-    b_data = pickle.dumps(new_data)
-    return b_data
-
-def unpack_data(b_data, is_command_list=False):
-    def sub_unpack(sub_data):
-        n_data = sub_data
-        if isinstance(sub_data, dict):
-            if sub_data['name'] == 'vec3d':
-                n_data = module.vec3d(sub_data['x'], sub_data['y'], sub_data['z'])
-            elif sub_data['name'] == 'vec3d_list':
-                n_data = []
-                for r in sub_data['list']:
-                    n_data.append(module.vec3d(r['x'], r['y'], r['z']))
-        return n_data
-
-    data = pickle.loads(b"".join(b_data))
+        new_data["data"] = arr
+    return new_data
+
+def _pack_number_seq(seq, kind, inner, ndim, pending):
+    arr = np.asarray(seq)
+    if arr.ndim != ndim or arr.dtype.kind not in "fi":
+        return seq
+    return _pack_array(arr, kind, pending, inner)
+
+def _sub_pack(sub_data, pending):
+    new_data = sub_data
+    if isinstance(sub_data, module.vec3d):
+        new_data = {"name":'vec3d',
+            "x":sub_data.x(),
+            "y":sub_data.y(),
+            "z":sub_data.z(),
+        }
+    elif isinstance(sub_data, np.ndarray):
+        new_data = _pack_array(sub_data, "ndarray", pending)
+    elif isinstance(sub_data, dict) and sub_data.get("name") == "batch":
+        new_data = {"name": "batch", "list": [_sub_pack(r, pending) for r in sub_data["list"]]}
+    elif isinstance(sub_data, list) or isinstance(sub_data, tuple):
+        kind = "list" if isinstance(sub_data, list) else "tuple"
+        if len(sub_data) > 0:
+            first = sub_data[0]
+            if isinstance(first, module.vec3d):
+                xyz = np.array([(p.x(), p.y(), p.z()) for p in sub_data], dtype=np.float64)
+                new_data = _pack_array(xyz, "vec3d_list", pending)
+            elif _is_number(first):
+                if _SHM_MIN_ITEMS >= 0 and len(sub_data) >= _SHM_MIN_ITEMS:
+                    new_data = _pack_number_seq(sub_data, kind, None, 1, pending)
+            elif isinstance(first, (list, tuple)):
+                if len(first) > 0 and _is_number(first[0]):
+                    if _SHM_MIN_ITEMS >= 0 and len(sub_data) * len(first) >= _SHM_MIN_ITEMS:
+                        inner = "list" if isinstance(first, list) else "tuple"
+                        new_data = _pack_number_seq(sub_data, kind, inner, 2, pending)
+                else:
+                    new_data = [_sub_pack(s, pending) for s in sub_data]
+            elif isinstance(first, np.ndarray):
+                new_data = [_sub_pack(s, pending) for s in sub_data]
+            if isinstance(new_data, list) and kind == "tuple":
+                new_data = tuple(new_data)
+
+    return new_data
+
+def _pack_command(data, pending):
+    #commands look like this: [func_name (str), args (list [arg1, arg2, argn]), kwargs (dict keyword1: arg1, kw2: arg2)  ]
+    # example
+    #                               [comp_name,     args,       dict]
+    # vsp.compvecpnt01(uv_array) -> ["compvepnt01", [uv_array], {}  ]
+    #
+    # A batch is ["BatchCall", [[command, command, ...]], {}]
+    new_data = [data[0], [], {}]
+    if data[0] == 'BatchCall':
+        new_data[1].append([_pack_command(cmd, pending) for cmd in data[1][0]])
+    else:
+        for value in data[1]:
+            new_data[1].append(_sub_pack(value, pending))
+    for key, value in data[2].items():
+        new_data[2][key] = _sub_pack(value, pending)
+    new_data[1] = tuple(new_data[1])
+    return new_data
+
+def pack_data(data, is_command_list=False, arena=None):
+    pending = []
     if is_command_list:
-        new_data = [data[0], [], {}]
+        new_data = _pack_command(data, pending)
+    else:
+       new_data = _sub_pack(data, pending)
+
+    if pending:
+        if arena is None:
+            arena = _default_arena
+        refs = arena.put([arr for d, arr in pending])
+        for (d, arr), (name, offset) in zip(pending, refs):
+            d["shm"] = name
+            d["offset"] = offset
+
+    b_data = pickle.dumps(new_data, protocol=pickle.HIGHEST_PROTOCOL)
+    return _HEADER.pack(len(b_data)) + b_data
+
+def _recv_exact(sock, nbytes):
+    buf = bytearray(nbytes)
+    view = memoryview(buf)
+    nread = 0
+    while nread < nbytes:
+        n = sock.recv_into(view[nread:], min(nbytes - nread, 1 << 20))
+        if n == 0:
+            return None
+        nread += n
+    return buf
+
+def recv_data(sock):
+    # Returns one whole message as a list of chunks, or [] if the connection closed
+    header = _recv_exact(sock, _HEADER.size)
+    if header is None:
+        return []
+    body = _recv_exact(sock, _HEADER.unpack(header)[0])
+    if body is None:
+        return []
+    return [body]
+
+def _unpack_array(sub_data, arena):
+    if "data" in sub_data:
+        arr = sub_data["data"]
+    else:
+        arr = arena.get(sub_data["shm"], sub_data["offset"], np.dtype(sub_data["dtype"]), sub_data["shape"])
+
+    kind = sub_data["kind"]
+    if kind == "ndarray":
+        return arr
+    if kind == "vec3d_list":
+        return [module.vec3d(x, y, z) for x, y, z in arr.tolist()]
+
+    seq = arr.tolist()
+    if sub_data["inner"] == "tuple":
+        seq = [tuple(s) for s in seq]
+    if kind == "tuple":
+        seq = tuple(seq)
+    return seq
+
+def _sub_unpack(sub_data, arena):
+    n_data = sub_data
+    if isinstance(sub_data, dict):
+        name = sub_data.get('name')
+        if name == 'vec3d':
+            n_data = module.vec3d(sub_data['x'], sub_data['y'], sub_data['z'])
+        elif name == 'array':
+            n_data = _unpack_array(sub_data, arena)
+        elif name == 'batch':
+            n_data = [_sub_unpack(r, arena) for r in sub_data['list']]
+    elif isinstance(sub_data, list) or isinstance(sub_data, tuple):
+        if len(sub_data) > 0 and isinstance(sub_data[0], (dict, list, tuple)):
+            n_data = [_sub_unpack(s, arena) for s in sub_data]
+            if isinstance(sub_data, tuple):
+                n_data = tuple(n_data)
+    return n_data
+
+def _unpack_command(data, arena):
+    new_data = [data[0], [], {}]
+    if data[0] == 'BatchCall':
+        new_data[1].append([_unpack_command(cmd, arena) for cmd in data[1][0]])
+    else:
         for value in data[1]:
-            new_data[1].append(sub_unpack(value))
-        for key, value in data[2].items():
-            new_data[2][key] = sub_unpack(value)
-        new_data[1] = tuple(new_data[1])
+            new_data[1].append(_sub_unpack(value, arena))
+    for key, value in data[2].items():
+        new_data[2][key] = _sub_unpack(value, arena)
+    new_data[1] = tuple(new_data[1])
+    return new_data
+
+def unpack_data(b_data, is_command_list=False, arena=None):
+    if arena is None:
+        arena = _default_arena
+
+    data = pickle.loads(b_data[0] if len(b_data) == 1 else b"".join(b_data))
+    if is_command_list:
+        new_data = _unpack_command(data, arena)
     else:
-       new_data = sub_unpack(data)
+       new_data = _sub_unpack(data, arena)
 
     return new_data
 
@@ -437,25 +670,19 @@ def start_server():
         s.listen()
         print(f"OpenVSP Server Socket Thread: Bound to {s.getsockname()}. Listening...", file=sys.stderr)
         conn, addr = s.accept()
+        arena = SharedArena()
         with conn:
             if openvsp_config.FACADE_PRINT_LEVEL > 0: print("OpenVSP Server Socket Thread: Connected by %s, %s"%(addr[0], addr[1]))
             while True:
                 b_data = []
                 data = []
                 # Wait for command
-                while True:
-                    try:
-                        packet = conn.recv(1024)
-                    except ConnectionResetError:
-                        if openvsp_config.FACADE_PRINT_LEVEL > 0: print("OpenVSP Socket ConnectionResetError")
-                        break
-                    if not packet: break
-                    b_data.append(packet)
-                    try:
-                        data = unpack_data(b_data, is_command_list=True)
-                        break
-                    except (pickle.UnpicklingError, EOFError):
-                        pass
+                try:
+                    b_data = recv_data(conn)
+                except ConnectionResetError:
+                    if openvsp_config.FACADE_PRINT_LEVEL > 0: print("OpenVSP Socket ConnectionResetError")
+                if b_data:
+                    data = unpack_data(b_data, is_command_list=True, arena=arena)
                 if b_data == [] or data == []:
                     if openvsp_config.FACADE_PRINT_LEVEL > 0: print("OpenVSP Server Socket Thread: Unable to receive data from socket, closing server.")
                     break
@@ -467,7 +694,7 @@ def start_server():
                     if openvsp_config.FACADE_PRINT_LEVEL > 1 and event.is_set():
                         print("OpenVSP Server Socket Thread: The OpenVSP GUI should already be running")
                     result = 0
-                    b_result = pack_data(result)
+                    b_result = pack_data(result, arena=arena)
                     event.set()
                     if module.IsGUIBuild():
                         while not module.IsEventLoopRunning():
@@ -485,12 +712,31 @@ def start_server():
                     if openvsp_config.FACADE_PRINT_LEVEL > 1:
                         print("OpenVSP Server Socket Thread: After StopGUI() called")
                     result = 0
-                    b_result = pack_data(result)
+                    b_result = pack_data(result, arena=arena)
 
                 # Special functionality for IsGUIRunning
                 elif data[0] == 'IsGUIRunning':
                     result = gui_active
-                    b_result = pack_data(result)
+                    b_result = pack_data(result, arena=arena)
+
+                # Batched calls, one round trip and one lock for the whole list
+                elif data[0] == 'BatchCall':
+                    results = []
+                    func_name = None
+                    try:
+                        if gui_active:
+                            module.Lock()
+                        try:
+                            for func_name, args, kwargs in data[1][0]:
+                                results.append(getattr(module, func_name)(*args, **kwargs))
+                        finally:
+                            if gui_active:
+                                module.Unlock()
+                        result = {"name": "batch", "list": results}
+                    except Exception as e:
+                        exc_info = sys.exc_info()
+                        result = ["error", "BatchCall stopped at call %d (%s)\n"%(len(results), func_name) + ''.join(traceback.format_exception(*exc_info))]
+                    b_result = pack_data(result, arena=arena)
 
                 # Regular functionality
                 else:
@@ -515,7 +761,7 @@ def start_server():
                     except Exception as e:
                         exc_info = sys.exc_info()
                         result = ["error", ''.join(traceback.format_exception(*exc_info))]
-                    b_result = pack_data(result)
+                    b_result = pack_data(result, arena=arena)
 
                 # Try to send response back
                 try:
@@ -525,6 +771,7 @@ def start_server():
                 except (ConnectionResetError, BrokenPipeError) as e:
                     if openvsp_config.FACADE_PRINT_LEVEL > 0: print("OpenVSP Server Socket Thread: Unable to send data to socket, closing server.")
                     break
+        arena.close()
 
     if openvsp_config.FACADE_PRINT_LEVEL > 0: print("OpenVSP Server Socket Thread: Server closing")
     global gui_wait
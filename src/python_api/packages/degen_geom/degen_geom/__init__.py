@@ -19,3 +19,4 @@
 # THE SOFTWARE.
 
 from .degen_geom import *
+from .degen_geom_bin import read_degen_geom_bin, read_degen_geom_bin_records
@@ -0,0 +1,176 @@
+# Copyright (c) 2018-2020 Uber Technologies, Inc.
+
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+"""Reads binary DegenGeom files (DEGEN_GEOM_BIN_TYPE) without copying the numeric data"""
+import mmap
+import types
+
+import numpy as np
+
+from .degen_geom import DegenGeom, DegenSurf, DegenPlate, DegenStick, DegenPoint, DegenDisk, DegenHinge
+
+_MAGIC = b'VSPDEGEN'
+_BYTE_ORDER_MARK = 0x01020304
+_DTYPES = {0: np.dtype(np.float64), 1: np.dtype(np.int32)}
+_TEXT = 2
+
+
+def _pad(n):
+    return (8 - n % 8) % 8
+
+
+def read_degen_geom_bin_records(filename):
+    """
+    Reads the raw records of a binary DegenGeom file
+    :param filename: file written with DEGEN_GEOM_BIN_TYPE
+    :return: list of (kind, fields) tuples, kind is 'COMP' or 'BLANK'.  Numeric fields are read-only
+             numpy views into the memory mapped file, text fields are str.  A partially written
+             trailing record is ignored, so a file that is still being written can be read.
+    """
+    with open(filename, 'rb') as f:
+        buf = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+
+    if buf[0:8] != _MAGIC:
+        raise ValueError('%s is not a binary DegenGeom file' % filename)
+
+    version, bom = np.frombuffer(buf, np.uint32, 2, 8)
+    if bom != _BYTE_ORDER_MARK:
+        raise ValueError('%s was written with a different byte order' % filename)
+
+    records = []
+    off = 16
+    while off + 24 <= len(buf):
+        kind = bytes(buf[off:off + 8]).rstrip(b'\0').decode()
+        nbytes = int(np.frombuffer(buf, np.uint64, 1, off + 8)[0])
+        nfield = int(np.frombuffer(buf, np.uint32, 1, off + 16)[0])
+
+        pos = off + 24
+        end = pos + nbytes
+        if end > len(buf):
+            break
+
+        fields = {}
+        for _ in range(nfield):
+            name_len, dtype, ndim, _unused = (int(v) for v in np.frombuffer(buf, np.uint32, 4, pos))
+            pos += 16
+            shape = tuple(int(s) for s in np.frombuffer(buf, np.uint64, ndim, pos))
+            pos += 8 * ndim
+            name = bytes(buf[pos:pos + name_len]).decode()
+            pos += name_len + _pad(name_len)
+
+            count = int(np.prod(shape)) if shape else 1
+            if dtype == _TEXT:
+                value = bytes(buf[pos:pos + count]).decode()
+                size = count
+            else:
+                dt = _DTYPES[dtype]
+                value = np.frombuffer(buf, dt, count, pos).reshape(shape)
+                size = count * dt.itemsize
+            pos += size + _pad(size)
+
+            fields[name] = value
+
+        records.append((kind, fields))
+        off = end
+
+    return records
+
+
+def _results(fields, prefix=''):
+    """Results-like object for the fields under prefix, scalars become length one sequences"""
+    res = types.SimpleNamespace()
+    for key, value in fields.items():
+        if not key.startswith(prefix):
+            continue
+        name = key[len(prefix):]
+        if '.' in name:
+            continue
+        if isinstance(value, str):
+            value = [value]
+        elif value.ndim == 0:
+            value = value.reshape(1)
+        setattr(res, name, value)
+    return res
+
+
+def _split_xyz(res, name, names):
+    value = getattr(res, name)
+    for i, n in enumerate(names):
+        setattr(res, n, value[..., i])
+
+
+def read_degen_geom_bin(filename):
+    """
+    Reads a binary DegenGeom file into DegenGeom objects
+    :param filename: file written with DEGEN_GEOM_BIN_TYPE
+    :return: (list of DegenGeom, list of blank geom point masses with name, geom_id, mass and X)
+    """
+    degen_objs = []
+    blanks = []
+
+    for kind, fields in read_degen_geom_bin_records(filename):
+        if kind == 'BLANK':
+            blank = _results(fields)
+            blank.X = blank.X[0]
+            blanks.append(blank)
+            continue
+
+        res = _results(fields)
+        degen_obj = DegenGeom(res)
+
+        if 'surf.x' in fields:
+            surf = _results(fields, 'surf.')
+            surf.nxsecs = res.nxsecs
+            surf.num_pnts = res.num_pnts
+            _split_xyz(surf, 'x', ('x', 'y', 'z'))
+            _split_xyz(surf, 'n', ('nx', 'ny', 'nz'))
+            degen_obj.surf = DegenSurf(surf)
+
+        i = 0
+        while 'plate%d.x' % i in fields:
+            plate = _results(fields, 'plate%d.' % i)
+            plate.nxsecs = res.nxsecs
+            plate.num_pnts = res.num_pnts
+            _split_xyz(plate, 'x', ('x', 'y', 'z'))
+            _split_xyz(plate, 'nCamber', ('nCamber_x', 'nCamber_y', 'nCamber_z'))
+            degen_obj.plates.append(DegenPlate(plate))
+            i += 1
+
+        i = 0
+        while 'stick%d.le' % i in fields:
+            stick = _results(fields, 'stick%d.' % i)
+            stick.nxsecs = res.nxsecs
+            degen_obj.sticks.append(DegenStick(stick))
+            i += 1
+
+        i = 0
+        while 'hinge%d.name' % i in fields:
+            degen_obj.hinge_lines.append(DegenHinge(_results(fields, 'hinge%d.' % i)))
+            i += 1
+
+        if 'point.vol' in fields:
+            degen_obj.point = DegenPoint(_results(fields, 'point.'))
+
+        if 'disk.diameter' in fields:
+            degen_obj.disk = DegenDisk(_results(fields, 'disk.'))
+
+        degen_objs.append(degen_obj)
+
+    return degen_objs, blanks
@@ -166,6 +166,42 @@ class TestOpenVSP(TestCase):
 
         self.assertTrue(True)
 
+    def test_degen_geom_bin(self):
+        import degen_geom as dg
+        vsp.VSPRenew()
+        vsp.ClearVSPModel()
+        vsp.AddGeom("WING")
+        vsp.AddGeom("POD")
+        blank_id = vsp.AddGeom("BLANK")
+        vsp.SetParmVal(blank_id, "Point_Mass_Flag", "Mass", 1)
+        vsp.SetParmVal(blank_id, "Point_Mass", "Mass", 5.0)
+
+        vsp.Update()
+
+        fname = os.path.join(self.OUTPUT_FOLDER, "degen_geom.bin")
+        vsp.SetComputationFileName(vsp.DEGEN_GEOM_BIN_TYPE, fname)
+
+        vsp.SetAnalysisInputDefaults("DegenGeom")
+        vsp.SetIntAnalysisInput("DegenGeom", "WriteCSVFlag", [0], 0)
+        vsp.SetIntAnalysisInput("DegenGeom", "WriteMFileFlag", [0], 0)
+        vsp.SetIntAnalysisInput("DegenGeom", "WriteBinFileFlag", [1], 0)
+
+        degen_results_id = vsp.ExecAnalysis("DegenGeom")
+        res_objs = vsp.parse_degen_geom(degen_results_id)
+        bin_objs, blanks = dg.read_degen_geom_bin(fname)
+
+        self.assertEqual(len(res_objs), len(bin_objs))
+        self.assertEqual(len(blanks), 1)
+        self.assertAlmostEqual(blanks[0].mass[0], 5.0)
+
+        for res_obj, bin_obj in zip(res_objs, bin_objs):
+            self.assertEqual(res_obj.name, bin_obj.name)
+            self.assertEqual(len(res_obj.sticks), len(bin_obj.sticks))
+            npt.assert_allclose(res_obj.surf.x, bin_obj.surf.x)
+            npt.assert_allclose(res_obj.surf.area, bin_obj.surf.area)
+            npt.assert_allclose(res_obj.sticks[0].chord, bin_obj.sticks[0].chord)
+            self.assertAlmostEqual(res_obj.point.vol, bin_obj.point.vol)
+
     def test_parasite_drag(self):
         import numpy as np
         vsp.VSPRenew()
@@ -8,6 +8,9 @@ FACADE_PORT = -1
 FACADE_SERVER_TIMEOUT = .1
 FACADE_SERVER_ATTEMPTS = 10
 FACADE_PRINT_LEVEL = 1
+# Arrays of at least this many bytes are passed to and from the facade server through shared memory.
+# A negative value sends everything through the socket.
+FACADE_SHM_MIN_BYTES = 65536
 
 # Control whether facade remote access client version is loaded.  Default to False.
 LOAD_FACADE = False
@@ -0,0 +1,59 @@
+import os
+import openvsp_config
+
+openvsp_config.LOAD_GRAPHICS = True
+openvsp_config.LOAD_FACADE = True
+import openvsp as vsp
+
+
+def test_ScreenGrabViews():
+    vsp.StartGUI()
+
+    errorMgr = vsp.ErrorMgrSingleton.getInstance()
+
+    pod = vsp.AddGeom('POD', '')
+    vsp.SetGeomDrawType(pod, vsp.GEOM_DRAW_SHADE)
+
+    wing = vsp.AddGeom('WING', '')
+    vsp.SetGeomDrawType(wing, vsp.GEOM_DRAW_SHADE)
+
+    vsp.Update()
+    vsp.FitAllViews()
+
+    fname_vec = []
+    rot_vec = []
+    zoom_vec = []
+    pan_vec = []
+    cor_vec = []
+    for i in range(0, 8):
+        fname_vec.append('turntable_' + str(i) + '.png')
+        rot_vec.append(vsp.vec3d(0.0, 0.0, 45.0 * i))
+        zoom_vec.append(0.018 * (1.0 + 0.1 * i))
+        pan_vec.append(vsp.vec3d(0.1 * i, 0.0, 0.0))
+        cor_vec.append(vsp.vec3d(1.0, 0.0, 0.0))
+
+    vsp.ScreenGrabViews(fname_vec, rot_vec, zoom_vec, pan_vec, cor_vec, 400, 400, True)
+
+    # Check for errors
+    num_err = errorMgr.GetNumTotalErrors()
+    assert num_err == 0
+
+    for fname in fname_vec:
+        assert os.path.exists(fname)
+
+    # Empty per pose vectors keep the current view
+    vsp.ScreenGrabViews(fname_vec[0:2], rot_vec[0:2], [], [], [], 400, 400, True)
+    assert errorMgr.GetNumTotalErrors() == 0
+
+    # Mismatched pose count is rejected
+    vsp.ScreenGrabViews(fname_vec, rot_vec[0:2], [], [], [], 400, 400, True)
+    assert errorMgr.GetNumTotalErrors() == 1
+    errorMgr.PopLastError()
+
+    vsp.ScreenGrabViews(fname_vec, rot_vec, zoom_vec, pan_vec[0:2], [], 400, 400, True)
+    assert errorMgr.GetNumTotalErrors() == 1
+    errorMgr.PopLastError()
+
+
+if __name__ == '__main__':
+    test_ScreenGrabViews()
@@ -31,12 +31,13 @@ double Cubic_Stretch( const double &t, const double &ds0, const double &ds1 )
 //
 double HypTan_Stretch( const double &t, const double &ds0, const double &ds1 )
 {
-    static double d0 = -1;
-    static double d1 = -1;
-    static double a = -1;
-    static double b = -1;
-    static double hdelta = -1;
-    static double tnh2 = -1;
+    // Coefficients of the last ds0, ds1 pair.  Per thread, callers run in parallel.
+    thread_local double d0 = -1;
+    thread_local double d1 = -1;
+    thread_local double a = -1;
+    thread_local double b = -1;
+    thread_local double hdelta = -1;
+    thread_local double tnh2 = -1;
 
     if ( d0 != ds0 || d1 != ds1 )
     {
@@ -120,15 +121,6 @@ double asinhc_approx( const double &y )
 //
 double asinhc( const double &y )
 {
-    static double lasty = -1.0; // Negative argument impossible
-    static double lastx = 0;
-
-    if ( y == lasty )
-    {
-        return lastx;
-    }
-    lasty = y;
-
     // Initialize with series expansion initial guess.
     double x = asinhc_approx( y );
 
@@ -153,7 +145,6 @@ double asinhc( const double &y )
         {
             // x fell below xmin
             x = 0.0;
-            lastx = x;
             return x;
         }
 
@@ -161,7 +152,6 @@ double asinhc( const double &y )
         if ( std::abs( f ) < tol )
         {
             // Converged
-            lastx = x;
             return x;
         }
 
@@ -169,7 +159,6 @@ double asinhc( const double &y )
     }
 
     // Exceeded max iterations.
-    lastx = x;
     return x;
 }
 
@@ -207,15 +196,6 @@ double asinc_approx( const double &y )
 //
 double asinc( const double &y )
 {
-    static double lasty = -1.0; // Negative argument impossible
-    static double lastx = 0;
-
-    if ( y == lasty )
-    {
-        return lastx;
-    }
-    lasty = y;
-
     // Initialize with series expansion initial guess.
     double x = asinc_approx( y );
 
@@ -240,14 +220,12 @@ double asinc( const double &y )
         {
             // x fell below xmin
             x = 0.0;
-            lastx = x;
             return x;
         }
 
         if ( std::abs( f ) < tol )
         {
             // Converged
-            lastx = x;
             return x;
         }
 
@@ -255,6 +233,5 @@ double asinc( const double &y )
     }
 
     // Exceeded max iterations
-    lastx = x;
     return x;
 }
@@ -15,6 +15,13 @@
 #include "Matrix4d.h"
 #include "APIDefines.h"
 
+#include <map>
+#include <utility>
+
+using std::map;
+using std::pair;
+using std::make_pair;
+
 void MakePlane( DrawObj &dobj )
 {
     double w = 0.5;
@@ -230,6 +237,10 @@ DrawObj::DrawObj()
 
     m_GeomChanged = true;
 
+    m_MeshPacked = false;
+    m_ElemChanged = true;
+    m_BndRadius = 0;
+
     m_FlipNormals = false;
 
     m_Type = DrawObj::VSP_POINTS;
@@ -276,6 +287,191 @@ DrawObj::~DrawObj()
 {
 }
 
+//==== Indices Kept At A Level Of Detail, Every stride'th Plus The Last ====//
+static void LODStations( int n, int stride, vector< int > &sta )
+{
+    sta.clear();
+    for ( int i = 0; i < n - 1; i += stride )
+    {
+        sta.push_back( i );
+    }
+    if ( n > 0 )
+    {
+        sta.push_back( n - 1 );
+    }
+}
+
+void DrawObj::BeginMeshBuffers()
+{
+    m_MeshPacked = true;
+
+    // clear() keeps capacity, so repacking the same size mesh does not reallocate.
+    m_VertBuf.clear();
+
+    m_PrevMeshDims.swap( m_MeshDims );
+    m_MeshDims.clear();
+
+    m_PackMin = vec3d( 1e12, 1e12, 1e12 );
+    m_PackMax = vec3d( -1e12, -1e12, -1e12 );
+}
+
+void DrawObj::AppendMeshBuffers( const vector< vector< vector< vec3d > > > & pnts,
+                                 const vector< vector< vector< vec3d > > > & norms,
+                                 const vector< vector< vector< double > > > & utex,
+                                 const vector< vector< vector< double > > > & vtex )
+{
+    int num_mesh = pnts.size();
+
+    if ( ( int )norms.size() != num_mesh || ( int )utex.size() != num_mesh || ( int )vtex.size() != num_mesh )
+    {
+        return;
+    }
+
+    size_t start = m_VertBuf.size();
+    size_t vtotal = start;
+    for ( int k = 0; k < num_mesh; k++ )
+    {
+        int num_pnts = pnts[k].size();
+        int num_xsecs = 0;
+        if ( num_pnts )
+        {
+            num_xsecs = pnts[k][0].size();
+        }
+
+        vtotal += 8 * num_pnts * num_xsecs;
+    }
+    m_VertBuf.resize( vtotal );
+
+    vector< int > ista, jsta;
+
+    float *vk = m_VertBuf.data() + start;
+    for ( int k = 0; k < num_mesh; k++ )
+    {
+        int num_pnts = pnts[k].size();
+        int num_xsecs = 0;
+        if ( num_pnts )
+        {
+            num_xsecs = pnts[k][0].size();
+        }
+
+        for ( int i = 0 ; i < num_pnts ; i++ )
+        {
+            for ( int j = 0 ; j < num_xsecs ; j++ )
+            {
+                const vec3d &p = pnts[k][i][j];
+                const vec3d &n = norms[k][i][j];
+
+                vk[0] = ( float )p.x();
+                vk[1] = ( float )p.y();
+                vk[2] = ( float )p.z();
+
+                vk[3] = ( float )n.x();
+                vk[4] = ( float )n.y();
+                vk[5] = ( float )n.z();
+
+                vk[6] = ( float )utex[k][i][j];
+                vk[7] = ( float )vtex[k][i][j];
+                vk += 8;
+            }
+        }
+
+        m_MeshDims.push_back( num_pnts );
+        m_MeshDims.push_back( num_xsecs );
+
+        // Bounds only choose a level of detail, so the coarsest level's points are enough.
+        LODStations( num_pnts, 1 << ( NUM_MESH_LOD - 1 ), ista );
+        LODStations( num_xsecs, 1 << ( NUM_MESH_LOD - 1 ), jsta );
+        for ( int i = 0; i < ( int )ista.size(); i++ )
+        {
+            for ( int j = 0; j < ( int )jsta.size(); j++ )
+            {
+                const vec3d &p = pnts[k][ista[i]][jsta[j]];
+                m_PackMin.set_xyz( std::min( m_PackMin.x(), p.x() ), std::min( m_PackMin.y(), p.y() ), std::min( m_PackMin.z(), p.z() ) );
+                m_PackMax.set_xyz( std::max( m_PackMax.x(), p.x() ), std::max( m_PackMax.y(), p.y() ), std::max( m_PackMax.z(), p.z() ) );
+            }
+        }
+    }
+}
+
+//==== Quad Elements Over Every stride'th Point And Cross Section Of Packed Meshes ====//
+// Meshes of the same size (symmetric copies, repeated patches) share one index pattern.
+static void BuildQuadElems( const vector< int > &dims, int stride, vector< unsigned int > &elems )
+{
+    elems.clear();
+
+    map< pair< int, int >, vector< unsigned int > > patterns;
+    vector< int > ista, jsta;
+
+    unsigned int offset = 0;
+    for ( int k = 0; k < ( int )dims.size(); k += 2 )
+    {
+        int num_pnts = dims[k];
+        int num_xsecs = dims[k + 1];
+
+        vector< unsigned int > &pat = patterns[ make_pair( num_pnts, num_xsecs ) ];
+        if ( pat.empty() )
+        {
+            LODStations( num_pnts, stride, ista );
+            LODStations( num_xsecs, stride, jsta );
+
+            for ( int i = 0; i < ( int )ista.size() - 1; i++ )
+            {
+                for ( int j = 0; j < ( int )jsta.size() - 1; j++ )
+                {
+                    pat.push_back( ista[i] * num_xsecs + jsta[j] );
+                    pat.push_back( ista[i + 1] * num_xsecs + jsta[j] );
+                    pat.push_back( ista[i + 1] * num_xsecs + jsta[j + 1] );
+                    pat.push_back( ista[i] * num_xsecs + jsta[j + 1] );
+                }
+            }
+        }
+
+        for ( int e = 0; e < ( int )pat.size(); e++ )
+        {
+            elems.push_back( offset + pat[e] );
+        }
+
+        offset += num_pnts * num_xsecs;
+    }
+}
+
+void DrawObj::EndMeshBuffers()
+{
+    // Bounds follow the vertices, which move on every pack.
+    if ( m_VertBuf.empty() )
+    {
+        m_BndCenter = vec3d( 0, 0, 0 );
+        m_BndRadius = 0;
+    }
+    else
+    {
+        m_BndCenter = ( m_PackMin + m_PackMax ) * 0.5;
+        m_BndRadius = dist( m_PackMin, m_PackMax ) * 0.5;
+    }
+
+    if ( m_MeshDims == m_PrevMeshDims )
+    {
+        return;
+    }
+
+    BuildQuadElems( m_MeshDims, 1, m_ElemBuf );
+
+    m_LODElemBuf.resize( NUM_MESH_LOD - 1 );
+    for ( int lod = 1; lod < NUM_MESH_LOD; lod++ )
+    {
+        vector< unsigned int > &elems = m_LODElemBuf[lod - 1];
+        BuildQuadElems( m_MeshDims, 1 << lod, elems );
+
+        const vector< unsigned int > &finer = ( lod == 1 ) ? m_ElemBuf : m_LODElemBuf[lod - 2];
+        if ( elems.size() >= finer.size() )
+        {
+            elems.clear();
+        }
+    }
+
+    m_ElemChanged = true;
+}
+
 vec3d DrawObj::ColorWheel( double angle )
 {
     // Returns rgb for an angle in degrees on color wheel
@@ -79,6 +79,26 @@ public:
     static vec3d Color( int color );
     static int reasonColorMap( int reason );
 
+    /*
+    * Pack tessellated surfaces directly into GPU-ready buffers.
+    * BeginMeshBuffers() starts a new pack and keeps buffer capacity, AppendMeshBuffers()
+    * adds surfaces stored as m_PntMesh is, and EndMeshBuffers() builds the element
+    * buffer.  Elements are only rebuilt when the mesh dimensions change.
+    *
+    * EndMeshBuffers() also builds coarser levels of detail into m_LODElemBuf.
+    * Each level indexes every 2^level'th point and cross section of the same
+    * vertices, always keeping the first and last, so surface edges still meet.
+    * Index patterns are only shared between meshes of the same size within one
+    * DrawObj, not across DrawObjs.  Levels are only used for shaded quads;
+    * wireframe always draws m_ElemBuf.
+    */
+    void BeginMeshBuffers();
+    void AppendMeshBuffers( const vector< vector< vector< vec3d > > > & pnts,
+                            const vector< vector< vector< vec3d > > > & norms,
+                            const vector< vector< vector< double > > > & utex,
+                            const vector< vector< vector< double > > > & vtex );
+    void EndMeshBuffers();
+
     // Colors match https://www.rapidtables.com/web/color/RGB_Color.html
     enum COLOR
     {
@@ -632,6 +652,30 @@ public:
     vector< vector< vector< double > > > m_uTexMesh;
     vector< vector< vector< double > > > m_vTexMesh;
 
+    /*
+    * Packed mesh data.
+    * m_MeshPacked is true when m_VertBuf and m_ElemBuf replace m_PntMesh for drawing.
+    * m_VertBuf holds x, y, z, nx, ny, nz, u, v per vertex, the interleaved
+    * layout of the graphics vertex buffer.  m_ElemBuf holds four indices per quad.
+    *
+    * Element changed flag.  Like m_GeomChanged, but only set when m_ElemBuf
+    * differs from the last pack.
+    */
+    bool m_MeshPacked;
+    bool m_ElemChanged;
+    vector< float > m_VertBuf;
+    vector< unsigned int > m_ElemBuf;
+
+    /*
+    * Coarse level of detail element buffers, m_LODElemBuf[0] is level 1.
+    * Levels that would not drop any quads are left empty.  m_BndCenter and
+    * m_BndRadius bound m_VertBuf to choose a level by projected size.
+    */
+    enum { NUM_MESH_LOD = 3 };
+    vector< vector< unsigned int > > m_LODElemBuf;
+    vec3d m_BndCenter;
+    double m_BndRadius;
+
     vector< vec3d > m_WireColorVec;
     vector< float > m_WireAlphaVec;
 
@@ -660,6 +704,14 @@ public:
 
 protected:
 
+    // Points and cross sections of each packed mesh, for this and the previous pack.
+    vector< int > m_MeshDims;
+    vector< int > m_PrevMeshDims;
+
+    // Bounds of the vertices packed so far.
+    vec3d m_PackMin;
+    vec3d m_PackMax;
+
 };
 
 void MakePlane( DrawObj &dobj );
@@ -20,6 +20,9 @@
 #include <unistd.h>
 #include <libgen.h>
 #include <pwd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #endif
 
 #ifdef __FreeBSD__
@@ -526,3 +529,122 @@ void remove_files( const std::vector< fs::path > &file_list )
         }
     }
 }
+
+//==== Constructor ====//
+MappedFile::MappedFile()
+{
+    m_Data = nullptr;
+    m_Size = 0;
+#ifdef WIN32
+    m_FileHandle = INVALID_HANDLE_VALUE;
+    m_MapHandle = nullptr;
+#else
+    m_FileDesc = -1;
+#endif
+}
+
+//==== Destructor ====//
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+//==== Map Whole File Read Only ====//
+bool MappedFile::Open( const string & file_name )
+{
+    Close();
+
+#ifdef WIN32
+    m_FileHandle = CreateFileA( file_name.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+    if ( m_FileHandle == INVALID_HANDLE_VALUE )
+    {
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if ( !GetFileSizeEx( m_FileHandle, &size ) )
+    {
+        Close();
+        return false;
+    }
+    m_Size = ( size_t )size.QuadPart;
+
+    if ( m_Size > 0 )
+    {
+        m_MapHandle = CreateFileMappingA( m_FileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr );
+        if ( m_MapHandle == nullptr )
+        {
+            Close();
+            return false;
+        }
+
+        m_Data = ( const unsigned char * )MapViewOfFile( m_MapHandle, FILE_MAP_READ, 0, 0, 0 );
+        if ( m_Data == nullptr )
+        {
+            Close();
+            return false;
+        }
+    }
+#else
+    m_FileDesc = open( file_name.c_str(), O_RDONLY );
+    if ( m_FileDesc < 0 )
+    {
+        return false;
+    }
+
+    struct stat st;
+    if ( fstat( m_FileDesc, &st ) != 0 )
+    {
+        Close();
+        return false;
+    }
+    m_Size = ( size_t )st.st_size;
+
+    if ( m_Size > 0 )
+    {
+        void* data = mmap( nullptr, m_Size, PROT_READ, MAP_PRIVATE, m_FileDesc, 0 );
+        if ( data == MAP_FAILED )
+        {
+            Close();
+            return false;
+        }
+        m_Data = ( const unsigned char * )data;
+    }
+#endif
+
+    return true;
+}
+
+//==== Unmap And Close ====//
+void MappedFile::Close()
+{
+#ifdef WIN32
+    if ( m_Data )
+    {
+        UnmapViewOfFile( m_Data );
+    }
+    if ( m_MapHandle )
+    {
+        CloseHandle( m_MapHandle );
+    }
+    if ( m_FileHandle != INVALID_HANDLE_VALUE )
+    {
+        CloseHandle( m_FileHandle );
+    }
+    m_FileHandle = INVALID_HANDLE_VALUE;
+    m_MapHandle = nullptr;
+#else
+    if ( m_Data )
+    {
+        munmap( ( void* )m_Data, m_Size );
+    }
+    if ( m_FileDesc >= 0 )
+    {
+        close( m_FileDesc );
+    }
+    m_FileDesc = -1;
+#endif
+
+    m_Data = nullptr;
+    m_Size = 0;
+}
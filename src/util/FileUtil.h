@@ -38,6 +38,36 @@ std::vector< fs::path > get_files_matching_pattern( const fs::path& directory, c
 
 void remove_files( const std::vector< fs::path > &file_list );
 
+//==== Read Only Memory-Mapped File ====//
+class MappedFile
+{
+public:
+
+    MappedFile();
+    ~MappedFile();
+
+    bool Open( const string & file_name );
+    void Close();
+
+    const unsigned char * GetData() const       { return m_Data; }
+    size_t GetSize() const                      { return m_Size; }
+
+private:
+
+    MappedFile( const MappedFile & );
+    MappedFile & operator=( const MappedFile & );
+
+    const unsigned char * m_Data;
+    size_t m_Size;
+
+#ifdef WIN32
+    void* m_FileHandle;
+    void* m_MapHandle;
+#else
+    int m_FileDesc;
+#endif
+};
+
 
 #endif
 
@@ -0,0 +1,73 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+#if !defined(VSPPARALLELUTIL__INCLUDED_)
+#define VSPPARALLELUTIL__INCLUDED_
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+//==== Number Of Worker Threads To Use For n Items, At Least min_chunk Items Each ====//
+inline int ParallelThreadCount( int n, int min_chunk )
+{
+    int nthread = ( int ) std::thread::hardware_concurrency();
+    if ( nthread < 1 )
+    {
+        nthread = 1;
+    }
+
+    if ( min_chunk < 1 )
+    {
+        min_chunk = 1;
+    }
+
+    return std::max( 1, std::min( nthread, n / min_chunk ) );
+}
+
+//==== Split [0,n) Into Contiguous Ranges And Call func( begin, end ) For Each On Its Own Thread ====//
+// func must only read shared state and write to its own range of outputs.  Small
+// inputs are run serially on the calling thread.
+template < typename F >
+void ParallelFor( int n, int min_chunk, F func )
+{
+    if ( n <= 0 )
+    {
+        return;
+    }
+
+    int nthread = ParallelThreadCount( n, min_chunk );
+
+    if ( nthread == 1 )
+    {
+        func( 0, n );
+        return;
+    }
+
+    std::vector < std::thread > threads;
+    threads.reserve( nthread - 1 );
+
+    int chunk = ( n + nthread - 1 ) / nthread;
+
+    for ( int t = 1; t < nthread; t++ )
+    {
+        int begin = t * chunk;
+        int end = std::min( n, begin + chunk );
+        if ( begin < end )
+        {
+            threads.emplace_back( func, begin, end );
+        }
+    }
+
+    // Calling thread takes the first range.
+    func( 0, std::min( n, chunk ) );
+
+    for ( int t = 0; t < ( int ) threads.size(); t++ )
+    {
+        threads[t].join();
+    }
+}
+
+#endif
@@ -0,0 +1,578 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// PickBVH.cpp: CPU picking over display tessellations.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "PickBVH.h"
+#include "DrawObj.h"
+#include "BndBox.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+// Items per BVH leaf.
+#define PICK_BVH_LEAF 8
+
+PickHit::PickHit()
+{
+    m_Obj = -1;
+    m_Index = -1;
+    m_T = 0;
+}
+
+PickBVH::PickBVH( int type )
+{
+    m_Type = type;
+}
+
+//==== Vertices In Graphics Vertex Buffer Order ====//
+void PickBVH::LoadPnts( const DrawObj* obj, vector < vec3d > &pnts ) const
+{
+    if ( obj->m_MeshPacked )
+    {
+        int nvert = obj->m_VertBuf.size() / 8;
+        for ( int i = 0 ; i < nvert ; i++ )
+        {
+            const float *vk = obj->m_VertBuf.data() + 8 * i;
+            pnts.push_back( vec3d( vk[0], vk[1], vk[2] ) );
+        }
+    }
+    else if ( !obj->m_PntMesh.empty() )
+    {
+        for ( int k = 0 ; k < ( int )obj->m_PntMesh.size() ; k++ )
+        {
+            for ( int i = 0 ; i < ( int )obj->m_PntMesh[k].size() ; i++ )
+            {
+                pnts.insert( pnts.end(), obj->m_PntMesh[k][i].begin(), obj->m_PntMesh[k][i].end() );
+            }
+        }
+    }
+    else
+    {
+        pnts.insert( pnts.end(), obj->m_PntVec.begin(), obj->m_PntVec.end() );
+    }
+}
+
+//==== Quads Of Mesh DrawObjs, As Drawn From The Element Buffer ====//
+void PickBVH::LoadQuads( const DrawObj* obj, int vstart, vector < int > &quads ) const
+{
+    if ( obj->m_MeshPacked )
+    {
+        for ( int e = 0 ; e < ( int )obj->m_ElemBuf.size() ; e++ )
+        {
+            quads.push_back( vstart + obj->m_ElemBuf[e] );
+        }
+    }
+    else
+    {
+        int offset = vstart;
+        for ( int k = 0 ; k < ( int )obj->m_PntMesh.size() ; k++ )
+        {
+            int num_pnts = obj->m_PntMesh[k].size();
+            int num_xsecs = 0;
+            if ( num_pnts )
+            {
+                num_xsecs = obj->m_PntMesh[k][0].size();
+            }
+
+            for ( int i = 0 ; i < num_pnts - 1 ; i++ )
+            {
+                for ( int j = 0 ; j < num_xsecs - 1 ; j++ )
+                {
+                    quads.push_back( offset + i * num_xsecs + j );
+                    quads.push_back( offset + ( i + 1 ) * num_xsecs + j );
+                    quads.push_back( offset + ( i + 1 ) * num_xsecs + j + 1 );
+                    quads.push_back( offset + i * num_xsecs + j + 1 );
+                }
+            }
+            offset += num_pnts * num_xsecs;
+        }
+    }
+}
+
+bool PickBVH::Update( const vector < DrawObj* > &objs )
+{
+    vector < string > ids( objs.size() );
+    vector < int > npnts( objs.size() );
+    vector < int > nitems( objs.size() );
+    vector < int > pstart( objs.size() );
+
+    vector < vec3d > pnts;
+    vector < int > quads;
+
+    for ( int i = 0 ; i < ( int )objs.size() ; i++ )
+    {
+        ids[i] = objs[i]->m_GeomID;
+        pstart[i] = pnts.size();
+
+        LoadPnts( objs[i], pnts );
+        npnts[i] = pnts.size() - pstart[i];
+
+        if ( m_Type == PICK_SURF )
+        {
+            int qstart = quads.size();
+            LoadQuads( objs[i], pstart[i], quads );
+            nitems[i] = ( quads.size() - qstart ) / 4;
+        }
+        else
+        {
+            nitems[i] = npnts[i];
+        }
+    }
+
+    m_Pnts.swap( pnts );
+
+    // Same objects and connectivity, only the vertices moved.
+    if ( !m_Nodes.empty() && ids == m_ObjID && npnts == m_ObjNumPnts && nitems == m_ObjNumItems && quads == m_Quads )
+    {
+        Refit();
+        return false;
+    }
+
+    m_ObjID.swap( ids );
+    m_ObjNumPnts.swap( npnts );
+    m_ObjNumItems.swap( nitems );
+    m_ObjPntStart.swap( pstart );
+    m_Quads.swap( quads );
+
+    m_ItemObj.clear();
+    m_ItemIndex.clear();
+    for ( int i = 0 ; i < ( int )m_ObjID.size() ; i++ )
+    {
+        for ( int j = 0 ; j < m_ObjNumItems[i] ; j++ )
+        {
+            m_ItemObj.push_back( i );
+            m_ItemIndex.push_back( j );
+        }
+    }
+
+    int nitem = m_ItemObj.size();
+    m_ItemOrder.resize( nitem );
+    for ( int i = 0 ; i < nitem ; i++ )
+    {
+        m_ItemOrder[i] = i;
+    }
+
+    // Item box centers drive the splits.
+    vector < vec3d > cen( nitem );
+    double bmin[3], bmax[3];
+    for ( int i = 0 ; i < nitem ; i++ )
+    {
+        ItemBox( i, bmin, bmax );
+        cen[i] = vec3d( bmin[0] + bmax[0], bmin[1] + bmax[1], bmin[2] + bmax[2] ) * 0.5;
+    }
+    m_ItemCen.swap( cen );
+
+    m_Nodes.clear();
+    if ( nitem > 0 )
+    {
+        m_Nodes.reserve( 2 * ( nitem / PICK_BVH_LEAF + 1 ) );
+        BuildNode( 0, nitem );
+    }
+    m_ItemCen.clear();
+    return true;
+}
+
+void PickBVH::ItemBox( int item, double bmin[3], double bmax[3] ) const
+{
+    if ( m_Type == PICK_SURF )
+    {
+        const vec3d &p0 = m_Pnts[ m_Quads[4 * item] ];
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            bmin[k] = bmax[k] = p0[k];
+        }
+        for ( int v = 1 ; v < 4 ; v++ )
+        {
+            const vec3d &p = m_Pnts[ m_Quads[4 * item + v] ];
+            for ( int k = 0 ; k < 3 ; k++ )
+            {
+                bmin[k] = std::min( bmin[k], p[k] );
+                bmax[k] = std::max( bmax[k], p[k] );
+            }
+        }
+    }
+    else
+    {
+        const vec3d &p = m_Pnts[ m_ObjPntStart[ m_ItemObj[item] ] + m_ItemIndex[item] ];
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            bmin[k] = bmax[k] = p[k];
+        }
+    }
+}
+
+int PickBVH::BuildNode( int start, int count )
+{
+    int inode = m_Nodes.size();
+    m_Nodes.push_back( BVHNode() );
+
+    BVHNode node;
+    node.m_Left = -1;
+    node.m_Right = -1;
+    node.m_Start = start;
+    node.m_Count = count;
+
+    for ( int k = 0 ; k < 3 ; k++ )
+    {
+        node.m_Min[k] = DBL_MAX;
+        node.m_Max[k] = -DBL_MAX;
+    }
+
+    if ( count > PICK_BVH_LEAF )
+    {
+        BndBox cbox;
+        for ( int i = start ; i < start + count ; i++ )
+        {
+            cbox.Update( m_ItemCen[ m_ItemOrder[i] ] );
+        }
+
+        int axis = 0;
+        for ( int k = 1 ; k < 3 ; k++ )
+        {
+            if ( cbox.GetMax( k ) - cbox.GetMin( k ) > cbox.GetMax( axis ) - cbox.GetMin( axis ) )
+            {
+                axis = k;
+            }
+        }
+
+        int half = count / 2;
+        std::nth_element( m_ItemOrder.begin() + start, m_ItemOrder.begin() + start + half, m_ItemOrder.begin() + start + count, [&]( int a, int b )
+        {
+            return m_ItemCen[a][axis] < m_ItemCen[b][axis];
+        } );
+
+        node.m_Left = BuildNode( start, half );
+        node.m_Right = BuildNode( start + half, count - half );
+        node.m_Count = 0;
+
+        // Box from the children, items are only visited at the leaves.
+        const BVHNode &left = m_Nodes[ node.m_Left ];
+        const BVHNode &right = m_Nodes[ node.m_Right ];
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            node.m_Min[k] = std::min( left.m_Min[k], right.m_Min[k] );
+            node.m_Max[k] = std::max( left.m_Max[k], right.m_Max[k] );
+        }
+    }
+    else
+    {
+        double bmin[3], bmax[3];
+        for ( int i = start ; i < start + count ; i++ )
+        {
+            ItemBox( m_ItemOrder[i], bmin, bmax );
+            for ( int k = 0 ; k < 3 ; k++ )
+            {
+                node.m_Min[k] = std::min( node.m_Min[k], bmin[k] );
+                node.m_Max[k] = std::max( node.m_Max[k], bmax[k] );
+            }
+        }
+    }
+
+    m_Nodes[inode] = node;
+    return inode;
+}
+
+//==== Recompute Node Boxes Bottom Up Keeping The Tree Structure ====//
+void PickBVH::Refit()
+{
+    // Children are always stored after their parent.
+    double bmin[3], bmax[3];
+    for ( int n = ( int )m_Nodes.size() - 1 ; n >= 0 ; n-- )
+    {
+        BVHNode &node = m_Nodes[n];
+
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            node.m_Min[k] = DBL_MAX;
+            node.m_Max[k] = -DBL_MAX;
+        }
+
+        if ( node.m_Left < 0 )
+        {
+            for ( int i = node.m_Start ; i < node.m_Start + node.m_Count ; i++ )
+            {
+                ItemBox( m_ItemOrder[i], bmin, bmax );
+                for ( int k = 0 ; k < 3 ; k++ )
+                {
+                    node.m_Min[k] = std::min( node.m_Min[k], bmin[k] );
+                    node.m_Max[k] = std::max( node.m_Max[k], bmax[k] );
+                }
+            }
+        }
+        else
+        {
+            const BVHNode &left = m_Nodes[ node.m_Left ];
+            const BVHNode &right = m_Nodes[ node.m_Right ];
+            for ( int k = 0 ; k < 3 ; k++ )
+            {
+                node.m_Min[k] = std::min( left.m_Min[k], right.m_Min[k] );
+                node.m_Max[k] = std::max( left.m_Max[k], right.m_Max[k] );
+            }
+        }
+    }
+}
+
+//==== Slab Test Of A Ray Against A Node Box Grown By tol ====//
+bool PickBVH::RayBox( const BVHNode &node, const vec3d &org, const vec3d &inv, double tol, double tmax ) const
+{
+    double t0 = 0;
+    double t1 = tmax;
+    for ( int k = 0 ; k < 3 ; k++ )
+    {
+        double ta = ( node.m_Min[k] - tol - org[k] ) * inv[k];
+        double tb = ( node.m_Max[k] + tol - org[k] ) * inv[k];
+        if ( ta > tb )
+        {
+            std::swap( ta, tb );
+        }
+        t0 = std::max( t0, ta );
+        t1 = std::min( t1, tb );
+        if ( t0 > t1 )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//==== Ray Against Both Triangles Of A Quad, Either Facing ====//
+bool PickBVH::RayQuad( int item, const vec3d &org, const vec3d &dir, double &t ) const
+{
+    const int *q = m_Quads.data() + 4 * item;
+    const int tri[2][3] = { { q[0], q[1], q[2] }, { q[0], q[2], q[3] } };
+
+    bool hit = false;
+    for ( int i = 0 ; i < 2 ; i++ )
+    {
+        const vec3d &p0 = m_Pnts[ tri[i][0] ];
+        vec3d e1 = m_Pnts[ tri[i][1] ] - p0;
+        vec3d e2 = m_Pnts[ tri[i][2] ] - p0;
+
+        vec3d pv = cross( dir, e2 );
+        double det = dot( e1, pv );
+        if ( std::abs( det ) < 1e-300 )
+        {
+            continue;
+        }
+        double idet = 1.0 / det;
+
+        vec3d tv = org - p0;
+        double u = dot( tv, pv ) * idet;
+        if ( u < 0 || u > 1 )
+        {
+            continue;
+        }
+
+        vec3d qv = cross( tv, e1 );
+        double v = dot( dir, qv ) * idet;
+        if ( v < 0 || u + v > 1 )
+        {
+            continue;
+        }
+
+        double tt = dot( e2, qv ) * idet;
+        if ( tt >= 0 && ( !hit || tt < t ) )
+        {
+            t = tt;
+            hit = true;
+        }
+    }
+    return hit;
+}
+
+bool PickBVH::RayPick( const vec3d &org, const vec3d &dir_in, double tol, PickHit &hit ) const
+{
+    hit = PickHit();
+
+    vec3d dir = dir_in;
+    if ( m_Nodes.empty() || dir.mag() <= 0 )
+    {
+        return false;
+    }
+    dir.normalize();
+
+    vec3d inv;
+    for ( int k = 0 ; k < 3 ; k++ )
+    {
+        inv[k] = std::abs( dir[k] ) > 1e-300 ? 1.0 / dir[k] : 1e300;
+    }
+
+    if ( m_Type == PICK_SURF )
+    {
+        tol = 0;
+    }
+
+    double tol2 = tol * tol;
+    double tie = 1e-6 * tol2;
+
+    int best = -1;
+    double best_t = DBL_MAX;
+    double best_d2 = DBL_MAX;
+
+    vector < int > stack;
+    stack.push_back( 0 );
+
+    while ( !stack.empty() )
+    {
+        const BVHNode &node = m_Nodes[ stack.back() ];
+        stack.pop_back();
+
+        // Surfaces only need boxes in front of the nearest hit so far.
+        double tmax = ( m_Type == PICK_SURF ) ? best_t : DBL_MAX;
+        if ( !RayBox( node, org, inv, tol, tmax ) )
+        {
+            continue;
+        }
+
+        if ( node.m_Left >= 0 )
+        {
+            stack.push_back( node.m_Left );
+            stack.push_back( node.m_Right );
+            continue;
+        }
+
+        for ( int i = node.m_Start ; i < node.m_Start + node.m_Count ; i++ )
+        {
+            int item = m_ItemOrder[i];
+
+            if ( m_Type == PICK_SURF )
+            {
+                double t;
+                if ( RayQuad( item, org, dir, t ) && t < best_t )
+                {
+                    best = item;
+                    best_t = t;
+                }
+            }
+            else
+            {
+                vec3d dp = m_Pnts[ m_ObjPntStart[ m_ItemObj[item] ] + m_ItemIndex[item] ] - org;
+                double t = dot( dp, dir );
+                vec3d perp = dp - dir * t;
+                double d2 = dot( perp, perp );
+
+                // Points at the same screen location are ties, the front one wins.
+                if ( t >= 0 && d2 <= tol2 && ( d2 < best_d2 - tie || ( d2 <= best_d2 + tie && t < best_t ) ) )
+                {
+                    best = item;
+                    best_t = t;
+                    best_d2 = d2;
+                }
+            }
+        }
+    }
+
+    if ( best < 0 )
+    {
+        return false;
+    }
+
+    hit.m_Obj = m_ItemObj[best];
+    hit.m_Index = m_ItemIndex[best];
+    hit.m_T = best_t;
+    if ( m_Type == PICK_SURF )
+    {
+        hit.m_Pnt = org + dir * best_t;
+    }
+    else
+    {
+        hit.m_Pnt = m_Pnts[ m_ObjPntStart[ hit.m_Obj ] + hit.m_Index ];
+    }
+    return true;
+}
+
+void PickBVH::FrustumSelect( const vector < vec3d > &plane_org, const vector < vec3d > &plane_norm, vector < PickHit > &hits ) const
+{
+    hits.clear();
+
+    int nplane = std::min( plane_org.size(), plane_norm.size() );
+    if ( m_Nodes.empty() )
+    {
+        return;
+    }
+
+    vector < int > stack;
+    stack.push_back( 0 );
+
+    while ( !stack.empty() )
+    {
+        const BVHNode &node = m_Nodes[ stack.back() ];
+        stack.pop_back();
+
+        // Skip boxes wholly outside any plane.
+        bool outside = false;
+        for ( int p = 0 ; p < nplane && !outside ; p++ )
+        {
+            double s = 0;
+            for ( int k = 0 ; k < 3 ; k++ )
+            {
+                double c = plane_norm[p][k] >= 0 ? node.m_Max[k] : node.m_Min[k];
+                s += ( c - plane_org[p][k] ) * plane_norm[p][k];
+            }
+            outside = s < 0;
+        }
+        if ( outside )
+        {
+            continue;
+        }
+
+        if ( node.m_Left >= 0 )
+        {
+            stack.push_back( node.m_Left );
+            stack.push_back( node.m_Right );
+            continue;
+        }
+
+        for ( int i = node.m_Start ; i < node.m_Start + node.m_Count ; i++ )
+        {
+            int item = m_ItemOrder[i];
+
+            int nv = 1;
+            const int *vind = nullptr;
+            int pind = 0;
+            if ( m_Type == PICK_SURF )
+            {
+                nv = 4;
+                vind = m_Quads.data() + 4 * item;
+            }
+            else
+            {
+                pind = m_ObjPntStart[ m_ItemObj[item] ] + m_ItemIndex[item];
+                vind = &pind;
+            }
+
+            for ( int v = 0 ; v < nv ; v++ )
+            {
+                const vec3d &pnt = m_Pnts[ vind[v] ];
+
+                bool inside = true;
+                for ( int p = 0 ; p < nplane && inside ; p++ )
+                {
+                    inside = dot( pnt - plane_org[p], plane_norm[p] ) >= 0;
+                }
+
+                if ( inside )
+                {
+                    PickHit h;
+                    h.m_Obj = m_ItemObj[item];
+                    h.m_Index = m_ItemIndex[item];
+                    h.m_Pnt = pnt;
+                    hits.push_back( h );
+                    break;
+                }
+            }
+        }
+    }
+
+    // Deterministic order regardless of tree layout.
+    std::sort( hits.begin(), hits.end(), []( const PickHit &a, const PickHit &b )
+    {
+        return a.m_Obj < b.m_Obj || ( a.m_Obj == b.m_Obj && a.m_Index < b.m_Index );
+    } );
+}
@@ -0,0 +1,112 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// PickBVH.h: CPU picking over display tessellations.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(VSPPICKBVH__INCLUDED_)
+#define VSPPICKBVH__INCLUDED_
+
+#include "Vec3d.h"
+
+#include <vector>
+#include <string>
+
+using std::string;
+using std::vector;
+
+class DrawObj;
+
+//==== One Picked Item ====//
+class PickHit
+{
+public:
+    PickHit();
+
+    int m_Obj;          // Index into the DrawObjs given to Update().
+    int m_Index;        // Vertex index for points, quad index for surfaces.
+    double m_T;         // Distance along the ray.
+    vec3d m_Pnt;
+};
+
+//==== Bounding Volume Hierarchy Of Pickable DrawObj Points Or Surfaces ====//
+// Positions are copied from the DrawObjs, so queries do not touch them.  Vertex
+// indices follow the order the DrawObj is loaded into the graphics vertex buffer.
+// Surfaces are the quads of packed meshes (m_ElemBuf) or of m_PntMesh.
+class PickBVH
+{
+public:
+
+    enum PICK_TYPE { PICK_PNTS, PICK_SURF };
+
+    PickBVH( int type = PICK_PNTS );
+
+    // Rebuilds when objects or their sizes changed, else refits the existing
+    // tree to the moved vertices.  Returns true if the tree was rebuilt.
+    bool Update( const vector < DrawObj* > &objs );
+
+    // Points: closest to the ray within tol, nearest along the ray on ties.
+    // Surfaces: first quad hit along the ray, tol is ignored.
+    bool RayPick( const vec3d &org, const vec3d &dir, double tol, PickHit &hit ) const;
+
+    // Items on the inner side of all planes.  Surfaces are selected by any vertex inside.
+    void FrustumSelect( const vector < vec3d > &plane_org, const vector < vec3d > &plane_norm, vector < PickHit > &hits ) const;
+
+    int GetNumObjs() const
+    {
+        return ( int )m_ObjID.size();
+    }
+
+    const string & GetObjID( int i ) const
+    {
+        return m_ObjID[i];
+    }
+
+    int GetNumItems() const
+    {
+        return ( int )m_ItemObj.size();
+    }
+
+protected:
+
+    struct BVHNode
+    {
+        double m_Min[3];
+        double m_Max[3];
+        int m_Left;     // Child index, -1 for leaves.
+        int m_Right;
+        int m_Start;    // Range into m_ItemOrder for leaves.
+        int m_Count;
+    };
+
+    void LoadPnts( const DrawObj* obj, vector < vec3d > &pnts ) const;
+    void LoadQuads( const DrawObj* obj, int vstart, vector < int > &quads ) const;
+
+    int BuildNode( int start, int count );
+    void Refit();
+    void ItemBox( int item, double bmin[3], double bmax[3] ) const;
+
+    bool RayBox( const BVHNode &node, const vec3d &org, const vec3d &inv, double tol, double tmax ) const;
+    bool RayQuad( int item, const vec3d &org, const vec3d &dir, double &t ) const;
+
+    int m_Type;
+
+    vector < string > m_ObjID;
+    vector < int > m_ObjNumPnts;
+    vector < int > m_ObjNumItems;
+    vector < int > m_ObjPntStart;
+
+    vector < vec3d > m_Pnts;
+    vector < int > m_Quads;         // Four m_Pnts indices per surface item.
+
+    vector < int > m_ItemObj;
+    vector < int > m_ItemIndex;
+    vector < int > m_ItemOrder;
+    vector < vec3d > m_ItemCen;     // Only held while building.
+    vector < BVHNode > m_Nodes;
+};
+
+#endif
@@ -9,7 +9,18 @@
 #include "APIErrorMgr.h"
 #include "APITestSuite.h"
 #include <float.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <map>
 #include "Vec3d.h"
+#include "AdvLinkMgr.h"
+#include "DrawObj.h"
+#include "LinkMgr.h"
+#include "PickBVH.h"
+#include "ParmMgr.h"
+#include "Vehicle.h"
+#include "VehicleMgr.h"
 
 //Default tolerance to use for tests.  Most calculations are done as doubles and choosing single precision FLT_MIN gives some allowance for precision stackup in calculations
 #define TEST_TOL FLT_MIN
@@ -202,6 +213,732 @@ void APITestSuite::ChangePodParams()
     TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
 }
 
+//==== Batch Parm Changes - Compare Against One SetParmValUpdate Per Parm ====//
+void APITestSuite::TestSetParmValBatch()
+{
+    printf( "APITestSuite::TestSetParmValBatch()\n" );
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    //==== 20 Pods With 10 Design Variables Each ====//
+    const char* parm_names[] = { "Length", "FineRatio", "X_Rel_Location", "Y_Rel_Location", "Z_Rel_Location",
+                                 "X_Rel_Rotation", "Y_Rel_Rotation", "Z_Rel_Rotation", "Origin", "Scale" };
+    const char* group_names[] = { "Design", "Design", "XForm", "XForm", "XForm",
+                                  "XForm", "XForm", "XForm", "XForm", "XForm" };
+    int num_pods = 20;
+    int num_parms = 10;
+
+    vector < string > pod_ids;
+    vector < string > parm_ids;
+    for ( int i = 0; i < num_pods; i++ )
+    {
+        string pod_id = vsp::AddGeom( "POD" );
+        TEST_ASSERT( pod_id.c_str() != nullptr );
+        pod_ids.push_back( pod_id );
+
+        for ( int j = 0; j < num_parms; j++ )
+        {
+            parm_ids.push_back( vsp::GetParm( pod_id, parm_names[j], group_names[j] ) );
+        }
+    }
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    //==== Drive Another Pod From The First Pod's Length ====//
+    string link_pod = vsp::AddGeom( "POD" );
+    string len_id = vsp::GetParm( pod_ids[0], "Length", "Design" );
+    string x_pos_id = vsp::GetParm( link_pod, "X_Rel_Location", "XForm" );
+
+    vsp::AddAdvLink( "BatchLink" );
+    int indx = vsp::GetLinkIndex( "BatchLink" );
+    vsp::AddAdvLinkInput( indx, len_id, "len" );
+    vsp::AddAdvLinkOutput( indx, x_pos_id, "x" );
+    vsp::SetAdvLinkCode( indx, "x = 10.0 - len;" );
+    vsp::BuildAdvLinkScript( indx );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    int num_evals = 5;
+    vector < vector < double > > eval_vals( num_evals, vector < double > ( parm_ids.size() ) );
+    for ( int k = 0; k < num_evals; k++ )
+    {
+        for ( int i = 0; i < ( int )parm_ids.size(); i++ )
+        {
+            double base = ( i % num_parms ) < 2 ? 5.0 : 0.0;       // Keep length and fineness positive
+            eval_vals[k][i] = base + 0.1 * ( k + 1 ) + 0.01 * ( i % num_parms );
+        }
+    }
+
+    //==== Current Path - One Update Per Parm ====//
+    for ( int k = 0; k < num_evals; k++ )
+    {
+        for ( int i = 0; i < ( int )parm_ids.size(); i++ )
+        {
+            vsp::SetParmValUpdate( parm_ids[i], eval_vals[k][i] );
+        }
+    }
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    vector < double > single_vals;
+    for ( int i = 0; i < ( int )parm_ids.size(); i++ )
+    {
+        single_vals.push_back( vsp::GetParmVal( parm_ids[i] ) );
+    }
+    double single_link_val = vsp::GetParmVal( x_pos_id );
+    TEST_ASSERT_DELTA( single_link_val, 10.0 - vsp::GetParmVal( len_id ), TEST_TOL );
+
+    //==== Reset, Then Batch Path - One Update Per Evaluation ====//
+    vector < double > reset_vals( parm_ids.size(), 1.0 );
+    vsp::SetParmValBatch( parm_ids, reset_vals );
+
+    for ( int k = 0; k < num_evals; k++ )
+    {
+        vsp::SetParmValBatch( parm_ids, eval_vals[k] );
+    }
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    //==== Same Final State Either Way ====//
+    for ( int i = 0; i < ( int )parm_ids.size(); i++ )
+    {
+        TEST_ASSERT_DELTA( vsp::GetParmVal( parm_ids[i] ), single_vals[i], TEST_TOL );
+    }
+    TEST_ASSERT_DELTA( vsp::GetParmVal( x_pos_id ), single_link_val, TEST_TOL );
+
+    //==== Two Link Targets On One Geom - It Updates Once Per Batch ====//
+    string target_pod = vsp::AddGeom( "POD" );
+    string fine_id = vsp::GetParm( pod_ids[0], "FineRatio", "Design" );
+    string target_len_id = vsp::GetParm( target_pod, "Length", "Design" );
+    string target_fine_id = vsp::GetParm( target_pod, "FineRatio", "Design" );
+    // Links without an offset, so the targets follow the first pod
+    TEST_ASSERT( LinkMgr.AddLink( len_id, target_len_id, false ) );
+    TEST_ASSERT( LinkMgr.AddLink( fine_id, target_fine_id, false ) );
+    vsp::Update();
+
+    Geom* target_geom = VehicleMgr.GetVehicle()->FindGeom( target_pod );
+    TEST_ASSERT( target_geom != nullptr );
+
+    for ( int k = 0; k < num_evals; k++ )
+    {
+        int shape_count = target_geom->GetShapeUpdateCount();
+        vsp::SetParmValBatch( parm_ids, eval_vals[k] );
+        TEST_ASSERT( target_geom->GetShapeUpdateCount() == shape_count + 1 );
+        TEST_ASSERT_DELTA( vsp::GetParmVal( target_len_id ), vsp::GetParmVal( len_id ), TEST_TOL );
+        TEST_ASSERT_DELTA( vsp::GetParmVal( target_fine_id ), vsp::GetParmVal( fine_id ), TEST_TOL );
+    }
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    //==== Mismatched Input Is An Error ====//
+    vector < double > short_vals( 1, 1.0 );
+    vsp::SetParmValBatch( parm_ids, short_vals );
+    TEST_ASSERT( vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    printf( "\n" );
+}
+
+//==== Links Downstream Of Other Links Are Updated After All Their Inputs ====//
+void APITestSuite::TestLinkPropagationOrder()
+{
+    printf( "APITestSuite::TestLinkPropagationOrder()\n" );
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    string pod_id = vsp::AddGeom( "POD" );
+    string len_id = vsp::GetParm( pod_id, "Length", "Design" );
+    string x_id = vsp::GetParm( pod_id, "X_Rel_Location", "XForm" );
+    string y_id = vsp::GetParm( pod_id, "Y_Rel_Location", "XForm" );
+
+    //==== Diamond - Y Depends On Length Directly And Through X ====//
+    vsp::AddAdvLink( "SumLink" );
+    int sum_indx = vsp::GetLinkIndex( "SumLink" );
+    vsp::AddAdvLinkInput( sum_indx, x_id, "x" );
+    vsp::AddAdvLinkInput( sum_indx, len_id, "len" );
+    vsp::AddAdvLinkOutput( sum_indx, y_id, "y" );
+    vsp::SetAdvLinkCode( sum_indx, "y = x + len;" );
+    vsp::BuildAdvLinkScript( sum_indx );
+
+    vsp::AddAdvLink( "DiffLink" );
+    int diff_indx = vsp::GetLinkIndex( "DiffLink" );
+    vsp::AddAdvLinkInput( diff_indx, len_id, "len" );
+    vsp::AddAdvLinkOutput( diff_indx, x_id, "x" );
+    vsp::SetAdvLinkCode( diff_indx, "x = 10.0 - len;" );
+    vsp::BuildAdvLinkScript( diff_indx );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    // SumLink is listed first but has to run after DiffLink
+    double len_vec[] = { 3.0, 7.0, 12.0 };
+    for ( int i = 0; i < 3; i++ )
+    {
+        vsp::SetParmValUpdate( len_id, len_vec[i] );
+        TEST_ASSERT_DELTA( vsp::GetParmVal( x_id ), 10.0 - len_vec[i], TEST_TOL );
+        TEST_ASSERT_DELTA( vsp::GetParmVal( y_id ), 10.0, TEST_TOL );
+    }
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    //==== Same Result Through A Batch ====//
+    vector < string > parm_ids( 1, len_id );
+    vector < double > vals( 1, 4.0 );
+    vsp::SetParmValBatch( parm_ids, vals );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( x_id ), 6.0, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( y_id ), 10.0, TEST_TOL );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    printf( "\n" );
+}
+
+//==== Simple Arithmetic Links Must Match The Same Code Run Through AngelScript ====//
+void APITestSuite::TestAdvLinkFastPath()
+{
+    printf( "APITestSuite::TestAdvLinkFastPath()\n" );
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    string pod_id = vsp::AddGeom( "POD" );
+    string len_id = vsp::GetParm( pod_id, "Length", "Design" );
+    string x_id = vsp::GetParm( pod_id, "X_Rel_Location", "XForm" );
+    string y_id = vsp::GetParm( pod_id, "Y_Rel_Location", "XForm" );
+    string z_id = vsp::GetParm( pod_id, "Z_Rel_Location", "XForm" );
+
+    // Straight line arithmetic - evaluated without the script engine
+    vsp::AddAdvLink( "FastLink" );
+    int fast_indx = vsp::GetLinkIndex( "FastLink" );
+    vsp::AddAdvLinkInput( fast_indx, len_id, "len" );
+    vsp::AddAdvLinkOutput( fast_indx, x_id, "x" );
+    vsp::AddAdvLinkOutput( fast_indx, y_id, "y" );
+    vsp::SetAdvLinkCode( fast_indx, "x = 0.5 * len + sqrt( len ) / 3.0;  // Comment\ny = pow( x, 2 ) - atan2( len, x );" );
+    vsp::BuildAdvLinkScript( fast_indx );
+
+    // Same first expression behind an if - needs AngelScript
+    vsp::AddAdvLink( "ScriptLink" );
+    int script_indx = vsp::GetLinkIndex( "ScriptLink" );
+    vsp::AddAdvLinkInput( script_indx, len_id, "len" );
+    vsp::AddAdvLinkOutput( script_indx, z_id, "z" );
+    vsp::SetAdvLinkCode( script_indx, "if ( len > 0.0 ) { z = 0.5 * len + sqrt( len ) / 3.0; }" );
+    vsp::BuildAdvLinkScript( script_indx );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    double len_vec[] = { 2.0, 5.5, 17.25 };
+    for ( int i = 0; i < 3; i++ )
+    {
+        vsp::SetParmValUpdate( len_id, len_vec[i] );
+
+        double x = 0.5 * len_vec[i] + sqrt( len_vec[i] ) / 3.0;
+        TEST_ASSERT_DELTA( vsp::GetParmVal( x_id ), x, TEST_TOL );
+        TEST_ASSERT_DELTA( vsp::GetParmVal( y_id ), pow( x, 2 ) - atan2( len_vec[i], x ), TEST_TOL );
+        TEST_ASSERT_DELTA( vsp::GetParmVal( z_id ), vsp::GetParmVal( x_id ), TEST_TOL );
+    }
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    // Only the straight line link skipped the script engine
+    TEST_ASSERT( AdvLinkMgr.GetLink( fast_indx )->GetNumExprRuns() > 0 );
+    TEST_ASSERT( AdvLinkMgr.GetLink( script_indx )->GetNumExprRuns() == 0 );
+
+    //==== Outputs Read Before They Are Assigned Carry Over Between Runs On Both Paths ====//
+    vsp::DelAllAdvLinks();
+
+    string fast_pod = vsp::AddGeom( "POD" );
+    string script_pod = vsp::AddGeom( "POD" );
+    string fast_x_id = vsp::GetParm( fast_pod, "X_Rel_Location", "XForm" );
+    string script_x_id = vsp::GetParm( script_pod, "X_Rel_Location", "XForm" );
+
+    vsp::AddAdvLink( "FastAccumLink" );
+    fast_indx = vsp::GetLinkIndex( "FastAccumLink" );
+    vsp::AddAdvLinkInput( fast_indx, len_id, "len" );
+    vsp::AddAdvLinkOutput( fast_indx, fast_x_id, "x" );
+    vsp::SetAdvLinkCode( fast_indx, "x = 0.5 * x + len;" );
+    vsp::BuildAdvLinkScript( fast_indx );
+
+    vsp::AddAdvLink( "ScriptAccumLink" );
+    script_indx = vsp::GetLinkIndex( "ScriptAccumLink" );
+    vsp::AddAdvLinkInput( script_indx, len_id, "len" );
+    vsp::AddAdvLinkOutput( script_indx, script_x_id, "x" );
+    vsp::SetAdvLinkCode( script_indx, "if ( len > 0.0 ) { x = 0.5 * x + len; }" );
+    vsp::BuildAdvLinkScript( script_indx );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    // Both start from the unassigned value and halve it every run, so the outputs
+    // come back inside the parm limits and must agree all along the way.
+    for ( int i = 0; i < 24; i++ )
+    {
+        vsp::SetParmValUpdate( len_id, 2.0 + 0.5 * i );
+
+        double script_x = vsp::GetParmVal( script_x_id );
+        TEST_ASSERT_DELTA( vsp::GetParmVal( fast_x_id ), script_x, TEST_TOL * std::max( 1.0, std::abs( script_x ) ) );
+    }
+    TEST_ASSERT( vsp::GetParmVal( fast_x_id ) > -1.0e9 );
+    TEST_ASSERT( AdvLinkMgr.GetLink( fast_indx )->GetNumExprRuns() > 0 );
+    TEST_ASSERT( AdvLinkMgr.GetLink( script_indx )->GetNumExprRuns() == 0 );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    printf( "\n" );
+}
+
+void APITestSuite::TestCopyPasteDirect()
+{
+    printf( "APITestSuite::TestCopyPasteDirect()\n" );
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    //==== Wing With Many Sections And Sub-Surfaces ====//
+    string wing_id = vsp::AddGeom( "WING" );
+    TEST_ASSERT( wing_id.c_str() != nullptr );
+
+    int num_sect = 20;
+    for ( int i = 0; i < num_sect; i++ )
+    {
+        vsp::InsertXSec( wing_id, 1, vsp::XS_FOUR_SERIES );
+    }
+    vsp::Update();
+
+    for ( int i = 1; i <= num_sect; i++ )
+    {
+        char group_name[256];
+        snprintf( group_name, sizeof( group_name ), "XSec_%d", i );
+        vsp::SetParmVal( wing_id, "Span", group_name, 1.0 + 0.1 * i );
+        vsp::SetParmVal( wing_id, "Sweep", group_name, 0.7 * i );
+        vsp::SetParmVal( wing_id, "Dihedral", group_name, 0.1 * i / 3.0 );
+    }
+    vsp::SetParmVal( wing_id, "X_Rel_Location", "XForm", 1.0 / 3.0 );
+
+    vsp::AddSubSurf( wing_id, vsp::SS_RECTANGLE, 0 );
+    vsp::AddSubSurf( wing_id, vsp::SS_ELLIPSE, 0 );
+    vsp::AddSubSurf( wing_id, vsp::SS_CONTROL, 0 );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    vector < string > src_parms = vsp::GetGeomParmIDs( wing_id );
+
+    //==== Copy And Paste Several Times, Direct Path Then XML Path ====//
+    vsp::CopyGeomToClipboard( wing_id );
+
+    int num_paste = 3;
+    vector < string > paste_ids[2];
+    for ( int path = 0; path < 2; path++ )
+    {
+        ParmMgr.SetDirectCopyEnabled( path == 0 );
+        for ( int i = 0; i < num_paste; i++ )
+        {
+            vector < string > pasted = vsp::PasteGeomClipboard();
+            TEST_ASSERT( pasted.size() == 1 );
+            if ( pasted.size() == 1 )
+            {
+                paste_ids[path].push_back( pasted[0] );
+            }
+        }
+    }
+    ParmMgr.SetDirectCopyEnabled( true );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    //==== Both Paths Give The Source's Parm Values Exactly ====//
+    TEST_ASSERT( paste_ids[0].size() == paste_ids[1].size() );
+    for ( int i = 0; i < ( int )paste_ids[0].size() && i < ( int )paste_ids[1].size(); i++ )
+    {
+        TEST_ASSERT( paste_ids[0][i] != wing_id );
+        TEST_ASSERT( vsp::GetNumSubSurf( paste_ids[0][i] ) == 3 );
+        TEST_ASSERT( vsp::GetNumSubSurf( paste_ids[1][i] ) == 3 );
+
+        vector < string > direct_parms = vsp::GetGeomParmIDs( paste_ids[0][i] );
+        vector < string > xml_parms = vsp::GetGeomParmIDs( paste_ids[1][i] );
+        TEST_ASSERT( direct_parms.size() == src_parms.size() );
+        TEST_ASSERT( xml_parms.size() == src_parms.size() );
+        if ( direct_parms.size() != src_parms.size() || xml_parms.size() != src_parms.size() )
+        {
+            continue;
+        }
+
+        for ( int j = 0; j < ( int )src_parms.size(); j++ )
+        {
+            TEST_ASSERT( direct_parms[j] != src_parms[j] );
+            TEST_ASSERT( vsp::GetParmName( direct_parms[j] ) == vsp::GetParmName( xml_parms[j] ) );
+            TEST_ASSERT( vsp::GetParmVal( direct_parms[j] ) == vsp::GetParmVal( xml_parms[j] ) );
+            TEST_ASSERT( vsp::GetParmVal( direct_parms[j] ) == vsp::GetParmVal( src_parms[j] ) );
+        }
+    }
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    printf( "\n" );
+}
+
+void APITestSuite::TestVehicleSnapshot()
+{
+    printf( "APITestSuite::TestVehicleSnapshot()\n" );
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    //==== Model With Several Geoms And An Advanced Link ====//
+    vector < string > geom_ids;
+    for ( int i = 0; i < 10; i++ )
+    {
+        geom_ids.push_back( vsp::AddGeom( "POD" ) );
+    }
+    geom_ids.push_back( vsp::AddGeom( "WING" ) );
+    geom_ids.push_back( vsp::AddGeom( "FUSELAGE", geom_ids[0] ) );
+
+    string len_id = vsp::GetParm( geom_ids[0], "Length", "Design" );
+    string x_id = vsp::GetParm( geom_ids[1], "X_Rel_Location", "XForm" );
+
+    vsp::AddAdvLink( "SnapLink" );
+    int indx = vsp::GetLinkIndex( "SnapLink" );
+    vsp::AddAdvLinkInput( indx, len_id, "len" );
+    vsp::AddAdvLinkOutput( indx, x_id, "x" );
+    vsp::SetAdvLinkCode( indx, "x = 2.0 * len;" );
+    vsp::BuildAdvLinkScript( indx );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    string fname = "apitest_VehicleSnapshot.vsp3";
+    vsp::WriteVSPFile( fname );
+
+    //==== Save Snapshot And Record Values ====//
+    string snap_id = vsp::SaveVehicleSnapshot();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    vector < string > parm_ids;
+    for ( int i = 0; i < ( int )geom_ids.size(); i++ )
+    {
+        vector < string > geom_parms = vsp::GetGeomParmIDs( geom_ids[i] );
+        parm_ids.insert( parm_ids.end(), geom_parms.begin(), geom_parms.end() );
+    }
+
+    vector < double > snap_vals;
+    for ( int i = 0; i < ( int )parm_ids.size(); i++ )
+    {
+        snap_vals.push_back( vsp::GetParmVal( parm_ids[i] ) );
+    }
+
+    //==== Change Parms, Add A Geom And A Link ====//
+    vsp::SetParmVal( len_id, 13.0 );
+    vsp::SetParmVal( geom_ids[5], "Y_Rel_Rotation", "XForm", 10.0 );
+    vsp::SetParmVal( geom_ids[10], "Span", "XSec_1", 7.5 );
+    vsp::AddGeom( "POD", geom_ids[3] );
+    vsp::AddAdvLink( "NewLink" );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( x_id ), 26.0, TEST_TOL );
+
+    //==== Restore ====//
+    int num_changed = vsp::RestoreVehicleSnapshot( snap_id );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+    TEST_ASSERT( num_changed > 0 );
+
+    TEST_ASSERT( vsp::FindGeoms().size() == geom_ids.size() );
+    TEST_ASSERT( vsp::GetAdvLinkNames().size() == 1 );
+    for ( int i = 0; i < ( int )parm_ids.size(); i++ )
+    {
+        TEST_ASSERT( vsp::GetParmVal( parm_ids[i] ) == snap_vals[i] );
+    }
+    TEST_ASSERT_DELTA( vsp::GetParmVal( x_id ), 2.0 * vsp::GetParmVal( len_id ), TEST_TOL );
+
+    //==== Link Still Live After Restore ====//
+    vsp::SetParmValUpdate( len_id, 4.0 );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( x_id ), 8.0, TEST_TOL );
+
+    vsp::RestoreVehicleSnapshot( snap_id );
+    TEST_ASSERT( vsp::RestoreVehicleSnapshot( snap_id ) == 0 );        // Nothing left to change
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    //==== Deleted Geom Can Not Be Restored - Model Left Unchanged ====//
+    vsp::DeleteGeom( geom_ids[7] );
+    vsp::SetParmVal( len_id, 6.0 );
+    vsp::RestoreVehicleSnapshot( snap_id );
+    vsp::ErrorObj err = vsp::ErrorMgr.PopLastError();
+    TEST_ASSERT( err.GetErrorCode() == vsp::VSP_INVALID_GEOM_ID );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( len_id ), 6.0, TEST_TOL );
+
+    //==== Deleted Parm Outside Any Geom Can Not Be Restored ====//
+    vsp::ClearVSPModel();
+    vsp::ReadVSPFile( fname );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    string ruler_id = vsp::AddRuler( geom_ids[0], 0, 0.0, 0.0, geom_ids[1], 0, 0.0, 0.0, "SnapRuler" );
+    string ruler_snap_id = vsp::SaveVehicleSnapshot();
+    vsp::DelRuler( ruler_id );
+    vsp::SetParmVal( len_id, 6.0 );
+    TEST_ASSERT( vsp::RestoreVehicleSnapshot( ruler_snap_id ) == 0 );
+    err = vsp::ErrorMgr.PopLastError();
+    TEST_ASSERT( err.GetErrorCode() == vsp::VSP_INVALID_ID );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( len_id ), 6.0, TEST_TOL );
+
+    vsp::DeleteAllVehicleSnapshots();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    printf( "\n" );
+}
+
+void APITestSuite::TestSurfaceQueryArrays()
+{
+    printf( "APITestSuite::TestSurfaceQueryArrays()\n" );
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    string pod_id = vsp::AddGeom( "POD" );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    int n = 20000;
+    vector < double > us( n ), ws( n );
+    for ( int i = 0; i < n; i++ )
+    {
+        us[i] = ( i % 200 + 0.5 ) / 200.0;
+        ws[i] = ( i / 200 + 0.5 ) / ( n / 200 );
+    }
+
+    //==== Points, Normals And Curvature ====//
+    vector < vec3d > pts = vsp::CompVecPnt01( pod_id, 0, us, ws );
+
+    vector < double > pnt_arr( 3 * n );
+    vsp::CompPnt01Array( pod_id, 0, us.data(), ws.data(), n, pnt_arr.data() );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    vector < vec3d > norms = vsp::CompVecNorm01( pod_id, 0, us, ws );
+    vector < double > norm_arr( 3 * n );
+    vsp::CompNorm01Array( pod_id, 0, us.data(), ws.data(), n, norm_arr.data() );
+
+    vector < double > k1, k2, ka, kg;
+    vsp::CompVecCurvature01( pod_id, 0, us, ws, k1, k2, ka, kg );
+    vector < double > k1_arr( n ), k2_arr( n ), ka_arr( n ), kg_arr( n );
+    vsp::CompCurvature01Array( pod_id, 0, us.data(), ws.data(), n, k1_arr.data(), k2_arr.data(), ka_arr.data(), kg_arr.data() );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    for ( int i = 0; i < n; i++ )
+    {
+        for ( int j = 0; j < 3; j++ )
+        {
+            TEST_ASSERT_DELTA( pnt_arr[ 3 * i + j ], pts[i][j], TEST_TOL );
+            TEST_ASSERT_DELTA( norm_arr[ 3 * i + j ], norms[i][j], TEST_TOL );
+        }
+        TEST_ASSERT_DELTA( k1_arr[i], k1[i], TEST_TOL );
+        TEST_ASSERT_DELTA( k2_arr[i], k2[i], TEST_TOL );
+        TEST_ASSERT_DELTA( ka_arr[i], ka[i], TEST_TOL );
+        TEST_ASSERT_DELTA( kg_arr[i], kg[i], TEST_TOL );
+    }
+
+    //==== Projection - Offset Points Back Onto The Surface ====//
+    int np = 2000;
+    vector < vec3d > off_pts( np );
+    vector < double > off_arr( 3 * np );
+    for ( int i = 0; i < np; i++ )
+    {
+        off_pts[i] = pts[ i * ( n / np ) ];
+        off_pts[i].offset_y( -5.0 );
+        off_pts[i].get_pnt( &off_arr[ 3 * i ] );
+    }
+
+    vector < double > u_vec, w_vec, d_vec;
+    vector < double > u_arr( np ), w_arr( np ), d_arr( np );
+
+    vsp::ProjVecPnt01( pod_id, 0, off_pts, u_vec, w_vec, d_vec );
+    vsp::ProjPnt01Array( pod_id, 0, off_arr.data(), np, u_arr.data(), w_arr.data(), d_arr.data() );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    for ( int i = 0; i < np; i++ )
+    {
+        TEST_ASSERT_DELTA( u_arr[i], u_vec[i], TEST_TOL );
+        TEST_ASSERT_DELTA( w_arr[i], w_vec[i], TEST_TOL );
+        TEST_ASSERT_DELTA( d_arr[i], d_vec[i], TEST_TOL );
+    }
+
+    vsp::AxisProjVecPnt01( pod_id, 0, vsp::Y_DIR, off_pts, u_vec, w_vec, d_vec );
+    vsp::AxisProjPnt01Array( pod_id, 0, vsp::Y_DIR, off_arr.data(), np, u_arr.data(), w_arr.data(), d_arr.data() );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    for ( int i = 0; i < np; i++ )
+    {
+        TEST_ASSERT_DELTA( u_arr[i], u_vec[i], TEST_TOL );
+        TEST_ASSERT_DELTA( w_arr[i], w_vec[i], TEST_TOL );
+        TEST_ASSERT_DELTA( d_arr[i], d_vec[i], TEST_TOL );
+    }
+
+    //==== Bad Inputs Report Errors ====//
+    vsp::CompPnt01Array( "NotAGeom", 0, us.data(), ws.data(), n, pnt_arr.data() );
+    TEST_ASSERT( vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+    vsp::CompPnt01Array( pod_id, 99, us.data(), ws.data(), n, pnt_arr.data() );
+    TEST_ASSERT( vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    printf( "\n" );
+}
+
+void APITestSuite::TestStreamingLoad()
+{
+    printf( "APITestSuite::TestStreamingLoad()\n" );
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    //==== Many Geoms Plus A Mesh With Embedded Triangles ====//
+    for ( int i = 0; i < 30; i++ )
+    {
+        string pod_id = vsp::AddGeom( "POD" );
+        vsp::SetParmVal( pod_id, "Y_Rel_Location", "XForm", 2.0 * i );
+        vsp::SetParmVal( pod_id, "Length", "Design", 1.0 + i / 7.0 );
+    }
+    string wing_id = vsp::AddGeom( "WING" );
+    for ( int i = 0; i < 10; i++ )
+    {
+        vsp::InsertXSec( wing_id, 1, vsp::XS_FOUR_SERIES );
+    }
+
+    //==== User Material Is Written After The Geoms That Use It ====//
+    vsp::AddMaterial( "StreamGlass", vec3d( 44, 2, 2 ), vec3d( 156, 10, 10 ), vec3d( 185, 159, 159 ), vec3d( 44, 2, 2 ), 0.4, 30 );
+    vsp::SetGeomMaterialName( wing_id, "StreamGlass" );
+
+    vsp::Update();
+    vsp::ComputeCompGeom( vsp::SET_ALL, false, 0 );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    string fname = "apitest_StreamingLoad.vsp3";
+    vsp::WriteVSPFile( fname );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    vector < string > geom_ids = vsp::FindGeoms();
+    vector < string > parm_ids;
+    for ( int i = 0; i < ( int )geom_ids.size(); i++ )
+    {
+        vector < string > geom_parms = vsp::GetGeomParmIDs( geom_ids[i] );
+        parm_ids.insert( parm_ids.end(), geom_parms.begin(), geom_parms.end() );
+    }
+
+    vector < double > saved_vals;
+    for ( int i = 0; i < ( int )parm_ids.size(); i++ )
+    {
+        saved_vals.push_back( vsp::GetParmVal( parm_ids[i] ) );
+    }
+
+    //==== Streaming Load - IDs Are Kept When Loading Into An Empty Model ====//
+    vsp::ClearVSPModel();
+    vector < string > lib_names = vsp::GetMaterialNames();
+    TEST_ASSERT( std::find( lib_names.begin(), lib_names.end(), "StreamGlass" ) == lib_names.end() );
+
+    vsp::ReadVSPFile( fname );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    TEST_ASSERT( vsp::FindGeoms().size() == geom_ids.size() );
+    for ( int i = 0; i < ( int )parm_ids.size(); i++ )
+    {
+        TEST_ASSERT_DELTA( vsp::GetParmVal( parm_ids[i] ), saved_vals[i], TEST_TOL );
+    }
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    //==== User Material Round Trip ====//
+    Geom* wing_ptr = VehicleMgr.GetVehicle()->FindGeom( wing_id );
+    TEST_ASSERT( wing_ptr != nullptr );
+    if ( wing_ptr )
+    {
+        Material* mat = wing_ptr->GetMaterial();
+        TEST_ASSERT( mat->m_Name == "StreamGlass" );
+        TEST_ASSERT_DELTA( mat->m_Diff[0], 156.0 / 255.0, TEST_TOL );
+        TEST_ASSERT_DELTA( mat->m_Diff[3], 0.4, TEST_TOL );
+        TEST_ASSERT_DELTA( mat->m_Shininess, 30.0, TEST_TOL );
+    }
+
+    //==== Whole Document Read Gives The Same Material ====//
+    VehicleMgr.GetVehicle()->SetStreamReadEnabled( false );
+    vsp::ClearVSPModel();
+    vsp::ReadVSPFile( fname );
+    VehicleMgr.GetVehicle()->SetStreamReadEnabled( true );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    wing_ptr = VehicleMgr.GetVehicle()->FindGeom( wing_id );
+    TEST_ASSERT( wing_ptr != nullptr );
+    if ( wing_ptr )
+    {
+        TEST_ASSERT( wing_ptr->GetMaterial()->m_Name == "StreamGlass" );
+    }
+
+    //==== Whole Document Load Of The Same Geoms ====//
+    vsp::ClearVSPModel();
+    vsp::InsertVSPFile( fname, "" );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    TEST_ASSERT( vsp::FindGeoms().size() == geom_ids.size() );
+
+    printf( "\n" );
+}
+
+void APITestSuite::TestBinaryArrayFile()
+{
+    printf( "APITestSuite::TestBinaryArrayFile()\n" );
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    //==== Mesh Only Model - Bounding Box Comes From Stored Triangles ====//
+    vector < string > pod_ids;
+    for ( int i = 0; i < 5; i++ )
+    {
+        string pod_id = vsp::AddGeom( "POD" );
+        vsp::SetParmVal( pod_id, "Y_Rel_Location", "XForm", 1.5 * i );
+        vsp::SetParmVal( pod_id, "Z_Rel_Location", "XForm", 0.1 * i );
+        pod_ids.push_back( pod_id );
+    }
+    vsp::Update();
+    string mesh_id = vsp::ComputeCompGeom( vsp::SET_ALL, false, 0 );
+    vsp::DeleteGeomVec( pod_ids );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    double bb[6];
+    TEST_ASSERT( vsp::GetBBoxSet( vsp::SET_ALL, bb[0], bb[1], bb[2], bb[3], bb[4], bb[5] ) );
+
+    string veh_id = vsp::GetVehicleID();
+    const char* names[] = { "text", "base64", "sidecar" };
+
+    for ( int encoding = vsp::VSP3_ARRAY_TEXT; encoding <= vsp::VSP3_ARRAY_SIDECAR; encoding++ )
+    {
+        string fname = string( "apitest_BinaryArray_" ) + names[ encoding ] + ".vsp3";
+
+        vsp::SetParmVal( veh_id, "ArrayEncoding", "VSP3Settings", encoding );
+        vsp::WriteVSPFile( fname );
+        TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+        vsp::ClearVSPModel();
+        vsp::ReadVSPFile( fname );
+        TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+        TEST_ASSERT( vsp::FindGeoms().size() == 1 );
+        TEST_ASSERT( vsp::GetParmVal( veh_id, "ArrayEncoding", "VSP3Settings" ) == encoding );
+
+        //==== Binary Blocks Are Exact, Text Is Written With Full Precision ====//
+        double rb[6];
+        TEST_ASSERT( vsp::GetBBoxSet( vsp::SET_ALL, rb[0], rb[1], rb[2], rb[3], rb[4], rb[5] ) );
+        for ( int i = 0; i < 6; i++ )
+        {
+            TEST_ASSERT_DELTA( rb[i], bb[i], TEST_TOL );
+        }
+    }
+
+    //==== Damaged Sidecar Is Reported - Rest Of The Model Still Loads ====//
+    FILE* fp = fopen( "apitest_BinaryArray_sidecar.vsp3.bin", "r+b" );
+    TEST_ASSERT( fp != nullptr );
+    if ( fp )
+    {
+        int c = fgetc( fp );
+        fseek( fp, 0, SEEK_SET );
+        fputc( c ^ 0xff, fp );
+        fclose( fp );
+    }
+
+    vsp::ClearVSPModel();
+    vsp::ReadVSPFile( "apitest_BinaryArray_sidecar.vsp3" );
+    vsp::ErrorObj err = vsp::ErrorMgr.PopLastError();
+    TEST_ASSERT( err.GetErrorCode() == vsp::VSP_FILE_READ_FAILURE );
+    TEST_ASSERT( vsp::FindGeoms().size() == 1 );
+
+    //==== Missing Sidecar Is Reported ====//
+    remove( "apitest_BinaryArray_sidecar.vsp3.bin" );
+    vsp::ClearVSPModel();
+    vsp::ReadVSPFile( "apitest_BinaryArray_sidecar.vsp3" );
+    err = vsp::ErrorMgr.PopLastError();
+    TEST_ASSERT( err.GetErrorCode() == vsp::VSP_FILE_READ_FAILURE );
+    TEST_ASSERT( vsp::FindGeoms().size() == 1 );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    printf( "\n" );
+}
+
 //==== Use Case 1 =====//
 void APITestSuite::CopyPasteGeometry()
 {
@@ -354,6 +1091,718 @@ void APITestSuite::TestAnalysesWithPod()
 
 }
 
+void APITestSuite::TestResultsWriters()
+{
+    printf( "APITestSuite::TestResultsWriters()\n" );
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    vsp::DeleteAllResults();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    vsp::WriteTestResults();
+    string rid = vsp::FindLatestResultsID( "Test_Results" );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    vsp::WriteResultsCSVFile( rid, "apitest_Results.csv" );
+    vsp::WriteResultsBinaryFile( rid, "apitest_Results.vspres" );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    //==== Read The Binary Record Back And Compare To The Accessors ====//
+    FILE* fid = fopen( "apitest_Results.vspres", "rb" );
+    TEST_ASSERT( fid != nullptr );
+    if ( !fid )
+    {
+        return;
+    }
+
+    // Short reads leave defaults that fail the comparisons below.
+    auto read_int = [ fid ]()
+    {
+        int32_t v = -1;
+        fread( &v, sizeof( v ), 1, fid );
+        return ( int )v;
+    };
+    auto read_string = [ fid, &read_int ]()
+    {
+        string str( std::max( read_int(), 0 ), ' ' );
+        str.resize( fread( &str[0], 1, str.size(), fid ) );
+        return str;
+    };
+
+    char tag[8];
+    TEST_ASSERT( fread( tag, 1, 8, fid ) == 8 );
+    TEST_ASSERT( strncmp( tag, "VSPRES01", 8 ) == 0 );
+    TEST_ASSERT( read_string() == "Test_Results" );
+    TEST_ASSERT( read_string() == rid );
+
+    int64_t timestamp = 0;
+    TEST_ASSERT( fread( &timestamp, sizeof( timestamp ), 1, fid ) == 1 );
+    TEST_ASSERT( timestamp > 0 );
+
+    vector < string > data_names = vsp::GetAllDataNames( rid );
+    int ndata = 0;
+    for ( int i = 0; i < ( int )data_names.size(); i++ )
+    {
+        ndata += vsp::GetNumData( rid, data_names[i] );
+    }
+    TEST_ASSERT( read_int() == ndata );
+
+    std::map < string, int > name_index;
+    for ( int i = 0; i < ndata; i++ )
+    {
+        string name = read_string();
+        int type = read_int();
+        int nrow = read_int();
+        int ncol = read_int();
+        int index = name_index[ name ]++;
+
+        TEST_ASSERT( type == vsp::GetResultsType( rid, name ) );
+
+        if ( type == vsp::INT_DATA )
+        {
+            const vector < int > & ivec = vsp::GetIntResults( rid, name, index );
+            TEST_ASSERT( nrow == ( int )ivec.size() && ncol == 1 );
+            for ( int r = 0; r < nrow; r++ )
+            {
+                TEST_ASSERT( read_int() == ivec[r] );
+            }
+        }
+        else if ( type == vsp::DOUBLE_DATA || type == vsp::VEC3D_DATA )
+        {
+            vector < double > dvec( nrow * ncol );
+            TEST_ASSERT( fread( dvec.data(), sizeof( double ), dvec.size(), fid ) == dvec.size() );
+
+            if ( type == vsp::DOUBLE_DATA )
+            {
+                const vector < double > & res_vec = vsp::GetDoubleResults( rid, name, index );
+                TEST_ASSERT( nrow == ( int )res_vec.size() && ncol == 1 );
+                for ( int r = 0; r < nrow; r++ )
+                {
+                    TEST_ASSERT_DELTA( dvec[r], res_vec[r], TEST_TOL );
+                }
+            }
+            else
+            {
+                const vector < vec3d > & res_vec = vsp::GetVec3dResults( rid, name, index );
+                TEST_ASSERT( nrow == ( int )res_vec.size() && ncol == 3 );
+                for ( int r = 0; r < nrow; r++ )
+                {
+                    TEST_ASSERT_DELTA( dvec[ 3 * r + 2 ], res_vec[r].z(), TEST_TOL );
+                }
+            }
+        }
+        else if ( type == vsp::STRING_DATA )
+        {
+            const vector < string > & svec = vsp::GetStringResults( rid, name, index );
+            TEST_ASSERT( nrow == ( int )svec.size() );
+            for ( int r = 0; r < nrow; r++ )
+            {
+                TEST_ASSERT( read_string() == svec[r] );
+            }
+        }
+    }
+
+    // Single result, so the record ends the file.
+    TEST_ASSERT( fgetc( fid ) == EOF );
+    fclose( fid );
+
+    //==== CSV Matches The Stored Values ====//
+    fid = fopen( "apitest_Results.csv", "r" );
+    TEST_ASSERT( fid != nullptr );
+    if ( fid )
+    {
+        bool found = false;
+        char line[512];
+        while ( fgets( line, sizeof( line ), fid ) )
+        {
+            if ( strncmp( line, "Test_Double_Vec,", 16 ) == 0 )
+            {
+                const vector < double > & dvec = vsp::GetDoubleResults( rid, "Test_Double_Vec" );
+                char * tok = strtok( line + 16, ",\n" );
+                for ( int r = 0; r < ( int )dvec.size(); r++ )
+                {
+                    TEST_ASSERT( tok != nullptr );
+                    TEST_ASSERT_DELTA( atof( tok ), dvec[r], TEST_TOL );
+                    tok = strtok( nullptr, ",\n" );
+                }
+                found = true;
+            }
+        }
+        TEST_ASSERT( found );
+        fclose( fid );
+    }
+
+    printf( "\n" );
+}
+
+void APITestSuite::TestSliceAreas()
+{
+    printf( "APITestSuite::TestSliceAreas()\n" );
+
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    //==== Pod With Known Max Cross Section ====//
+    string pod_id = vsp::AddGeom( "POD" );
+    vsp::SetParmValUpdate( pod_id, "Length", "Design", 7.0 );
+    vsp::SetParmValUpdate( pod_id, "FineRatio", "Design", 10.0 );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    double rad = 0.5 * 7.0 / 10.0;
+    double max_area = M_PI * rad * rad;
+
+    //==== Planar Slices ====//
+    string analysis_name = "PlanarSlice";
+    vsp::SetAnalysisInputDefaults( analysis_name );
+    vsp::SetIntAnalysisInput( analysis_name, "NumSlices", { 41 } );
+
+    string rid = vsp::ExecAnalysis( analysis_name );
+    TEST_ASSERT( rid.size() > 0 );
+
+    const vector < double > & slice_area = vsp::GetDoubleResults( rid, "Slice_Area" );
+    TEST_ASSERT( slice_area.size() == 41 );
+
+    double slice_max = 0;
+    for ( int i = 0; i < ( int )slice_area.size(); i++ )
+    {
+        TEST_ASSERT( slice_area[i] >= 0 );
+        slice_max = std::max( slice_max, slice_area[i] );
+    }
+    // Faceted sections are slightly smaller than the round body.
+    TEST_ASSERT( slice_max < max_area );
+    TEST_ASSERT( slice_max > 0.95 * max_area );
+
+    // End slices are just outside the body.
+    TEST_ASSERT_DELTA( slice_area[0], 0.0, TEST_TOL );
+    TEST_ASSERT_DELTA( slice_area.back(), 0.0, TEST_TOL );
+
+    //==== Wave Drag Slices Around The Mach Cone ====//
+    analysis_name = "WaveDrag";
+    vsp::SetAnalysisInputDefaults( analysis_name );
+    vsp::SetIntAnalysisInput( analysis_name, "NumSlices", { 100 } );
+    vsp::SetIntAnalysisInput( analysis_name, "NumRotSects", { 8 } );
+    vsp::SetDoubleAnalysisInput( analysis_name, "Mach", { 1.4 } );
+
+    rid = vsp::ExecAnalysis( analysis_name );
+    TEST_ASSERT( rid.size() > 0 );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    int ntheta = vsp::GetIntResults( rid, "Num_Cone_Sections" )[0];
+    TEST_ASSERT( ntheta == 8 );
+
+    // Projected oblique sections of a slender body are close to its normal sections.
+    for ( int itheta = 0; itheta < ntheta; itheta++ )
+    {
+        const vector < double > & wave_area = vsp::GetDoubleResults( rid, "Slice_Area", itheta );
+        TEST_ASSERT( wave_area.size() == 100 );
+
+        double wave_max = 0;
+        for ( int i = 0; i < ( int )wave_area.size(); i++ )
+        {
+            wave_max = std::max( wave_max, wave_area[i] );
+        }
+        TEST_ASSERT_DELTA( wave_max, slice_max, 0.05 * max_area );
+    }
+
+    printf( "\n" );
+}
+
+void APITestSuite::TestMassSlice()
+{
+    printf( "APITestSuite::TestMassSlice()\n" );
+
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    //==== Ellipsoid Centered On The Origin ====//
+    string ell_id = vsp::AddGeom( "ELLIPSOID" );
+    vsp::SetParmValUpdate( ell_id, "A_Radius", "Design", 2.0 );
+    vsp::SetParmValUpdate( ell_id, "B_Radius", "Design", 1.0 );
+    vsp::SetParmValUpdate( ell_id, "C_Radius", "Design", 1.0 );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    double ell_vol = 4.0 / 3.0 * M_PI * 2.0 * 1.0 * 1.0;
+
+    vsp::ComputeMassProps( vsp::SET_ALL, 200, vsp::X_DIR );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    string rid = vsp::FindLatestResultsID( "Mass_Properties" );
+    TEST_ASSERT( rid.size() > 0 );
+
+    // Faceted body is slightly smaller than the ellipsoid.
+    double vol = vsp::GetDoubleResults( rid, "Total_Volume" )[0];
+    TEST_ASSERT( vol < ell_vol );
+    TEST_ASSERT( vol > 0.95 * ell_vol );
+
+    vec3d cg = vsp::GetVec3dResults( rid, "Total_CG" )[0];
+    TEST_ASSERT_DELTA( cg.x(), 0.0, 1e-3 );
+    TEST_ASSERT_DELTA( cg.y(), 0.0, 1e-3 );
+    TEST_ASSERT_DELTA( cg.z(), 0.0, 1e-3 );
+
+    // Equal B and C radii give equal transverse inertias.
+    double iyy = vsp::GetDoubleResults( rid, "Total_Iyy" )[0];
+    double izz = vsp::GetDoubleResults( rid, "Total_Izz" )[0];
+    TEST_ASSERT_DELTA( iyy, izz, 0.01 * iyy );
+
+    //==== Repeat Run Gives Identical Sums ====//
+    double ixx = vsp::GetDoubleResults( rid, "Total_Ixx" )[0];
+    vsp::ComputeMassProps( vsp::SET_ALL, 200, vsp::X_DIR );
+    rid = vsp::FindLatestResultsID( "Mass_Properties" );
+    TEST_ASSERT( vsp::GetDoubleResults( rid, "Total_Volume" )[0] == vol );
+    TEST_ASSERT( vsp::GetDoubleResults( rid, "Total_Ixx" )[0] == ixx );
+
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+    printf( "\n" );
+}
+
+void APITestSuite::TestProjection()
+{
+    printf( "APITestSuite::TestProjection()\n" );
+
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    //==== Two Separate Pods And One Overlapping The First ====//
+    vector < string > pod_ids;
+    double yloc[] = { 0.0, 3.0, 0.35 };
+    for ( int i = 0; i < 3; i++ )
+    {
+        string pod_id = vsp::AddGeom( "POD" );
+        vsp::SetParmValUpdate( pod_id, "Length", "Design", 7.0 );
+        vsp::SetParmValUpdate( pod_id, "FineRatio", "Design", 10.0 );
+        vsp::SetParmValUpdate( pod_id, "Y_Rel_Location", "XForm", yloc[i] );
+        pod_ids.push_back( pod_id );
+    }
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    double rad = 0.5 * 7.0 / 10.0;
+    double max_area = M_PI * rad * rad;
+
+    //==== Project Along X ====//
+    string analysis_name = "Projection";
+    vsp::SetAnalysisInputDefaults( analysis_name );
+    vsp::SetIntAnalysisInput( analysis_name, "TargetType", { vsp::SET_TARGET } );
+    vsp::SetIntAnalysisInput( analysis_name, "TargetSet", { vsp::SET_ALL } );
+    vsp::SetIntAnalysisInput( analysis_name, "DirectionType", { vsp::X_PROJ } );
+
+    string rid = vsp::ExecAnalysis( analysis_name );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+    TEST_ASSERT( rid.size() > 0 );
+
+    // Each component is unioned on its own.
+    const vector < double > & comp_area = vsp::GetDoubleResults( rid, "Comp_Areas" );
+    TEST_ASSERT( comp_area.size() == 3 );
+
+    double comp_sum = 0;
+    for ( int i = 0; i < ( int )comp_area.size(); i++ )
+    {
+        // Faceted outline is slightly smaller than the round body.
+        TEST_ASSERT( comp_area[i] < max_area );
+        TEST_ASSERT( comp_area[i] > 0.95 * max_area );
+        comp_sum += comp_area[i];
+    }
+
+    // The overlapping pods share area, the separate one does not.
+    double area = vsp::GetDoubleResults( rid, "Area" )[0];
+    TEST_ASSERT( area < comp_sum - 0.1 * max_area );
+    TEST_ASSERT( area > 2.0 * comp_area[1] );
+
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+    printf( "\n" );
+}
+
+void APITestSuite::TestGeometryAnalysisBatch()
+{
+    printf( "APITestSuite::TestGeometryAnalysisBatch()\n" );
+
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    //==== Two Separate Pods And One Overlapping The First, Each In Its Own Set ====//
+    double yloc[] = { 0.0, 3.0, 0.35 };
+    for ( int i = 0; i < 3; i++ )
+    {
+        string pod_id = vsp::AddGeom( "POD" );
+        vsp::SetParmValUpdate( pod_id, "Length", "Design", 7.0 );
+        vsp::SetParmValUpdate( pod_id, "FineRatio", "Design", 10.0 );
+        vsp::SetParmValUpdate( pod_id, "Y_Rel_Location", "XForm", yloc[i] );
+        vsp::SetSetFlag( pod_id, vsp::SET_FIRST_USER + i, true );
+    }
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    //==== Cases Sharing Their Targets ====//
+    int primary[] = { 0, 0, 0, 1 };
+    int secondary[] = { 1, 2, 1, 2 };
+    int type[] = { vsp::EXTERNAL_INTERFERENCE, vsp::EXTERNAL_INTERFERENCE, vsp::PACKAGING_INTERFERENCE, vsp::EXTERNAL_INTERFERENCE };
+
+    vector < string > case_ids;
+    for ( int i = 0; i < 4; i++ )
+    {
+        string ga_id = vsp::AddGeometryAnalysis();
+        vsp::SetParmVal( ga_id, "PrimarySet", "InterferenceCase", vsp::SET_FIRST_USER + primary[i] );
+        vsp::SetParmVal( ga_id, "SecondarySet", "InterferenceCase", vsp::SET_FIRST_USER + secondary[i] );
+        vsp::SetParmVal( ga_id, "IntererenceCheckType", "InterferenceCase", type[i] );
+        case_ids.push_back( ga_id );
+    }
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    string analysis_name = "GeometryAnalysis";
+    vsp::SetAnalysisInputDefaults( analysis_name );
+
+    string rid = vsp::ExecAnalysis( analysis_name );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+    TEST_ASSERT( rid.size() > 0 );
+
+    vector < string > res_ids = vsp::GetStringResults( rid, "ResultsVec" );
+    vector < double > eval_time = vsp::GetDoubleResults( rid, "Eval_Time" );
+    TEST_ASSERT( res_ids.size() == 4 );
+    TEST_ASSERT( eval_time.size() == 4 );
+
+    // One mesh per set.
+    TEST_ASSERT( vsp::GetIntResults( rid, "Num_Shared_Mesh" )[0] == 3 );
+    TEST_ASSERT( vsp::GetDoubleResults( rid, "Total_Time" ).size() == 1 );
+    TEST_ASSERT( vsp::GetDoubleResults( rid, "Shared_Mesh_Time" ).size() == 1 );
+
+    // Separate pods are apart, overlapping pods intersect.
+    TEST_ASSERT( vsp::GetDoubleResults( res_ids[0], "Min_Dist" )[0] > 2.0 );
+    TEST_ASSERT( vsp::GetIntResults( res_ids[1], "Intersection" )[0] == 1 );
+    TEST_ASSERT( vsp::GetDoubleResults( res_ids[1], "InterferenceVol" )[0] > 0.0 );
+
+    //==== Batched Results Match Cases Evaluated On Their Own ====//
+    for ( int i = 0; i < 4; i++ )
+    {
+        vsp::SetStringAnalysisInput( analysis_name, "CaseID", { case_ids[i] } );
+        string case_rid = vsp::ExecAnalysis( analysis_name );
+        TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+        TEST_ASSERT( vsp::GetIntResults( case_rid, "Interference" )[0] == vsp::GetIntResults( res_ids[i], "Interference" )[0] );
+        TEST_ASSERT( vsp::GetIntResults( case_rid, "Intersection" )[0] == vsp::GetIntResults( res_ids[i], "Intersection" )[0] );
+        TEST_ASSERT_DELTA( vsp::GetDoubleResults( case_rid, "Min_Dist" )[0], vsp::GetDoubleResults( res_ids[i], "Min_Dist" )[0], 1e-9 );
+        TEST_ASSERT_DELTA( vsp::GetDoubleResults( case_rid, "InterferenceVol" )[0], vsp::GetDoubleResults( res_ids[i], "InterferenceVol" )[0], 1e-9 );
+        TEST_ASSERT_DELTA( vsp::GetDoubleResults( case_rid, "Result" )[0], vsp::GetDoubleResults( res_ids[i], "Result" )[0], 1e-9 );
+    }
+
+    vsp::DeleteAllGeometryAnalyses();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+    printf( "\n" );
+}
+
+void APITestSuite::TestSnapTo()
+{
+    printf( "APITestSuite::TestSnapTo()\n" );
+
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    //==== Two Parallel Pods ====//
+    vector < string > pod_ids;
+    double yloc[] = { 0.0, 3.0 };
+    for ( int i = 0; i < 2; i++ )
+    {
+        string pod_id = vsp::AddGeom( "POD" );
+        vsp::SetParmValUpdate( pod_id, "Length", "Design", 7.0 );
+        vsp::SetParmValUpdate( pod_id, "FineRatio", "Design", 10.0 );
+        vsp::SetParmValUpdate( pod_id, "Y_Rel_Location", "XForm", yloc[i] );
+        vsp::SetSetFlag( pod_id, vsp::SET_FIRST_USER, true );
+        pod_ids.push_back( pod_id );
+    }
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+
+    // Pod diameter is 0.7, tessellation leaves some slack.
+    double clearance = vsp::ComputeMinClearanceDistance( pod_ids[1], vsp::SET_FIRST_USER );
+    TEST_ASSERT_DELTA( clearance, 2.3, 0.06 );
+
+    string yloc_id = vsp::GetParm( pod_ids[1], "Y_Rel_Location", "XForm" );
+    string zrot_id = vsp::GetParm( pod_ids[1], "Z_Rel_Rotation", "XForm" );
+
+    //==== Move Toward The Other Pod Until Target Clearance ====//
+    double dist = vsp::SnapParm( yloc_id, 0.5, false, vsp::SET_FIRST_USER );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+    TEST_ASSERT_DELTA( dist, 0.5, 1e-4 );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( yloc_id ), 1.2, 0.06 );
+    TEST_ASSERT_DELTA( vsp::ComputeMinClearanceDistance( pod_ids[1], vsp::SET_FIRST_USER ), dist, 1e-9 );
+
+    //==== Start Intersecting And Back Out To Target Clearance ====//
+    vsp::SetParmValUpdate( yloc_id, 0.5 );
+    TEST_ASSERT( vsp::ComputeMinClearanceDistance( pod_ids[1], vsp::SET_FIRST_USER ) == 0.0 );
+
+    dist = vsp::SnapParm( yloc_id, 0.3, true, vsp::SET_FIRST_USER );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+    TEST_ASSERT_DELTA( dist, 0.3, 1e-4 );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( yloc_id ), 1.0, 0.06 );
+
+    //==== Rotate Tail Toward The Other Pod ====//
+    dist = vsp::SnapParm( zrot_id, 0.1, false, vsp::SET_FIRST_USER );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+    TEST_ASSERT_DELTA( dist, 0.1, 1e-4 );
+    TEST_ASSERT( vsp::GetParmVal( zrot_id ) < 0.0 );
+    TEST_ASSERT_DELTA( vsp::ComputeMinClearanceDistance( pod_ids[1], vsp::SET_FIRST_USER ), dist, 1e-9 );
+
+    printf( "\n" );
+}
+
+void APITestSuite::TestDrawObjPacking()
+{
+    printf( "APITestSuite::TestDrawObjPacking()\n" );
+
+    //==== Synthetic Tessellation, 50 Components Of Two Patches ====//
+    const int ncomp = 50;
+    const int npnt = 33;
+    const int nxsec = 97;
+
+    vector < vector < vector < vec3d > > > pnts( 2, vector < vector < vec3d > >( npnt, vector < vec3d >( nxsec ) ) );
+    vector < vector < vector < vec3d > > > norms = pnts;
+    vector < vector < vector < double > > > utex( 2, vector < vector < double > >( npnt, vector < double >( nxsec, 0.0 ) ) );
+    vector < vector < vector < double > > > vtex = utex;
+
+    for ( int k = 0; k < 2; k++ )
+    {
+        for ( int i = 0; i < npnt; i++ )
+        {
+            for ( int j = 0; j < nxsec; j++ )
+            {
+                pnts[k][i][j] = vec3d( j, i, k );
+                norms[k][i][j] = vec3d( 0, 0, 1 );
+                utex[k][i][j] = ( double ) j / ( nxsec - 1 );
+                vtex[k][i][j] = ( double ) i / ( npnt - 1 );
+            }
+        }
+    }
+
+    DrawObj dobj;
+    dobj.BeginMeshBuffers();
+    for ( int c = 0; c < ncomp; c++ )
+    {
+        dobj.AppendMeshBuffers( pnts, norms, utex, vtex );
+    }
+    dobj.EndMeshBuffers();
+
+    size_t nvert = ( size_t ) ncomp * 2 * npnt * nxsec;
+    size_t nquad = ( size_t ) ncomp * 2 * ( npnt - 1 ) * ( nxsec - 1 );
+    TEST_ASSERT( dobj.m_MeshPacked );
+    TEST_ASSERT( dobj.m_ElemChanged );
+    TEST_ASSERT( dobj.m_VertBuf.size() == 8 * nvert );
+    TEST_ASSERT( dobj.m_ElemBuf.size() == 4 * nquad );
+    TEST_ASSERT( dobj.m_ElemBuf[ dobj.m_ElemBuf.size() - 2 ] == nvert - 1 );
+
+    // Second vertex of the first patch, interleaved x, y, z, nx, ny, nz, u, v.
+    TEST_ASSERT_DELTA( dobj.m_VertBuf[8], 1.0, TEST_TOL );
+    TEST_ASSERT_DELTA( dobj.m_VertBuf[13], 1.0, TEST_TOL );
+    TEST_ASSERT_DELTA( dobj.m_VertBuf[14], 1.0 / ( nxsec - 1 ), TEST_TOL );
+
+    //==== Coarse Levels Of Detail Index The Same Vertices ====//
+    // Every second and fourth station, always keeping the last.
+    TEST_ASSERT( dobj.m_LODElemBuf.size() == DrawObj::NUM_MESH_LOD - 1 );
+    TEST_ASSERT( dobj.m_LODElemBuf[0].size() == 4 * ncomp * 2 * 16 * 48 );
+    TEST_ASSERT( dobj.m_LODElemBuf[1].size() == 4 * ncomp * 2 * 8 * 24 );
+    for ( int lod = 0; lod < ( int ) dobj.m_LODElemBuf.size(); lod++ )
+    {
+        const vector < unsigned int > &elems = dobj.m_LODElemBuf[lod];
+        TEST_ASSERT( elems[ elems.size() - 2 ] == nvert - 1 );
+        TEST_ASSERT( *std::max_element( elems.begin(), elems.end() ) == nvert - 1 );
+    }
+
+    TEST_ASSERT_DELTA( dobj.m_BndCenter.x(), 0.5 * ( nxsec - 1 ), TEST_TOL );
+    TEST_ASSERT_DELTA( dobj.m_BndCenter.y(), 0.5 * ( npnt - 1 ), TEST_TOL );
+    TEST_ASSERT_DELTA( dobj.m_BndRadius, 0.5 * sqrt( ( nxsec - 1.0 ) * ( nxsec - 1.0 ) + ( npnt - 1.0 ) * ( npnt - 1.0 ) + 1.0 ), TEST_TOL );
+
+    //==== Repack Moved Geometry, As During A Slider Drag ====//
+    dobj.m_ElemChanged = false;
+    const float * vbuf = dobj.m_VertBuf.data();
+
+    const int nframe = 3;
+    for ( int f = 0; f < nframe; f++ )
+    {
+        pnts[0][0][0].set_x( f );
+
+        dobj.BeginMeshBuffers();
+        for ( int c = 0; c < ncomp; c++ )
+        {
+            dobj.AppendMeshBuffers( pnts, norms, utex, vtex );
+        }
+        dobj.EndMeshBuffers();
+    }
+
+    // Same dimensions keep the element buffer and the vertex buffer storage.
+    TEST_ASSERT( !dobj.m_ElemChanged );
+    TEST_ASSERT( dobj.m_VertBuf.data() == vbuf );
+    TEST_ASSERT_DELTA( dobj.m_VertBuf[0], nframe - 1.0, TEST_TOL );
+
+    //==== Changed Tessellation Rebuilds Elements ====//
+    for ( int k = 0; k < 2; k++ )
+    {
+        pnts[k].pop_back();
+        norms[k].pop_back();
+        utex[k].pop_back();
+        vtex[k].pop_back();
+    }
+
+    dobj.BeginMeshBuffers();
+    dobj.AppendMeshBuffers( pnts, norms, utex, vtex );
+    dobj.EndMeshBuffers();
+
+    TEST_ASSERT( dobj.m_ElemChanged );
+    TEST_ASSERT( dobj.m_VertBuf.size() == 8 * 2 * ( npnt - 1 ) * nxsec );
+    TEST_ASSERT( dobj.m_ElemBuf.size() == 4 * 2 * ( npnt - 2 ) * ( nxsec - 1 ) );
+
+    // 32 points keep stations 0, 2, ..., 30, 31.
+    TEST_ASSERT( dobj.m_LODElemBuf[0].size() == 4 * 2 * 16 * 48 );
+
+    printf( "\n" );
+}
+
+void APITestSuite::TestPickBVH()
+{
+    printf( "APITestSuite::TestPickBVH()\n" );
+
+    //==== Three Packed 21 x 21 Grids In Planes Of Constant X ====//
+    const int n = 21;
+    vector < vector < vector < vec3d > > > pnts( 1, vector < vector < vec3d > >( n, vector < vec3d >( n ) ) );
+    vector < vector < vector < vec3d > > > norms = pnts;
+    vector < vector < vector < double > > > utex( 1, vector < vector < double > >( n, vector < double >( n, 0.0 ) ) );
+    vector < vector < vector < double > > > vtex = utex;
+
+    vector < DrawObj > dobjs( 3 );
+    vector < DrawObj* > objs( 3 );
+    for ( int c = 0; c < 3; c++ )
+    {
+        for ( int i = 0; i < n; i++ )
+        {
+            for ( int j = 0; j < n; j++ )
+            {
+                pnts[0][i][j] = vec3d( 5.0 * c, 0.1 * i - 1.0, 0.1 * j - 1.0 );
+            }
+        }
+
+        dobjs[c].m_GeomID = "grid" + std::to_string( c );
+        dobjs[c].BeginMeshBuffers();
+        dobjs[c].AppendMeshBuffers( pnts, norms, utex, vtex );
+        dobjs[c].EndMeshBuffers();
+        objs[c] = &dobjs[c];
+    }
+
+    PickBVH surf( PickBVH::PICK_SURF );
+    PickBVH pts( PickBVH::PICK_PNTS );
+    TEST_ASSERT( surf.Update( objs ) );
+    TEST_ASSERT( pts.Update( objs ) );
+    TEST_ASSERT( surf.GetNumItems() == 3 * ( n - 1 ) * ( n - 1 ) );
+    TEST_ASSERT( pts.GetNumItems() == 3 * n * n );
+
+    //==== Click, First Surface Along The Ray ====//
+    PickHit hit;
+    TEST_ASSERT( surf.RayPick( vec3d( -10, 0.25, 0.35 ), vec3d( 1, 0, 0 ), 0.0, hit ) );
+    TEST_ASSERT( hit.m_Obj == 0 );
+    TEST_ASSERT( hit.m_Index == 12 * ( n - 1 ) + 13 );
+    TEST_ASSERT_DELTA( hit.m_T, 10.0, TEST_TOL );
+
+    // From behind, the last grid is hit first.
+    TEST_ASSERT( surf.RayPick( vec3d( 20, 0.25, 0.35 ), vec3d( -1, 0, 0 ), 0.0, hit ) );
+    TEST_ASSERT( hit.m_Obj == 2 );
+
+    TEST_ASSERT( !surf.RayPick( vec3d( -10, 1.5, 0.35 ), vec3d( 1, 0, 0 ), 0.0, hit ) );
+
+    //==== Hover, Closest Vertex Within Tolerance ====//
+    TEST_ASSERT( pts.RayPick( vec3d( -10, 0.21, 0.31 ), vec3d( 1, 0, 0 ), 0.03, hit ) );
+    TEST_ASSERT( hit.m_Obj == 0 );
+    TEST_ASSERT( hit.m_Index == 12 * n + 13 );
+    TEST_ASSERT( !pts.RayPick( vec3d( -10, 0.25, 0.35 ), vec3d( 1, 0, 0 ), 0.03, hit ) );
+
+    //==== Box Select Through Four Planes ====//
+    vector < vec3d > plane_org = { vec3d( 0, -0.05, 0 ), vec3d( 0, 0.05, 0 ), vec3d( 0, 0, -0.05 ), vec3d( 0, 0, 0.05 ) };
+    vector < vec3d > plane_norm = { vec3d( 0, 1, 0 ), vec3d( 0, -1, 0 ), vec3d( 0, 0, 1 ), vec3d( 0, 0, -1 ) };
+    vector < PickHit > hits;
+    pts.FrustumSelect( plane_org, plane_norm, hits );
+    TEST_ASSERT( hits.size() == 3 );
+    for ( int i = 0; i < ( int ) hits.size(); i++ )
+    {
+        TEST_ASSERT( hits[i].m_Obj == i );
+        TEST_ASSERT( hits[i].m_Index == 10 * n + 10 );
+    }
+
+    //==== Moved Geometry Refits, Changed Tessellation Rebuilds ====//
+    for ( int i = 0; i < n; i++ )
+    {
+        for ( int j = 0; j < n; j++ )
+        {
+            pnts[0][i][j] = vec3d( 20.0, 0.1 * i - 1.0, 0.1 * j - 1.0 );
+        }
+    }
+    dobjs[0].BeginMeshBuffers();
+    dobjs[0].AppendMeshBuffers( pnts, norms, utex, vtex );
+    dobjs[0].EndMeshBuffers();
+
+    TEST_ASSERT( !surf.Update( objs ) );
+    TEST_ASSERT( surf.RayPick( vec3d( -10, 0.25, 0.35 ), vec3d( 1, 0, 0 ), 0.0, hit ) );
+    TEST_ASSERT( hit.m_Obj == 1 );
+    TEST_ASSERT_DELTA( hit.m_T, 15.0, TEST_TOL );
+
+    pnts[0].pop_back();
+    norms[0].pop_back();
+    utex[0].pop_back();
+    vtex[0].pop_back();
+    dobjs[0].BeginMeshBuffers();
+    dobjs[0].AppendMeshBuffers( pnts, norms, utex, vtex );
+    dobjs[0].EndMeshBuffers();
+
+    TEST_ASSERT( surf.Update( objs ) );
+    TEST_ASSERT( surf.GetNumItems() == ( n - 2 ) * ( n - 1 ) + 2 * ( n - 1 ) * ( n - 1 ) );
+
+    //==== Many Components, Picks Land On The Right Tube ====//
+    const int ncomp = 20;
+    const int npnt = 33;
+    const int nxsec = 97;
+    vector < vector < vector < vec3d > > > bpnts( 1, vector < vector < vec3d > >( npnt, vector < vec3d >( nxsec ) ) );
+    vector < vector < vector < vec3d > > > bnorms = bpnts;
+    vector < vector < vector < double > > > butex( 1, vector < vector < double > >( npnt, vector < double >( nxsec, 0.0 ) ) );
+    vector < vector < vector < double > > > bvtex = butex;
+
+    vector < DrawObj > bdobjs( ncomp );
+    vector < DrawObj* > bobjs( ncomp );
+    for ( int c = 0; c < ncomp; c++ )
+    {
+        // Tubes of radius 1 along x, in a row along y.
+        for ( int i = 0; i < npnt; i++ )
+        {
+            for ( int j = 0; j < nxsec; j++ )
+            {
+                double theta = 2.0 * M_PI * j / ( nxsec - 1 );
+                bpnts[0][i][j] = vec3d( 0.5 * i, 3.0 * c + cos( theta ), sin( theta ) );
+            }
+        }
+        bdobjs[c].m_GeomID = "tube" + std::to_string( c );
+        bdobjs[c].BeginMeshBuffers();
+        bdobjs[c].AppendMeshBuffers( bpnts, bnorms, butex, bvtex );
+        bdobjs[c].EndMeshBuffers();
+        bobjs[c] = &bdobjs[c];
+    }
+
+    PickBVH big( PickBVH::PICK_SURF );
+    TEST_ASSERT( big.Update( bobjs ) );
+    TEST_ASSERT( !big.Update( bobjs ) );
+    TEST_ASSERT( big.GetNumItems() == ncomp * ( npnt - 1 ) * ( nxsec - 1 ) );
+
+    const int nray = 100;
+    int nhit = 0;
+    for ( int r = 0; r < nray; r++ )
+    {
+        // Down onto the top of each tube.
+        int c = r % ncomp;
+        if ( big.RayPick( vec3d( 7.9, 3.0 * c, 10 ), vec3d( 0, 0, -1 ), 0.0, hit ) && hit.m_Obj == c )
+        {
+            TEST_ASSERT_DELTA( hit.m_T, 9.0, 1e-2 );
+            nhit++;
+        }
+    }
+    TEST_ASSERT( nhit == nray );
+
+    printf( "\n" );
+}
+
 void APITestSuite::TestDXFExport()
 {
     printf( "APITestSuite::TestDXFExport()\n" );
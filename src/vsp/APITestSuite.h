@@ -26,9 +26,24 @@ public:
         TEST_ADD( APITestSuite::CopyPasteSetTest )
         TEST_ADD( APITestSuite::ChangePodParams )
         TEST_ADD( APITestSuite::CopyPasteGeometry )
+        TEST_ADD( APITestSuite::TestSetParmValBatch )
+        TEST_ADD( APITestSuite::TestLinkPropagationOrder )
+        TEST_ADD( APITestSuite::TestAdvLinkFastPath )
+        TEST_ADD( APITestSuite::TestCopyPasteDirect )
+        TEST_ADD( APITestSuite::TestVehicleSnapshot )
+        // Surface query
+        TEST_ADD( APITestSuite::TestSurfaceQueryArrays )
         // Analysis
         TEST_ADD( APITestSuite::CheckAnalysisMgr )
         TEST_ADD( APITestSuite::TestAnalysesWithPod )
+        TEST_ADD( APITestSuite::TestResultsWriters )
+        TEST_ADD( APITestSuite::TestSliceAreas )
+        TEST_ADD( APITestSuite::TestMassSlice )
+        TEST_ADD( APITestSuite::TestProjection )
+        TEST_ADD( APITestSuite::TestGeometryAnalysisBatch )
+        TEST_ADD( APITestSuite::TestSnapTo )
+        TEST_ADD( APITestSuite::TestDrawObjPacking )
+        TEST_ADD( APITestSuite::TestPickBVH )
 
         // Export
         TEST_ADD( APITestSuite::TestDXFExport )
@@ -36,6 +51,8 @@ public:
         TEST_ADD( APITestSuite::TestFacetExport )
         // Save and Load
         TEST_ADD( APITestSuite::TestSaveLoad )
+        TEST_ADD( APITestSuite::TestStreamingLoad )
+        TEST_ADD( APITestSuite::TestBinaryArrayFile )
         // FEA Mesh
         TEST_ADD( APITestSuite::TestFEAMesh )
         // XSec
@@ -50,15 +67,32 @@ private:
     void CopyPasteSetTest();
     void ChangePodParams();
     void CopyPasteGeometry();
+    void TestSetParmValBatch();
+    void TestLinkPropagationOrder();
+    void TestAdvLinkFastPath();
+    void TestCopyPasteDirect();
+    void TestVehicleSnapshot();
+    // Surface query
+    void TestSurfaceQueryArrays();
     // Analysis
     void CheckAnalysisMgr();
     void TestAnalysesWithPod();
+    void TestResultsWriters();
+    void TestSliceAreas();
+    void TestMassSlice();
+    void TestProjection();
+    void TestGeometryAnalysisBatch();
+    void TestSnapTo();
+    void TestDrawObjPacking();
+    void TestPickBVH();
     // Export
     void TestDXFExport();
     void TestSVGExport();
     void TestFacetExport();
     // Save and Load
     void TestSaveLoad();
+    void TestStreamingLoad();
+    void TestBinaryArrayFile();
     // FEA Mesh
     void TestFEAMesh();
     // XSec
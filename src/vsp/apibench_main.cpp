@@ -0,0 +1,627 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// apibench_main.cpp: Timing of API paths against the paths they replace.
+// Correctness of these paths is checked by the unit tests in apitest, this
+// only reports how long each takes.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <chrono>
+
+#include "VSP_Geom_API.h"
+#include "APIErrorMgr.h"
+#include "DrawObj.h"
+#include "ParmMgr.h"
+#include "PickBVH.h"
+#include "Vehicle.h"
+#include "VehicleMgr.h"
+
+using std::string;
+using std::vector;
+
+//==== Seconds Since Start ====//
+static double seconds_since( std::chrono::steady_clock::time_point start )
+{
+    return std::chrono::duration < double > ( std::chrono::steady_clock::now() - start ).count();
+}
+
+//==== SetParmValBatch Against One SetParmValUpdate Per Parm ====//
+void BenchSetParmValBatch()
+{
+    printf( "BenchSetParmValBatch()\n" );
+    vsp::VSPRenew();
+
+    const char* parm_names[] = { "Length", "FineRatio", "X_Rel_Location", "Y_Rel_Location", "Z_Rel_Location",
+                                 "X_Rel_Rotation", "Y_Rel_Rotation", "Z_Rel_Rotation", "Origin", "Scale" };
+    const char* group_names[] = { "Design", "Design", "XForm", "XForm", "XForm",
+                                  "XForm", "XForm", "XForm", "XForm", "XForm" };
+    int num_pods = 20;
+    int num_parms = 10;
+
+    vector < string > pod_ids;
+    vector < string > parm_ids;
+    for ( int i = 0; i < num_pods; i++ )
+    {
+        string pod_id = vsp::AddGeom( "POD" );
+        pod_ids.push_back( pod_id );
+
+        for ( int j = 0; j < num_parms; j++ )
+        {
+            parm_ids.push_back( vsp::GetParm( pod_id, parm_names[j], group_names[j] ) );
+        }
+    }
+
+    string link_pod = vsp::AddGeom( "POD" );
+    vsp::AddAdvLink( "BatchLink" );
+    int indx = vsp::GetLinkIndex( "BatchLink" );
+    vsp::AddAdvLinkInput( indx, vsp::GetParm( pod_ids[0], "Length", "Design" ), "len" );
+    vsp::AddAdvLinkOutput( indx, vsp::GetParm( link_pod, "X_Rel_Location", "XForm" ), "x" );
+    vsp::SetAdvLinkCode( indx, "x = 10.0 - len;" );
+    vsp::BuildAdvLinkScript( indx );
+
+    int num_evals = 5;
+    vector < vector < double > > eval_vals( num_evals, vector < double > ( parm_ids.size() ) );
+    for ( int k = 0; k < num_evals; k++ )
+    {
+        for ( int i = 0; i < ( int )parm_ids.size(); i++ )
+        {
+            double base = ( i % num_parms ) < 2 ? 5.0 : 0.0;
+            eval_vals[k][i] = base + 0.1 * ( k + 1 ) + 0.01 * ( i % num_parms );
+        }
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for ( int k = 0; k < num_evals; k++ )
+    {
+        for ( int i = 0; i < ( int )parm_ids.size(); i++ )
+        {
+            vsp::SetParmValUpdate( parm_ids[i], eval_vals[k][i] );
+        }
+    }
+    double single_time = seconds_since( start );
+
+    start = std::chrono::steady_clock::now();
+    for ( int k = 0; k < num_evals; k++ )
+    {
+        vsp::SetParmValBatch( parm_ids, eval_vals[k] );
+    }
+    double batch_time = seconds_since( start );
+
+    vsp::ErrorMgr.PopErrorAndPrint( stdout );
+
+    printf( "\t%d parms per evaluation\n", ( int )parm_ids.size() );
+    printf( "\tSetParmValUpdate: %f sec per evaluation\n", single_time / num_evals );
+    printf( "\tSetParmValBatch:  %f sec per evaluation\n", batch_time / num_evals );
+    printf( "\n" );
+}
+
+//==== Direct Copy/Paste Against The XML Copy/Paste ====//
+void BenchCopyPaste()
+{
+    printf( "BenchCopyPaste()\n" );
+    vsp::VSPRenew();
+
+    string wing_id = vsp::AddGeom( "WING" );
+
+    int num_sect = 20;
+    for ( int i = 0; i < num_sect; i++ )
+    {
+        vsp::InsertXSec( wing_id, 1, vsp::XS_FOUR_SERIES );
+    }
+    vsp::AddSubSurf( wing_id, vsp::SS_RECTANGLE, 0 );
+    vsp::AddSubSurf( wing_id, vsp::SS_ELLIPSE, 0 );
+    vsp::AddSubSurf( wing_id, vsp::SS_CONTROL, 0 );
+    vsp::Update();
+
+    vsp::CopyGeomToClipboard( wing_id );
+
+    int num_paste = 10;
+    double paste_time[2];
+    for ( int path = 0; path < 2; path++ )
+    {
+        ParmMgr.SetDirectCopyEnabled( path == 0 );
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for ( int i = 0; i < num_paste; i++ )
+        {
+            vsp::PasteGeomClipboard();
+        }
+        paste_time[path] = seconds_since( start );
+    }
+    ParmMgr.SetDirectCopyEnabled( true );
+
+    vsp::ErrorMgr.PopErrorAndPrint( stdout );
+
+    printf( "\tPaste %d wings with %d sections\n", num_paste, num_sect );
+    printf( "\tDirect: %f sec   XML: %f sec   Ratio: %f\n", paste_time[0], paste_time[1], paste_time[1] / paste_time[0] );
+    printf( "\n" );
+}
+
+//==== Snapshot Restore Against Reloading The File ====//
+void BenchSnapshot()
+{
+    printf( "BenchSnapshot()\n" );
+    vsp::VSPRenew();
+
+    vector < string > geom_ids;
+    for ( int i = 0; i < 20; i++ )
+    {
+        geom_ids.push_back( vsp::AddGeom( "POD" ) );
+    }
+    geom_ids.push_back( vsp::AddGeom( "WING" ) );
+    geom_ids.push_back( vsp::AddGeom( "FUSELAGE", geom_ids[0] ) );
+    vsp::Update();
+
+    string fname = "apibench_Snapshot.vsp3";
+    vsp::WriteVSPFile( fname );
+
+    string snap_id = vsp::SaveVehicleSnapshot();
+
+    int num_restore = 10;
+    double restore_time = 0.0;
+    for ( int i = 0; i < num_restore; i++ )
+    {
+        vsp::SetParmVal( geom_ids[0], "Length", "Design", 5.0 + i );
+        vsp::SetParmVal( geom_ids[20], "Span", "XSec_1", 5.0 + i );
+        vsp::Update();
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        vsp::RestoreVehicleSnapshot( snap_id );
+        restore_time += seconds_since( start );
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for ( int i = 0; i < num_restore; i++ )
+    {
+        vsp::ClearVSPModel();
+        vsp::ReadVSPFile( fname );
+    }
+    double reload_time = seconds_since( start );
+
+    vsp::ErrorMgr.PopErrorAndPrint( stdout );
+
+    printf( "\t%d Geoms\n", ( int )geom_ids.size() );
+    printf( "\tSnapshot restore: %f sec   File reload: %f sec\n", restore_time / num_restore, reload_time / num_restore );
+    printf( "\n" );
+}
+
+//==== Streaming Read Against The Whole Document Read ====//
+void BenchStreamingLoad()
+{
+    printf( "BenchStreamingLoad()\n" );
+    vsp::VSPRenew();
+
+    int num_pods = 200;
+    for ( int i = 0; i < num_pods; i++ )
+    {
+        string pod_id = vsp::AddGeom( "POD" );
+        vsp::SetParmVal( pod_id, "Y_Rel_Location", "XForm", 2.0 * i );
+    }
+
+    int num_wings = 20;
+    for ( int i = 0; i < num_wings; i++ )
+    {
+        string wing_id = vsp::AddGeom( "WING" );
+        vsp::SetParmVal( wing_id, "Z_Rel_Location", "XForm", 3.0 * i );
+        for ( int j = 0; j < 10; j++ )
+        {
+            vsp::InsertXSec( wing_id, 1, vsp::XS_FOUR_SERIES );
+        }
+    }
+    vsp::Update();
+    vsp::ComputeCompGeom( vsp::SET_ALL, false, 0 );
+
+    string fname = "apibench_StreamingLoad.vsp3";
+    vsp::WriteVSPFile( fname );
+
+    Vehicle* veh = VehicleMgr.GetVehicle();
+
+    int num_load = 3;
+    double load_time[2];
+    for ( int path = 0; path < 2; path++ )
+    {
+        veh->SetStreamReadEnabled( path == 0 );
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for ( int i = 0; i < num_load; i++ )
+        {
+            vsp::ClearVSPModel();
+            vsp::ReadVSPFile( fname );
+        }
+        load_time[path] = seconds_since( start ) / num_load;
+    }
+    veh->SetStreamReadEnabled( true );
+
+    vsp::ErrorMgr.PopErrorAndPrint( stdout );
+
+    printf( "\t%d pods, %d wings and a CompGeom mesh\n", num_pods, num_wings );
+    printf( "\tStreaming: %f sec   Document: %f sec   Ratio: %f\n", load_time[0], load_time[1], load_time[1] / load_time[0] );
+    printf( "\n" );
+}
+
+//==== Load Time Of Each Array Encoding ====//
+void BenchBinaryArrayFile()
+{
+    printf( "BenchBinaryArrayFile()\n" );
+    vsp::VSPRenew();
+
+    vector < string > pod_ids;
+    for ( int i = 0; i < 20; i++ )
+    {
+        string pod_id = vsp::AddGeom( "POD" );
+        vsp::SetParmVal( pod_id, "Y_Rel_Location", "XForm", 1.5 * i );
+        vsp::SetParmVal( pod_id, "Tess_U", "Shape", 40 );
+        vsp::SetParmVal( pod_id, "Tess_W", "Shape", 40 );
+        pod_ids.push_back( pod_id );
+    }
+    vsp::Update();
+    vsp::ComputeCompGeom( vsp::SET_ALL, false, 0 );
+    vsp::DeleteGeomVec( pod_ids );
+    vsp::Update();
+
+    string veh_id = vsp::GetVehicleID();
+    const char* names[] = { "text", "base64", "sidecar" };
+
+    int num_load = 3;
+    for ( int encoding = vsp::VSP3_ARRAY_TEXT; encoding <= vsp::VSP3_ARRAY_SIDECAR; encoding++ )
+    {
+        string fname = string( "apibench_BinaryArray_" ) + names[ encoding ] + ".vsp3";
+
+        vsp::SetParmVal( veh_id, "ArrayEncoding", "VSP3Settings", encoding );
+        vsp::WriteVSPFile( fname );
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for ( int i = 0; i < num_load; i++ )
+        {
+            vsp::ClearVSPModel();
+            vsp::ReadVSPFile( fname );
+        }
+        printf( "\t%-8s load: %f sec\n", names[ encoding ], seconds_since( start ) / num_load );
+    }
+
+    vsp::ErrorMgr.PopErrorAndPrint( stdout );
+    printf( "\n" );
+}
+
+//==== Array Surface Queries Against The Vector Versions ====//
+void BenchSurfaceQueryArrays()
+{
+    printf( "BenchSurfaceQueryArrays()\n" );
+    vsp::VSPRenew();
+
+    string pod_id = vsp::AddGeom( "POD" );
+    vsp::Update();
+
+    int n = 200000;
+    vector < double > us( n ), ws( n );
+    for ( int i = 0; i < n; i++ )
+    {
+        us[i] = ( i % 500 + 0.5 ) / 500.0;
+        ws[i] = ( i / 500 + 0.5 ) / ( n / 500 );
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    vector < vec3d > pts = vsp::CompVecPnt01( pod_id, 0, us, ws );
+    double vec_time = seconds_since( start );
+
+    vector < double > pnt_arr( 3 * n );
+    start = std::chrono::steady_clock::now();
+    vsp::CompPnt01Array( pod_id, 0, us.data(), ws.data(), n, pnt_arr.data() );
+    double arr_time = seconds_since( start );
+
+    printf( "\tCompPnt01 %d pts   vector: %f sec   array: %f sec\n", n, vec_time, arr_time );
+
+    int np = 5000;
+    vector < vec3d > off_pts( np );
+    vector < double > off_arr( 3 * np );
+    for ( int i = 0; i < np; i++ )
+    {
+        off_pts[i] = pts[ i * ( n / np ) ];
+        off_pts[i].offset_y( -5.0 );
+        off_pts[i].get_pnt( &off_arr[ 3 * i ] );
+    }
+
+    vector < double > u_vec, w_vec, d_vec;
+    vector < double > u_arr( np ), w_arr( np ), d_arr( np );
+
+    start = std::chrono::steady_clock::now();
+    vsp::ProjVecPnt01( pod_id, 0, off_pts, u_vec, w_vec, d_vec );
+    vec_time = seconds_since( start );
+
+    start = std::chrono::steady_clock::now();
+    vsp::ProjPnt01Array( pod_id, 0, off_arr.data(), np, u_arr.data(), w_arr.data(), d_arr.data() );
+    arr_time = seconds_since( start );
+
+    vsp::ErrorMgr.PopErrorAndPrint( stdout );
+
+    printf( "\tProjPnt01 %d pts   vector: %f sec   array: %f sec\n", np, vec_time, arr_time );
+    printf( "\n" );
+}
+
+//==== Planar And Wave Drag Slicing ====//
+void BenchSliceAreas()
+{
+    printf( "BenchSliceAreas()\n" );
+    vsp::VSPRenew();
+
+    string pod_id = vsp::AddGeom( "POD" );
+    vsp::SetParmVal( pod_id, "Length", "Design", 7.0 );
+    vsp::SetParmVal( pod_id, "FineRatio", "Design", 10.0 );
+    string wing_id = vsp::AddGeom( "WING" );
+    vsp::SetParmVal( wing_id, "X_Rel_Location", "XForm", 3.0 );
+    vsp::Update();
+
+    string analysis_name = "PlanarSlice";
+    vsp::SetAnalysisInputDefaults( analysis_name );
+    vsp::SetIntAnalysisInput( analysis_name, "NumSlices", { 200 } );
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    vsp::ExecAnalysis( analysis_name );
+    double slice_time = seconds_since( start );
+
+    analysis_name = "WaveDrag";
+    vsp::SetAnalysisInputDefaults( analysis_name );
+    vsp::SetIntAnalysisInput( analysis_name, "NumSlices", { 100 } );
+    vsp::SetIntAnalysisInput( analysis_name, "NumRotSects", { 8 } );
+    vsp::SetDoubleAnalysisInput( analysis_name, "Mach", { 1.4 } );
+
+    start = std::chrono::steady_clock::now();
+    vsp::ExecAnalysis( analysis_name );
+    double wave_time = seconds_since( start );
+
+    vsp::ErrorMgr.PopErrorAndPrint( stdout );
+
+    printf( "\tPlanarSlice 200 slices: %f sec\n", slice_time );
+    printf( "\tWaveDrag 100 slices x 8 thetas: %f sec\n", wave_time );
+    printf( "\n" );
+}
+
+//==== Mass Properties Slicing ====//
+void BenchMassSlice()
+{
+    printf( "BenchMassSlice()\n" );
+    vsp::VSPRenew();
+
+    string ell_id = vsp::AddGeom( "ELLIPSOID" );
+    vsp::SetParmVal( ell_id, "A_Radius", "Design", 2.0 );
+    string pod_id = vsp::AddGeom( "POD" );
+    vsp::SetParmVal( pod_id, "Y_Rel_Location", "XForm", 3.0 );
+    vsp::Update();
+
+    int num_slices[] = { 50, 200, 800 };
+    for ( int i = 0; i < 3; i++ )
+    {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        vsp::ComputeMassProps( vsp::SET_ALL, num_slices[i], vsp::X_DIR );
+        printf( "\t%d slices: %f sec\n", num_slices[i], seconds_since( start ) );
+    }
+
+    vsp::ErrorMgr.PopErrorAndPrint( stdout );
+    printf( "\n" );
+}
+
+//==== Projected Area Of Many Overlapping Pods ====//
+void BenchProjection()
+{
+    printf( "BenchProjection()\n" );
+    vsp::VSPRenew();
+
+    int num_pods = 20;
+    for ( int i = 0; i < num_pods; i++ )
+    {
+        string pod_id = vsp::AddGeom( "POD" );
+        vsp::SetParmVal( pod_id, "Y_Rel_Location", "XForm", 0.3 * i );
+        vsp::SetParmVal( pod_id, "Z_Rel_Location", "XForm", 0.1 * ( i % 3 ) );
+    }
+    vsp::Update();
+
+    string analysis_name = "Projection";
+    vsp::SetAnalysisInputDefaults( analysis_name );
+    vsp::SetIntAnalysisInput( analysis_name, "TargetType", { vsp::SET_TARGET } );
+    vsp::SetIntAnalysisInput( analysis_name, "TargetSet", { vsp::SET_ALL } );
+
+    const char* dir_names[] = { "X", "Y", "Z" };
+    int dirs[] = { vsp::X_PROJ, vsp::Y_PROJ, vsp::Z_PROJ };
+    for ( int i = 0; i < 3; i++ )
+    {
+        vsp::SetIntAnalysisInput( analysis_name, "DirectionType", { dirs[i] } );
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        vsp::ExecAnalysis( analysis_name );
+        printf( "\t%d pods along %s: %f sec\n", num_pods, dir_names[i], seconds_since( start ) );
+    }
+
+    vsp::ErrorMgr.PopErrorAndPrint( stdout );
+    printf( "\n" );
+}
+
+//==== Repacking Mesh Buffers Each Frame Of A Slider Drag ====//
+void BenchDrawObjPacking()
+{
+    printf( "BenchDrawObjPacking()\n" );
+
+    const int ncomp = 50;
+    const int npnt = 33;
+    const int nxsec = 97;
+
+    vector < vector < vector < vec3d > > > pnts( 2, vector < vector < vec3d > >( npnt, vector < vec3d >( nxsec ) ) );
+    vector < vector < vector < vec3d > > > norms = pnts;
+    vector < vector < vector < double > > > utex( 2, vector < vector < double > >( npnt, vector < double >( nxsec, 0.0 ) ) );
+    vector < vector < vector < double > > > vtex = utex;
+
+    for ( int k = 0; k < 2; k++ )
+    {
+        for ( int i = 0; i < npnt; i++ )
+        {
+            for ( int j = 0; j < nxsec; j++ )
+            {
+                pnts[k][i][j] = vec3d( j, i, k );
+                norms[k][i][j] = vec3d( 0, 0, 1 );
+                utex[k][i][j] = ( double ) j / ( nxsec - 1 );
+                vtex[k][i][j] = ( double ) i / ( npnt - 1 );
+            }
+        }
+    }
+
+    DrawObj dobj;
+    const int nframe = 50;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for ( int f = 0; f < nframe; f++ )
+    {
+        pnts[0][0][0].set_x( f );
+
+        dobj.BeginMeshBuffers();
+        for ( int c = 0; c < ncomp; c++ )
+        {
+            dobj.AppendMeshBuffers( pnts, norms, utex, vtex );
+        }
+        dobj.EndMeshBuffers();
+    }
+    double pack_time = seconds_since( start ) / nframe;
+
+    printf( "\tRepack of %d components, %d vertices: %f ms per frame\n", ncomp, ncomp * 2 * npnt * nxsec, 1000.0 * pack_time );
+    printf( "\n" );
+}
+
+//==== Pick BVH Build, Refit And Ray Picks Over Many Tubes ====//
+void BenchPickBVH()
+{
+    printf( "BenchPickBVH()\n" );
+
+    const int ncomp = 200;
+    const int npnt = 33;
+    const int nxsec = 97;
+    vector < vector < vector < vec3d > > > pnts( 1, vector < vector < vec3d > >( npnt, vector < vec3d >( nxsec ) ) );
+    vector < vector < vector < vec3d > > > norms = pnts;
+    vector < vector < vector < double > > > utex( 1, vector < vector < double > >( npnt, vector < double >( nxsec, 0.0 ) ) );
+    vector < vector < vector < double > > > vtex = utex;
+
+    vector < DrawObj > dobjs( ncomp );
+    vector < DrawObj* > objs( ncomp );
+    for ( int c = 0; c < ncomp; c++ )
+    {
+        // Tubes of radius 1 along x, in a row along y.
+        for ( int i = 0; i < npnt; i++ )
+        {
+            for ( int j = 0; j < nxsec; j++ )
+            {
+                double theta = 2.0 * M_PI * j / ( nxsec - 1 );
+                pnts[0][i][j] = vec3d( 0.5 * i, 3.0 * c + cos( theta ), sin( theta ) );
+            }
+        }
+        dobjs[c].m_GeomID = "tube" + std::to_string( c );
+        dobjs[c].BeginMeshBuffers();
+        dobjs[c].AppendMeshBuffers( pnts, norms, utex, vtex );
+        dobjs[c].EndMeshBuffers();
+        objs[c] = &dobjs[c];
+    }
+
+    PickBVH bvh( PickBVH::PICK_SURF );
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    bvh.Update( objs );
+    double build_time = seconds_since( start );
+
+    start = std::chrono::steady_clock::now();
+    bvh.Update( objs );
+    double refit_time = seconds_since( start );
+
+    const int nray = 1000;
+    int nhit = 0;
+    PickHit hit;
+    start = std::chrono::steady_clock::now();
+    for ( int r = 0; r < nray; r++ )
+    {
+        // Down onto the top of each tube.
+        int c = r % ncomp;
+        if ( bvh.RayPick( vec3d( 7.9, 3.0 * c, 10 ), vec3d( 0, 0, -1 ), 0.0, hit ) && hit.m_Obj == c )
+        {
+            nhit++;
+        }
+    }
+    double ray_time = seconds_since( start ) / nray;
+
+    printf( "\t%d quads: build %f s, refit %f s\n", bvh.GetNumItems(), build_time, refit_time );
+    printf( "\t%d of %d rays hit: %f ms per ray pick\n", nhit, nray, 1000.0 * ray_time );
+    printf( "\n" );
+}
+
+//==== Interference Cases Sharing Their Target Meshes ====//
+void BenchGeometryAnalysisBatch()
+{
+    printf( "BenchGeometryAnalysisBatch()\n" );
+
+    vsp::VSPRenew();
+
+    // Pods in a row, each in its own set.
+    const int npod = 4;
+    for ( int i = 0; i < npod; i++ )
+    {
+        string pod_id = vsp::AddGeom( "POD" );
+        vsp::SetParmValUpdate( pod_id, "Length", "Design", 7.0 );
+        vsp::SetParmValUpdate( pod_id, "FineRatio", "Design", 10.0 );
+        vsp::SetParmValUpdate( pod_id, "Y_Rel_Location", "XForm", 0.5 * i );
+        vsp::SetSetFlag( pod_id, vsp::SET_FIRST_USER + i, true );
+    }
+    vsp::Update();
+
+    // Every pair, so each set's mesh is used by several cases.
+    int ncase = 0;
+    for ( int i = 0; i < npod; i++ )
+    {
+        for ( int j = i + 1; j < npod; j++ )
+        {
+            string ga_id = vsp::AddGeometryAnalysis();
+            vsp::SetParmVal( ga_id, "PrimarySet", "InterferenceCase", vsp::SET_FIRST_USER + i );
+            vsp::SetParmVal( ga_id, "SecondarySet", "InterferenceCase", vsp::SET_FIRST_USER + j );
+            vsp::SetParmVal( ga_id, "IntererenceCheckType", "InterferenceCase", vsp::EXTERNAL_INTERFERENCE );
+            ncase++;
+        }
+    }
+
+    string analysis_name = "GeometryAnalysis";
+    vsp::SetAnalysisInputDefaults( analysis_name );
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    string rid = vsp::ExecAnalysis( analysis_name );
+    double exec_time = seconds_since( start );
+
+    vector < double > total_time = vsp::GetDoubleResults( rid, "Total_Time" );
+    vector < double > mesh_time = vsp::GetDoubleResults( rid, "Shared_Mesh_Time" );
+    vector < int > num_mesh = vsp::GetIntResults( rid, "Num_Shared_Mesh" );
+
+    if ( !total_time.empty() && !mesh_time.empty() && !num_mesh.empty() )
+    {
+        printf( "\t%d cases, %d shared meshes: %f sec total, %f sec building meshes\n", ncase, num_mesh[0], total_time[0], mesh_time[0] );
+    }
+    printf( "\tExecAnalysis: %f sec\n", exec_time );
+
+    vsp::ErrorMgr.PopErrorAndPrint( stdout );
+    printf( "\n" );
+}
+
+//========================================================//
+//========================= Main =========================//
+int main( int argc, char** argv )
+{
+    vsp::VSPCheckSetup();
+    vsp::ErrorMgr.PopErrorAndPrint( stdout );
+
+    BenchSetParmValBatch();
+    BenchCopyPaste();
+    BenchSnapshot();
+    BenchStreamingLoad();
+    BenchBinaryArrayFile();
+    BenchSurfaceQueryArrays();
+    BenchSliceAreas();
+    BenchMassSlice();
+    BenchProjection();
+    BenchDrawObjPacking();
+    BenchPickBVH();
+    BenchGeometryAnalysisBatch();
+
+    return 0;
+}
@@ -136,7 +136,18 @@ private:
     void _draw_Wire_VBuffer();
     void _draw_Wire_EBuffer();
     void _draw_VBuffer();
-    void _draw_EBuffer();
+    /*!
+    * Draw Element Buffer.  Quads use a coarser level of detail when lodFlag is set.
+    */
+    void _draw_EBuffer( bool lodFlag = true );
+
+    /*!
+    * Coarsest level of detail Element Buffer whose quads still span at most a few
+    * pixels at the current view, or the full Element Buffer.  One level is chosen
+    * for the whole Entity from its bounding sphere, so every symmetric copy packed
+    * into it is drawn at the level the group as a whole needs.
+    */
+    ElementBuffer * _getDrawEBuffer();
 };
 }
 #endif
@@ -1,12 +1,15 @@
 #ifndef _VSP_GRAPHIC_GRAPHIC_ENGINE_ENTRY_H
 #define _VSP_GRAPHIC_GRAPHIC_ENGINE_ENTRY_H
 
+#include <functional>
 #include <string>
+#include <vector>
 
 namespace VSPGraphic
 {
 class Scene;
 class Display;
+class Image;
 
 /*!
 * This is the Entry Object to access VSPGraphic.
@@ -44,6 +47,13 @@ public:
     */
     void dumpScreenImage( const std::string &fileName, int width, int height, bool transparentBG, bool autcrop, bool framebufferSupported, int filetype );
 
+    /*!
+    * Dump one image per file name, sharing a single offscreen target.
+    * setupView( i ) is called before drawing image i and may only change
+    * the camera or display state, scene buffers are not reloaded.
+    */
+    void dumpScreenImages( const std::vector< std::string > &fileNames, int width, int height, bool transparentBG, bool autocrop, bool framebufferSupported, int filetype, const std::function< void( int ) > &setupView );
+
 public:
     /*!
     * Initialize Glew.
@@ -61,6 +71,9 @@ public:
     */
     Display * getDisplay();
 
+private:
+    void _writeImage( Image &image, const std::string &fileName, bool autocrop, int filetype );
+
 private:
     Scene * _scene;
     Display * _display;
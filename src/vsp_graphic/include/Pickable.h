@@ -31,6 +31,11 @@ public:
     * Process picked Id. If current object is picked, return true.
     */
     virtual bool processPickingResult(unsigned int pickedId);
+    /*!
+    * Color id of the vertex at index, or the single id of a geometry Pickable.
+    * Return 0 if index is outside this Pickable.
+    */
+    unsigned int getColorIndex(int index);
 
 public:
     /*!
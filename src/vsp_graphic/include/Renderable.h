@@ -5,6 +5,8 @@
 #include "SceneObject.h"
 #include "glm/glm.hpp"
 
+#include <vector>
+
 namespace VSPGraphic
 {
 class VertexBuffer;
@@ -40,6 +42,10 @@ public:
     * Reset Vertex Buffer append location to start of the buffer.
     */
     virtual void emptyVBuffer();
+    /*!
+    * Replace Vertex Buffer content, in place when it fits.
+    */
+    virtual void updateVBuffer( void * mem_ptr, unsigned int mem_size );
 
 public:
     /*!
@@ -52,10 +58,27 @@ public:
     */
     virtual void emptyEBuffer();
     /*!
+    * Replace Element Buffer content, in place when it fits.
+    */
+    virtual void updateEBuffer( void * mem_ptr, unsigned int mem_size );
+    /*!
     * Enable or Disable Element Buffer usage.  Enable this will activate Element Indexing.
     * Disabled by default.
     */
     void enableEBuffer( bool enable );
+    /*!
+    * Replace a coarse level of detail Element Buffer.  Level 0 is the Element Buffer
+    * itself, coarser levels index a subset of the same vertices and are drawn instead
+    * when the object covers few pixels.  Empty levels are skipped.
+    */
+    virtual void updateLODEBuffer( unsigned int level, void * mem_ptr, unsigned int mem_size );
+    /*!
+    * Set bounding sphere used to choose the level of detail.  A radius of zero
+    * always draws level 0.  The sphere bounds everything in the vertex buffer,
+    * including symmetric copies, so a small copy far from the rest is not
+    * decimated on its own.
+    */
+    void setBounds( const glm::vec3 & center, float radius );
 
 public:
     /*!
@@ -211,6 +234,10 @@ protected:
     ColorBuffer * _lineColorBuffer;
     ColorBuffer * _meshColorBuffer;
     ElementBuffer * _eBuffer;
+    std::vector< ElementBuffer * > _lodEBuffers;
+
+    glm::vec3 _bndCenter;
+    float _bndRadius;
 
 private:
     Common::VSPenum _type, _style;
@@ -77,6 +77,25 @@ public:
     virtual void preSelectBox(int x1, int y1, int x2, int y2);
     virtual bool selectBox();
 
+    /*!
+    * Picking resolved outside the renderer, e.g. by a CPU ray query.  pickableId
+    * is the scene id of the Pickable and index the vertex within its source.
+    * Geometry Pickables ignore index.  Pass 0xFFFFFFFF to clear the highlight.
+    */
+    virtual void activatePicking(unsigned int pickableId, int index);
+    /*!
+    * Box preselection resolved outside the renderer, one vertex per entry.
+    */
+    virtual void preSelect(const std::vector<unsigned int> &pickableIds, const std::vector<int> &indices);
+
+    /*!
+    * Enable or Disable CPU picking.  When enabled the color coded picking pass
+    * is skipped and picks are given through activatePicking(pickableId, index)
+    * and preSelect().  Disabled by default.
+    */
+    void setCPUPicking(bool enable);
+    bool getCPUPicking();
+
     /*!
     * Select current picked point.  Return true if action is successful, else
     * return false.
@@ -159,6 +178,7 @@ public:
 private:
     void _generateUniqueId(unsigned int * id_out);
     void _updateFlags();
+    void _processPickingResult(unsigned int id);
     void _clearSelections();
     void _removeSelections(Renderable * source);
 
@@ -176,6 +196,8 @@ private:
 
     bool _showSelection;
 
+    bool _cpuPicking;
+
     Pickable * _highlighted;
     std::set< PickablePnts* > _preselected;
 };
@@ -34,6 +34,13 @@ public:
     */
     virtual void empty();
     /*!
+    * Replace buffer content.  Data that fits the current buffer is written in
+    * place, larger data reallocates without reading back the old content.
+    * mem_ptr - data pointer.
+    * mem_size - data size in bytes.
+    */
+    virtual void update( void * mem_ptr, unsigned int mem_size );
+    /*!
     * Bind buffer to current context.
     */
     virtual void bind();
@@ -131,6 +131,10 @@ public:
     */
     glm::vec3 screenToWorld( const glm::vec2 &screenCoord);
     /*
+    * World space ray through a screen coordinate, from the near plane into the scene.
+    */
+    void screenToRay( const glm::vec2 &screenCoord, glm::vec3 &org, glm::vec3 &dir );
+    /*
     * Transform screen coordinate to normalized device coordinate.
     */
     glm::vec2 screenToNDC( const glm::vec2 &screenCoord);
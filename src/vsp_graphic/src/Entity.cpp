@@ -1,4 +1,5 @@
 #include <assert.h>
+#include <cmath>
 
 #include "OpenGLHeaders.h"
 
@@ -11,6 +12,11 @@
 
 #include "Display.h"
 
+#include "glm/ext.hpp"
+
+// Estimated on screen quad size in pixels below which a coarser level is used.
+#define LOD_QUAD_PIXELS 6.0f
+
 namespace VSPGraphic
 {
 Entity::Entity() : Renderable()
@@ -409,7 +415,9 @@ void Entity::_draw_Mesh_EBuffer()
 void Entity::_draw_Wire_EBuffer()
 {
     glPolygonMode( GL_FRONT_AND_BACK, GL_LINE );
-    _draw_EBuffer();
+
+    // Wireframe shows the tessellation itself, never decimate it.
+    _draw_EBuffer( false );
 }
 
 void Entity::_draw_VBuffer()
@@ -440,7 +448,7 @@ void Entity::_draw_VBuffer()
     glFrontFace(GL_CCW);
 }
 
-void Entity::_draw_EBuffer()
+void Entity::_draw_EBuffer( bool lodFlag )
 {
     if( _getFacingCWFlag() )
     {
@@ -451,6 +459,8 @@ void Entity::_draw_EBuffer()
         glFrontFace(GL_CCW);
     }
 
+    ElementBuffer * eBuffer = _eBuffer;
+
     switch( getPrimType() )
     {
     case Common::VSP_TRIANGLES:
@@ -460,9 +470,13 @@ void Entity::_draw_EBuffer()
         break;
 
     case Common::VSP_QUADS:
-        _eBuffer->bind();
-        _vBuffer->drawElem( GL_QUADS, _eBuffer->getElemSize(), ( void* )0 );
-        _eBuffer->unbind();
+        if( lodFlag )
+        {
+            eBuffer = _getDrawEBuffer();
+        }
+        eBuffer->bind();
+        _vBuffer->drawElem( GL_QUADS, eBuffer->getElemSize(), ( void* )0 );
+        eBuffer->unbind();
         break;
 
     default:
@@ -471,4 +485,44 @@ void Entity::_draw_EBuffer()
 
     glFrontFace(GL_CCW);
 }
+
+ElementBuffer * Entity::_getDrawEBuffer()
+{
+    if( _bndRadius <= 0.f || _lodEBuffers.empty() )
+    {
+        return _eBuffer;
+    }
+
+    GLfloat mvArray[16];
+    glGetFloatv( GL_MODELVIEW_MATRIX, mvArray );
+    glm::mat4 mvMat = glm::make_mat4( mvArray );
+
+    GLfloat pArray[16];
+    glGetFloatv( GL_PROJECTION_MATRIX, pArray );
+    glm::mat4 pMat = glm::make_mat4( pArray );
+
+    GLint vp[4];
+    glGetIntegerv( GL_VIEWPORT, vp );
+
+    // Projected bounding sphere radius in pixels.  w is 1 for orthographic views.
+    glm::vec4 clip = pMat * ( mvMat * glm::vec4( _bndCenter, 1.f ) );
+    float w = std::abs( clip.w );
+    if( w < 1e-12f )
+    {
+        return _eBuffer;
+    }
+    float scale = glm::length( glm::vec3( mvMat[0] ) );
+    float radius = _bndRadius * scale * std::abs( pMat[1][1] ) * 0.5f * vp[3] / w;
+
+    // Quads of a level spread roughly evenly over the object's screen footprint.
+    for( int i = ( int )_lodEBuffers.size() - 1; i >= 0; i-- )
+    {
+        unsigned int nquad = _lodEBuffers[i]->getElemSize() / 4;
+        if( nquad > 0 && 2.f * radius / std::sqrt( ( float )nquad ) <= LOD_QUAD_PIXELS )
+        {
+            return _lodEBuffers[i];
+        }
+    }
+    return _eBuffer;
+}
 }
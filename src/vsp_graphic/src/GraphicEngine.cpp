@@ -38,12 +38,16 @@ void GraphicEngine::draw( int mouseX, int mouseY )
 
 void GraphicEngine::dumpScreenImage( const std::string &fileName, int width, int height, bool transparentBG, bool autocrop, bool framebufferSupported, int filetype )
 {
-    GLuint color;
-    GLuint depth;
-    GLuint fbo;
-    int oldWidth, oldHeight;
-    // width * height * RGBA
-    Image image( width, height, 4 );
+    std::vector< std::string > fileNames( 1, fileName );
+    dumpScreenImages( fileNames, width, height, transparentBG, autocrop, framebufferSupported, filetype, std::function< void( int ) >() );
+}
+
+void GraphicEngine::dumpScreenImages( const std::vector< std::string > &fileNames, int width, int height, bool transparentBG, bool autocrop, bool framebufferSupported, int filetype, const std::function< void( int ) > &setupView )
+{
+    GLuint color = 0;
+    GLuint depth = 0;
+    GLuint fbo = 0;
+    int oldWidth = 0, oldHeight = 0;
 
     std::vector< VSPGraphic::Viewport * > vports = _display->getLayoutMgr()->getViewports();
     if ( transparentBG )
@@ -64,6 +68,7 @@ void GraphicEngine::dumpScreenImage( const std::string &fileName, int width, int
 
         _display->resizeScreenshot( width, height );
 
+        // One offscreen target is shared by every image of the batch.
         glGenTextures(1, &color);
         glBindTexture(GL_TEXTURE_2D, color);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -80,24 +85,41 @@ void GraphicEngine::dumpScreenImage( const std::string &fileName, int width, int
         glBindFramebuffer(GL_FRAMEBUFFER, fbo);
         glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, color, 0);
         glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depth);
+    }
+
+    glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+    glPixelStorei( GL_PACK_ALIGNMENT, 1 );
+
+    for ( int iview = 0; iview < ( int )fileNames.size(); iview++ )
+    {
+        if ( setupView )
+        {
+            setupView( iview );
+        }
+
+        // width * height * RGBA
+        Image image( width, height, 4 );
 
         _display->draw( _scene, 0xFFFFFFFF, 0xFFFFFFFF );
-        _display->resizeScreenshot( oldWidth, oldHeight );
 
-        glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
-        glPixelStorei( GL_PACK_ALIGNMENT, 1 );
+        if ( !framebufferSupported )
+        {
+            glReadBuffer( GL_BACK );
+        }
         glReadPixels( 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, &(image.getImageData())[0] );
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+        _writeImage( image, fileNames[iview], autocrop, filetype );
     }
-    else
+
+    if ( framebufferSupported )
     {
-        _display->draw( _scene, 0xFFFFFFFF, 0xFFFFFFFF );
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
 
-        glReadBuffer( GL_BACK );
+        glDeleteFramebuffers(1, &fbo);
+        glDeleteRenderbuffers(1, &depth);
+        glDeleteTextures(1, &color);
 
-        glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
-        glPixelStorei( GL_PACK_ALIGNMENT, 1 );
-        glReadPixels( 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, &(image.getImageData())[0] );
+        _display->resizeScreenshot( oldWidth, oldHeight );
     }
 
     for ( int i = 0; i < vports.size(); i++ )
@@ -107,7 +129,10 @@ void GraphicEngine::dumpScreenImage( const std::string &fileName, int width, int
             vports[i]->getBackground()->setAlpha( 1.0f );
         }
     }
+}
 
+void GraphicEngine::_writeImage( Image &image, const std::string &fileName, bool autocrop, int filetype )
+{
     image.flipud();
 
     if ( autocrop )
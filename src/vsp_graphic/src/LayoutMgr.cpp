@@ -117,6 +117,12 @@ void LayoutMgr::resizeScreenshot( int width, int height, float screenSizeDiffRat
 
 void LayoutMgr::predraw( Scene * scene, int x, int y )
 {
+    // Picks are resolved on the CPU and handed to the scene, no color pass needed.
+    if( scene->getCPUPicking() )
+    {
+        return;
+    }
+
     // Preprocessing
     for( int i = 0; i < ( int )_viewportList.size(); i++ )
     {
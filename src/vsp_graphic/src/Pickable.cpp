@@ -37,6 +37,23 @@ bool Pickable::processPickingResult(unsigned int pickedId)
     return _highlighted;
 }
 
+unsigned int Pickable::getColorIndex(int index)
+{
+    if(_colorIndexRange.start == 0 || index < 0)
+    {
+        return 0;
+    }
+    if(_colorIndexRange.start == _colorIndexRange.end)
+    {
+        return _colorIndexRange.start;
+    }
+    if(_colorIndexRange.start + index <= _colorIndexRange.end)
+    {
+        return _colorIndexRange.start + index;
+    }
+    return 0;
+}
+
 Renderable * Pickable::getSource()
 {
     return _rSource;
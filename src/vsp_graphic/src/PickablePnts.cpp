@@ -90,19 +90,14 @@ void PickablePnts::_draw()
     if(_highlighted)
     {
         std::vector< int > index = getIndex();
-        for ( unsigned int i = 0; i < index.size(); i++ )
-        {
-
-            glm::vec3 hlPoint = _rSource->getVertexVec( index[i] );
 
-            if( !glm::any(glm::isnan(hlPoint)) )
-            {
-                glColor3f(1.f, 0.f, 0.f);
-                glPointSize(_pointSize * 1.2f);
-                glBegin(GL_POINTS);
-                glVertex3f(hlPoint[0], hlPoint[1], hlPoint[2]);
-                glEnd();
-            }
+        // Draw highlighted vertices straight from the source buffer.
+        std::vector< unsigned int > elems( index.begin(), index.end() );
+        if( !elems.empty() )
+        {
+            glColor3f(1.f, 0.f, 0.f);
+            glPointSize(_pointSize * 1.2f);
+            _rSource->getVBuffer()->drawElem( GL_POINTS, elems.size(), elems.data() );
         }
 
         // reset highlights so highlighted point turns off
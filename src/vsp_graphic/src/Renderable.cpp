@@ -25,6 +25,9 @@ void Renderable::init()
     _meshColorBuffer = new ColorBuffer( GL_FLOAT );
     _eBuffer = new ElementBuffer();
 
+    _bndCenter = glm::vec3( 0.f );
+    _bndRadius = 0.f;
+
     _meshColor.red = _meshColor.green = _meshColor.blue = 1.f;
     _lineColor.red = _lineColor.green = _lineColor.blue = 0.f;
     _meshColor.alpha = _lineColor.alpha = _pointColor.alpha = 1.f;
@@ -50,6 +53,12 @@ void Renderable::clear()
     delete _lineColorBuffer;
     delete _meshColorBuffer;
     delete _eBuffer;
+
+    for ( int i = 0; i < ( int )_lodEBuffers.size(); i++ )
+    {
+        delete _lodEBuffers[i];
+    }
+    _lodEBuffers.clear();
 }
 
 void Renderable::appendVBuffer( void * mem_ptr, unsigned int mem_size )
@@ -62,6 +71,11 @@ void Renderable::emptyVBuffer()
     _vBuffer->empty();
 }
 
+void Renderable::updateVBuffer( void * mem_ptr, unsigned int mem_size )
+{
+    _vBuffer->update( mem_ptr, mem_size );
+}
+
 void Renderable::appendEBuffer( void * mem_ptr, unsigned int mem_size )
 {
     _eBuffer->append( mem_ptr, mem_size );
@@ -72,11 +86,37 @@ void Renderable::emptyEBuffer()
     _eBuffer->empty();
 }
 
+void Renderable::updateEBuffer( void * mem_ptr, unsigned int mem_size )
+{
+    _eBuffer->update( mem_ptr, mem_size );
+}
+
 void Renderable::enableEBuffer( bool enable )
 {
     _eBufferFlag = enable;
 }
 
+void Renderable::updateLODEBuffer( unsigned int level, void * mem_ptr, unsigned int mem_size )
+{
+    if ( level == 0 )
+    {
+        updateEBuffer( mem_ptr, mem_size );
+        return;
+    }
+
+    while ( _lodEBuffers.size() < level )
+    {
+        _lodEBuffers.push_back( new ElementBuffer() );
+    }
+    _lodEBuffers[level - 1]->update( mem_ptr, mem_size );
+}
+
+void Renderable::setBounds( const glm::vec3 & center, float radius )
+{
+    _bndCenter = center;
+    _bndRadius = radius;
+}
+
 void Renderable::appendLineCBuffer( void * mem_ptr, unsigned int mem_size )
 {
     _lineColorBuffer->append( mem_ptr, mem_size );
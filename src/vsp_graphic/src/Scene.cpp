@@ -30,6 +30,8 @@ Scene::Scene()
 
     _showSelection = true;
 
+    _cpuPicking = false;
+
     _highlighted = nullptr;
 }
 Scene::~Scene()
@@ -221,6 +223,26 @@ void Scene::activatePicking(int x, int y)
 
     bytesToUInt(index, &id);
 
+    _processPickingResult(id);
+}
+
+void Scene::activatePicking(unsigned int pickableId, int index)
+{
+    _highlighted = nullptr;
+
+    unsigned int id = 0;
+
+    Pickable * pickable = dynamic_cast<Pickable*>( getObject(pickableId) );
+    if(pickable)
+    {
+        id = pickable->getColorIndex(index);
+    }
+
+    _processPickingResult(id);
+}
+
+void Scene::_processPickingResult(unsigned int id)
+{
     if(id)
     {
         for ( auto it = _sceneMap.begin(); it != _sceneMap.end(); ++it )
@@ -320,6 +342,33 @@ void Scene::preSelectBox(int x1, int y1, int x2, int y2)
     delete [] index;
 }
 
+void Scene::preSelect(const std::vector<unsigned int> &pickableIds, const std::vector<int> &indices)
+{
+    _preselected.clear();
+
+    for ( auto it = _sceneMap.begin(); it != _sceneMap.end(); ++it )
+    {
+        PickablePnts * pickable = dynamic_cast<PickablePnts*>( it->second );
+        if(pickable)
+        {
+            pickable->reset();
+        }
+    }
+
+    // Targets are known, so no search over the scene per id.
+    for ( int i = 0; i < (int)pickableIds.size() && i < (int)indices.size(); i++ )
+    {
+        PickablePnts * pickable = dynamic_cast<PickablePnts*>( getObject(pickableIds[i]) );
+        if(pickable)
+        {
+            if( pickable->processPickingResult( pickable->getColorIndex(indices[i]) ) )
+            {
+                _preselected.insert( pickable );
+            }
+        }
+    }
+}
+
 bool Scene::selectBox()
 {
     if ( _preselected.size() == 0 )
@@ -492,6 +541,16 @@ bool Scene::isPickingEnabled()
     return _toPick;
 }
 
+void Scene::setCPUPicking(bool enable)
+{
+    _cpuPicking = enable;
+}
+
+bool Scene::getCPUPicking()
+{
+    return _cpuPicking;
+}
+
 void Scene::_generateUniqueId(unsigned int * id_out)
 {
     static unsigned int _id_tracker = 0;
@@ -79,6 +79,34 @@ void VBO::append( void * mem_ptr, unsigned int mem_size )
     glBindBuffer( _buffer_Type, 0 );
 }
 
+void VBO::update( void * mem_ptr, unsigned int mem_size )
+{
+    if ( !_support )
+    {
+        return;
+    }
+
+    glBindBuffer( _buffer_Type, _id );
+
+    if( mem_size > _size )
+    {
+        // Old content is replaced, so grow without _extend()'s copy.  Leave
+        // headroom so a slowly growing mesh does not reallocate every update.
+        unsigned int grow = mem_size + mem_size / 2;
+        _size = BUFFER_INCREMENT * ( grow / BUFFER_INCREMENT + ( grow % BUFFER_INCREMENT == 0 ? 0 : 1 ) );
+        glBufferData( _buffer_Type, _size, nullptr, GL_DYNAMIC_DRAW );
+    }
+
+    if( mem_size > 0 )
+    {
+        glBufferSubData( _buffer_Type, 0, mem_size, mem_ptr );
+    }
+    glBindBuffer( _buffer_Type, 0 );
+
+    _start = 0;
+    _end = mem_size;
+}
+
 void VBO::empty()
 {
     if( !_support )
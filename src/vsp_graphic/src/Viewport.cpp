@@ -432,6 +432,16 @@ glm::vec3 Viewport::screenToWorld( const glm::vec2 &screenCoord)
         glm::vec4(_x, _y, _vWidth, _vHeight));
 }
 
+void Viewport::screenToRay( const glm::vec2 &screenCoord, glm::vec3 &org, glm::vec3 &dir )
+{
+    glm::vec4 vp = glm::vec4(_x, _y, _vWidth, _vHeight);
+
+    org = glm::unProject(glm::vec3(screenCoord, 0.0), _camera->getModelViewMatrix(), _camera->getProjectionMatrix(), vp);
+    glm::vec3 back = glm::unProject(glm::vec3(screenCoord, 1.0), _camera->getModelViewMatrix(), _camera->getProjectionMatrix(), vp);
+
+    dir = glm::normalize(back - org);
+}
+
 glm::vec2 Viewport::screenToNDC( const glm::vec2 &screenCoord)
 {
     glm::vec2 NDC = screenCoord;
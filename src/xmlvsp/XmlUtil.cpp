@@ -7,6 +7,21 @@
 #include "XmlUtil.h"
 #include "StringUtil.h"
 #include <cfloat>
+#include <cstdint>
+#include <cctype>
+
+//==== Binary Array State ====//
+static int s_BinaryArrayMode = XmlUtil::BINARY_ARRAY_NONE;
+static vector< unsigned char > s_SidecarBuffer;             // Filled while encoding
+static const unsigned char * s_SidecarData = nullptr;       // Owned by caller while decoding
+static size_t s_SidecarSize = 0;
+static int s_NumBinaryArrayErrors = 0;                      // Since last ClearBinaryArrayErrors
+static string s_BinaryArrayErrorMsg;                        // First error
+
+// Short vectors (colors, single points, etc.) stay as text even in binary mode
+static const int BINARY_ARRAY_MIN_SIZE = 64;
+
+static const char BASE64_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
 
 //==== Get Number of Same Names ====//
 unsigned int XmlUtil::GetNumNames( xmlNodePtr node, const char * name )
@@ -70,6 +85,27 @@ xmlNodePtr XmlUtil::GetNodeDbg( xmlNodePtr node, const char * name, int id, cons
     return nullptr;
 }
 
+//==== Map Child Node Names To Nodes - First Match Wins, Same As GetNode( node, name, 0 ) ====//
+void XmlUtil::BuildChildNodeMap( xmlNodePtr node, unordered_map< string, xmlNodePtr > & node_map )
+{
+    node_map.clear();
+
+    if ( node == nullptr )
+    {
+        return;
+    }
+
+    xmlNodePtr iter_node = node->xmlChildrenNode;
+    while( iter_node != nullptr )
+    {
+        if ( iter_node->name )
+        {
+            node_map.emplace( string( ( const char * )iter_node->name ), iter_node );
+        }
+        iter_node = iter_node->next;
+    }
+}
+
 //==== Extract Double From Node  ====//
 double XmlUtil::ExtractDouble( xmlNodePtr node )
 {
@@ -330,6 +366,19 @@ int XmlUtil::ExtractDoubleArray( xmlNodePtr node, const char &sep, double * arra
         return 0;
     }
 
+    if ( IsBinaryArrayNode( node ) )
+    {
+        vector< double > vec;
+        GetBinaryDoubleArrayNode( node, vec );
+
+        num = std::min( size, ( int )vec.size() );
+        for ( i = 0 ; i < num ; i++ )
+        {
+            array[i] = vec[i];
+        }
+        return num;
+    }
+
     num = 0;
     elemcnt = 0;
     str = ( char* )xmlNodeListGetString( node->doc, node->xmlChildrenNode, 1 );
@@ -443,6 +492,11 @@ xmlNodePtr XmlUtil::AddVectorIntNode( xmlNodePtr root, const char * name, const
 //==== Create Node and Add Vector Of Doubles ====//
 xmlNodePtr XmlUtil::AddVectorDoubleNode( xmlNodePtr root, const char * name, const vector< double > & vec )
 {
+    if ( s_BinaryArrayMode != BINARY_ARRAY_NONE && ( int )vec.size() >= BINARY_ARRAY_MIN_SIZE )
+    {
+        return AddBinaryDoubleArrayNode( root, name, vec.data(), ( int )vec.size() );
+    }
+
     string str;
     char buff[256];
     for ( int i = 0 ; i < ( int )vec.size() ; i++ )
@@ -550,6 +604,13 @@ vector< double > XmlUtil::ExtractVectorDoubleNode( xmlNodePtr root, const char *
 {
     vector< double > ret_vec;
 
+    xmlNodePtr n = GetNode( root, name, 0 );
+    if ( IsBinaryArrayNode( n ) )
+    {
+        GetBinaryDoubleArrayNode( n, ret_vec );
+        return ret_vec;
+    }
+
     string str = FindString( root, name, string() );
 
     int last_comma = -1;
@@ -615,6 +676,12 @@ vector< double > XmlUtil::GetVectorDoubleNode( xmlNodePtr node )
 {
     vector< double > ret_vec;
 
+    if ( IsBinaryArrayNode( node ) )
+    {
+        GetBinaryDoubleArrayNode( node, ret_vec );
+        return ret_vec;
+    }
+
     string str = ExtractString( node );
 
     int last_comma = -1;
@@ -672,6 +739,308 @@ vector< vec3d > XmlUtil::GetVectorVec3dNode( xmlNodePtr node )
     return ret_vec;
 }
 
+//==== Set How Add*Array Functions Write Large Arrays ====//
+void XmlUtil::SetBinaryArrayMode( int mode )
+{
+    s_BinaryArrayMode = mode;
+}
+
+int XmlUtil::GetBinaryArrayMode()
+{
+    return s_BinaryArrayMode;
+}
+
+//==== Bytes Written To Sidecar Since Last Clear ====//
+const vector< unsigned char > & XmlUtil::GetSidecarBuffer()
+{
+    return s_SidecarBuffer;
+}
+
+//==== Point Sidecar Nodes At Caller Owned (Mapped) Data ====//
+void XmlUtil::SetSidecarData( const unsigned char * data, size_t size )
+{
+    s_SidecarData = data;
+    s_SidecarSize = size;
+}
+
+void XmlUtil::ClearSidecar()
+{
+    s_SidecarBuffer.clear();
+    s_SidecarBuffer.shrink_to_fit();
+    s_SidecarData = nullptr;
+    s_SidecarSize = 0;
+}
+
+//==== Record Binary Array That Could Not Be Read ====//
+void XmlUtil::AddBinaryArrayError( const string & msg )
+{
+    fprintf( stderr, "%s\n", msg.c_str() );
+
+    if ( s_NumBinaryArrayErrors == 0 )
+    {
+        s_BinaryArrayErrorMsg = msg;
+    }
+    s_NumBinaryArrayErrors++;
+}
+
+int XmlUtil::GetNumBinaryArrayErrors()
+{
+    return s_NumBinaryArrayErrors;
+}
+
+string XmlUtil::GetBinaryArrayErrorMsg()
+{
+    return s_BinaryArrayErrorMsg;
+}
+
+void XmlUtil::ClearBinaryArrayErrors()
+{
+    s_NumBinaryArrayErrors = 0;
+    s_BinaryArrayErrorMsg.clear();
+}
+
+//==== 32 Bit FNV-1a Hash ====//
+unsigned int XmlUtil::Checksum( const unsigned char * data, size_t size )
+{
+    uint32_t h = 2166136261u;
+    for ( size_t i = 0 ; i < size ; i++ )
+    {
+        h ^= data[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+//==== Encode Bytes As Base64 ====//
+string XmlUtil::EncodeBase64( const unsigned char * data, size_t size )
+{
+    string str;
+    str.reserve( 4 * ( ( size + 2 ) / 3 ) );
+
+    size_t i = 0;
+    for ( ; i + 2 < size ; i += 3 )
+    {
+        uint32_t v = ( data[i] << 16 ) | ( data[i + 1] << 8 ) | data[i + 2];
+        str.push_back( BASE64_CHARS[ ( v >> 18 ) & 0x3f ] );
+        str.push_back( BASE64_CHARS[ ( v >> 12 ) & 0x3f ] );
+        str.push_back( BASE64_CHARS[ ( v >> 6 ) & 0x3f ] );
+        str.push_back( BASE64_CHARS[ v & 0x3f ] );
+    }
+
+    if ( i < size )
+    {
+        uint32_t v = data[i] << 16;
+        if ( i + 1 < size )
+        {
+            v |= data[i + 1] << 8;
+        }
+
+        str.push_back( BASE64_CHARS[ ( v >> 18 ) & 0x3f ] );
+        str.push_back( BASE64_CHARS[ ( v >> 12 ) & 0x3f ] );
+        str.push_back( ( i + 1 < size ) ? BASE64_CHARS[ ( v >> 6 ) & 0x3f ] : '=' );
+        str.push_back( '=' );
+    }
+
+    return str;
+}
+
+//==== Decode Base64, Whitespace Ignored ====//
+bool XmlUtil::DecodeBase64( const char * str, vector< unsigned char > & data )
+{
+    data.clear();
+
+    if ( str == nullptr )
+    {
+        return false;
+    }
+
+    uint32_t v = 0;
+    int nbits = 0;
+    for ( const char* c = str ; *c != '\0' ; c++ )
+    {
+        int d;
+        if ( *c >= 'A' && *c <= 'Z' )
+        {
+            d = *c - 'A';
+        }
+        else if ( *c >= 'a' && *c <= 'z' )
+        {
+            d = *c - 'a' + 26;
+        }
+        else if ( *c >= '0' && *c <= '9' )
+        {
+            d = *c - '0' + 52;
+        }
+        else if ( *c == '+' )
+        {
+            d = 62;
+        }
+        else if ( *c == '/' )
+        {
+            d = 63;
+        }
+        else if ( *c == '=' )
+        {
+            break;
+        }
+        else if ( isspace( ( unsigned char )*c ) )
+        {
+            continue;
+        }
+        else
+        {
+            return false;
+        }
+
+        v = ( v << 6 ) | d;
+        nbits += 6;
+        if ( nbits >= 8 )
+        {
+            nbits -= 8;
+            data.push_back( ( unsigned char )( ( v >> nbits ) & 0xff ) );
+        }
+    }
+    return true;
+}
+
+//==== Doubles To Little Endian Bytes ====//
+static void PackDoubles( const double * arr, int size, unsigned char * bytes )
+{
+    for ( int i = 0 ; i < size ; i++ )
+    {
+        uint64_t u;
+        memcpy( &u, &arr[i], sizeof( u ) );
+        for ( int b = 0 ; b < 8 ; b++ )
+        {
+            bytes[ 8 * i + b ] = ( unsigned char )( ( u >> ( 8 * b ) ) & 0xff );
+        }
+    }
+}
+
+//==== Little Endian Bytes To Doubles ====//
+static void UnpackDoubles( const unsigned char * bytes, int size, double * arr )
+{
+    for ( int i = 0 ; i < size ; i++ )
+    {
+        uint64_t u = 0;
+        for ( int b = 7 ; b >= 0 ; b-- )
+        {
+            u = ( u << 8 ) | bytes[ 8 * i + b ];
+        }
+        memcpy( &arr[i], &u, sizeof( u ) );
+    }
+}
+
+//==== Create Node With Doubles As Base64 Text Or A Sidecar Reference ====//
+xmlNodePtr XmlUtil::AddBinaryDoubleArrayNode( xmlNodePtr root, const char * name, const double * arr, int size )
+{
+    size_t nbytes = 8 * ( size_t )size;
+    xmlNodePtr node;
+    unsigned int sum;
+
+    if ( s_BinaryArrayMode == BINARY_ARRAY_SIDECAR )
+    {
+        size_t offset = s_SidecarBuffer.size();
+        s_SidecarBuffer.resize( offset + nbytes );
+        PackDoubles( arr, size, s_SidecarBuffer.data() + offset );
+        sum = Checksum( s_SidecarBuffer.data() + offset, nbytes );
+
+        node = xmlNewChild( root, nullptr, ( const xmlChar * )name, nullptr );
+        SetStringProp( node, "Encoding", "Sidecar" );
+        SetStringProp( node, "Offset", std::to_string( ( unsigned long long )offset ) );
+    }
+    else
+    {
+        vector< unsigned char > bytes( nbytes );
+        PackDoubles( arr, size, bytes.data() );
+        sum = Checksum( bytes.data(), nbytes );
+
+        node = AddStringNode( root, name, EncodeBase64( bytes.data(), nbytes ) );
+        SetStringProp( node, "Encoding", "Base64" );
+    }
+
+    char str[255];
+    snprintf( str, sizeof( str ), "%08x", sum );
+
+    SetIntProp( node, "Count", size );
+    SetStringProp( node, "Checksum", str );
+
+    return node;
+}
+
+//==== Was Node Written By AddBinaryDoubleArrayNode ====//
+bool XmlUtil::IsBinaryArrayNode( xmlNodePtr node )
+{
+    return node && xmlHasProp( node, ( const xmlChar * )"Encoding" );
+}
+
+//==== Extract Doubles From Base64 Text Or Sidecar, Checksum Verified ====//
+bool XmlUtil::GetBinaryDoubleArrayNode( xmlNodePtr node, vector< double > & vec )
+{
+    vec.clear();
+
+    if ( node == nullptr )
+    {
+        return false;
+    }
+
+    string encoding = FindStringProp( node, "Encoding", string() );
+    int count = FindIntProp( node, "Count", 0 );
+    unsigned int sum = ( unsigned int )strtoul( FindStringProp( node, "Checksum", "0" ).c_str(), nullptr, 16 );
+
+    if ( count <= 0 )
+    {
+        return count == 0;
+    }
+
+    size_t nbytes = 8 * ( size_t )count;
+    const unsigned char * bytes = nullptr;
+    vector< unsigned char > decoded;
+
+    if ( encoding == "Base64" )
+    {
+        char* str = ( char* )xmlNodeListGetString( node->doc, node->xmlChildrenNode, 1 );
+        bool ok = DecodeBase64( str, decoded );
+        if ( str )
+        {
+            xmlFree( str );
+        }
+
+        if ( !ok || decoded.size() != nbytes )
+        {
+            AddBinaryArrayError( string( "Invalid base64 data in " ) + ( const char * )node->name );
+            return false;
+        }
+        bytes = decoded.data();
+    }
+    else if ( encoding == "Sidecar" )
+    {
+        size_t offset = ( size_t )strtoull( FindStringProp( node, "Offset", "0" ).c_str(), nullptr, 10 );
+        if ( s_SidecarData == nullptr || offset > s_SidecarSize || nbytes > s_SidecarSize - offset )
+        {
+            AddBinaryArrayError( string( "Binary data for " ) + ( const char * )node->name + " missing from sidecar file" );
+            return false;
+        }
+        bytes = s_SidecarData + offset;
+    }
+    else
+    {
+        AddBinaryArrayError( "Unknown array encoding " + encoding + " in " + ( const char * )node->name );
+        return false;
+    }
+
+    if ( Checksum( bytes, nbytes ) != sum )
+    {
+        AddBinaryArrayError( string( "Checksum mismatch in binary data for " ) + ( const char * )node->name );
+        return false;
+    }
+
+    vec.resize( count );
+    UnpackDoubles( bytes, count, vec.data() );
+
+    return true;
+}
+
 //==== Encode File Contents ====//
 xmlNodePtr XmlUtil::EncodeFileContents( xmlNodePtr root, const char* file_name )
 {
@@ -16,8 +16,10 @@
 #include <vector>
 #include <string>
 #include <cstring>
+#include <unordered_map>
 using std::string;
 using std::vector;
+using std::unordered_map;
 
 //==== String Functions =====//
 namespace XmlUtil
@@ -26,6 +28,7 @@ unsigned int GetNumNames( xmlNodePtr node, const char * name );
 
 #define GetNode( node, name, num ) GetNodeDbg( node, name, num, __FILE__, __LINE__ )
 xmlNodePtr GetNodeDbg( xmlNodePtr node, const char * name, int num, const char* file, int lineno );
+void BuildChildNodeMap( xmlNodePtr node, unordered_map< string, xmlNodePtr > & node_map );
 
 double ExtractDouble( xmlNodePtr node );
 int    ExtractInt( xmlNodePtr node );
@@ -68,6 +71,29 @@ vec2d GetVec2dNode( xmlNodePtr node );
 vec3d GetVec3dNode( xmlNodePtr node );
 vector< vec3d > GetVectorVec3dNode( xmlNodePtr node );
 
+//==== Binary Arrays - Base64 Inline Or Offsets Into A Sidecar Buffer ====//
+enum BINARY_ARRAY_MODE { BINARY_ARRAY_NONE, BINARY_ARRAY_BASE64, BINARY_ARRAY_SIDECAR };
+
+void SetBinaryArrayMode( int mode );
+int GetBinaryArrayMode();
+const vector< unsigned char > & GetSidecarBuffer();
+void SetSidecarData( const unsigned char * data, size_t size );
+void ClearSidecar();
+
+// Binary arrays that fail to decode are recorded rather than aborting the read.
+void AddBinaryArrayError( const string & msg );
+int GetNumBinaryArrayErrors();
+string GetBinaryArrayErrorMsg();
+void ClearBinaryArrayErrors();
+
+unsigned int Checksum( const unsigned char * data, size_t size );
+string EncodeBase64( const unsigned char * data, size_t size );
+bool DecodeBase64( const char * str, vector< unsigned char > & data );
+
+xmlNodePtr AddBinaryDoubleArrayNode( xmlNodePtr root, const char * name, const double * arr, int size );
+bool IsBinaryArrayNode( xmlNodePtr node );
+bool GetBinaryDoubleArrayNode( xmlNodePtr node, vector< double > & vec );
+
 xmlNodePtr EncodeFileContents( xmlNodePtr root, const char* file_name );
 xmlNodePtr DecodeFileContents( xmlNodePtr root, const char* file_name );
 